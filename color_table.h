@@ -186,6 +186,11 @@
 #define COLOR_DARK_SLATE_GRAY           RGB_TO_UINT(47, 79, 79)
 #define COLOR_BLACK                     RGB_TO_UINT(0, 0, 0)
 
+// Special colors
+// 배경색(b_color)으로 사용시 배경 픽셀은 그리지 않고 전경 픽셀만 그린다.
+// (-1은 ui 함수에서 "기본값/변경없음" 의미로 사용되므로 -2를 사용)
+#define COLOR_TRANSPARENT               (-2)
+
 //------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------
 #endif  // #define __COLOR_TABLE_H__
@@ -0,0 +1,401 @@
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+// Generated by tools/fontc. Do not edit. (make fonts)
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+#include <stddef.h>
+#include "../../lib_fb.h"
+#include "../../lib_font.h"
+
+// FontAscii_16x32 : 256 glyphs, 16384 -> 5583 bytes (+ 1024 bytes meta)
+static const unsigned char FontAscii_16x32_rows[5583] = {
+      0,  9,149,149, 89,153,  0,  0, 63,240,240, 60,243,252,243,240,
+    240,  0, 63,240,  0,170,153, 90,169,170,  0,  0, 31,248, 63,252,
+    112, 14,224,  7,204, 51,192,  3,204, 51,206,115,199,227,195,195,
+    192,  3,224,  7,112, 14, 63,252, 31,248,  0,170,153, 90,169,106,
+      0,  0, 31,248, 63,252,127,254,255,255,243,207,255,255,243,207,
+    241,143,248, 31,252, 63,255,255,127,254, 63,252, 31,248,  0,  0,
+    169, 85,154,168,  0,  0, 56,112,124,248,255,252,127,248, 63,240,
+     31,224, 15,192,  7,128,  3,  0,  0,  0,191,255,255,224,  0,  0,
+      3,  7,128, 15,192, 31,224, 63,240,127,248,255,252,255,252,127,
+    248, 63,240, 31,224, 15,192,  7,128,  3,  0,  9,149,149, 89, 89,
+      0,  0,  3,192, 15,240,252, 63,  3,192, 15,240,  0, 10,170,165,
+    106, 89,  0,  0,  1,128,  3,192,  7,224, 15,240, 31,248, 63,252,
+    127,254,255,255,127,254, 59,220,  3,192, 15,240,  0,  0,  0,169,
+     90,  0,  0,  0,  3,192,  7,224, 15,240,  7,224,  3,192,149, 85,
+     85,169, 90,149, 85, 85,255,255,252, 63,248, 31,240, 15,248, 31,
+    252, 63,255,255,  0,  0, 10,169, 90,160,  0,  0, 15,240, 31,248,
+     60, 60, 56, 28, 48, 12, 56, 28, 60, 60, 31,248, 15,240,149, 85,
+     90,169, 90,169, 85, 85,255,255,248, 31,240, 15,227,199,199,227,
+    207,243,199,227,227,199,240, 15,248, 31,255,255,  0,154,170,170,
+     85,106,  0,  0,  3,252,  0,124,  0,252,  1,252,  3,236,  7,204,
+     15,140, 63,192,127,224,249,240,240,240,249,240,127,224, 63,192,
+      0,170, 85,106,153,149,  0,  0, 15,240, 31,248, 62,124, 60, 60,
+     62,124, 31,248, 15,240,  3,192, 63,252,  3,192,  0,153,153, 85,
+     89,153,  0,  0, 15,255, 15, 15, 15,255, 15,  0, 63,  0,255,  0,
+    252,  0,  0,153,153, 85, 89,153,144,  0, 63,255, 60, 15, 63,255,
+     60, 15, 60, 63,252, 63,252, 60,240,  0,  0,  9, 90,169,170,149,
+      0,  0,  3,192,243,207,251,223, 31,248, 15,240,252, 63, 15,240,
+     31,248,251,223,243,207,  3,192, 10,170,175,255,170,170,  0,  0,
+    128,192,224,240,248,252,254,255,255,128,255,192,255,252,255,252,
+    255,192,255,128,255,254,252,248,240,224,192,128,  5, 85,255,255,
+    245, 85,  0,  0,  4, 12, 28, 60,124,252,  1,252,  3,252,  7,252,
+     15,252,255,252,255,252, 15,252,  7,252,  3,252,  1,252,252,124,
+     60, 28, 12,  4,  0,170,169, 85,170,160,  0,  0,  1,128,  3,192,
+      7,224, 15,240, 31,248, 63,252,  3,192, 63,252, 31,248, 15,240,
+      7,224,  3,192,  1,128,  0,149, 85, 85, 80,149,  0,  0, 60, 60,
+     60, 60,  0,170, 86,169, 85, 85,  0,  0, 63,255,127,255,251,207,
+    243,207,251,207,127,207, 63,207,  3,207,  9,153,153,149,153,153,
+    144,  0, 63,240,240, 60, 60,  0, 15,192, 60,240,240, 60, 60,240,
+     15,192,  0,240,240, 60, 63,240,  0,  0,  0,  0,149, 85,  0,  0,
+    255,252,  0,170,169, 85,170,169,  0,  0,  1,128,  3,192,  7,224,
+     15,240, 31,248, 63,252,  3,192, 63,252, 31,248, 15,240,  7,224,
+      3,192,  1,128, 63,252,  0,170,169, 85, 85, 85,  0,  0,  1,128,
+      3,192,  7,224, 15,240, 31,248, 63,252,  3,192,  0,149, 85, 85,
+     90,170,  0,  0,  3,192, 63,252, 31,248, 15,240,  7,224,  3,192,
+      1,128,  0,  0, 13, 95, 87,  0,  0,  0,  1,192,224,112, 56,255,
+    252,255,252, 56,112,224,  1,192,  0,  0, 10,175,170,  0,  0,  0,
+     14, 28, 56,112,255,252,255,252,112, 56, 28, 14,  0,  0,  0,149,
+     89,  0,  0,  0,240,  0,255,252,  0,  0, 10,169,170,  0,  0,  0,
+      8, 64, 24, 96, 56,112,120,120,255,252,120,120, 56,112, 24, 96,
+      8, 64,  0,  0,153,153,153,144,  0,  0,  3,  0,  7,128, 15,192,
+     31,224, 63,240,127,248,255,252,  0,  0,153,153,153,144,  0,  0,
+    255,252,127,248, 63,240, 31,224, 15,192,  7,128,  3,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,169, 85,150, 80,149,  0,  0,  3,192,
+      7,224, 15,240,  7,224,  3,192,  3,192,  9, 86,128,  0,  0,  0,
+      0,  0, 60, 60, 28, 56, 12, 48,  0,  9, 89,149, 89,149,  0,  0,
+     60,240,255,252, 60,240,255,252, 60,240,149,170,166,170, 86,170,
+    149,  0,  7,128, 63,240,127,248,248,124,240, 60,240, 28,240,  0,
+    248,  0,127,240, 63,248,  0,124,  0, 60,224, 60,240, 60,248,124,
+    127,248, 63,240,  7,128,  0, 10,154,153,154,154,  0,  0,120,120,
+    252,120,204,240,253,224,121,224,  3,192,  7,128, 15,  0, 30,120,
+     30,252, 60,204,120,252,120,120,  0,169, 90,170,165,170,  0,  0,
+     15,192, 31,224, 60,240, 29,224, 31,192, 63, 28,127,188,251,248,
+    241,240,240,240,240,224,240,240,249,240,127,248, 63, 60, 10,170,
+      0,  0,  0,  0,  0,  0, 15, 15, 15, 31, 62, 60,  0,170,153, 85,
+     89,170,  0,  0,  0,112,  0,240,  1,224,  3,192,  7,128, 15,  0,
+      7,128,  3,192,  1,224,  0,240,  0,112,  0,170,153, 85, 89,170,
+      0,  0, 14,  0, 15,  0,  7,128,  3,192,  1,224,  0,240,  1,224,
+      3,192,  7,128, 15,  0, 14,  0,  0,  0, 15,255,255,192,  0,  0,
+     56,112, 60,240, 31,224, 15,192,127,248,255,252,127,248, 15,192,
+     31,224, 60,240, 56,112,  0,  0,  9, 89,101, 64,  0,  0,  7,128,
+    127,248,  7,128,  0,  0,  0,  0,  0,150,160,  0,  3,192,  7,192,
+     15,128, 15,  0,  0,  0,  0,  9, 64,  0,  0,  0,255,252,  0,  0,
+      0,  0,  0,149,  0,  0,  3,192,  0,153,153,153,153,153,144,  0,
+      0, 60,  0,120,  0,240,  1,224,  3,192,  7,128, 15,  0, 30,  0,
+     60,  0,120,  0,240,  0,  0,170,150,149,165,170,  0,  0, 31,224,
+     63,240,124,248,248,124,240, 60,243, 60,247,188,243, 60,240, 60,
+    248,124,124,248, 63,240, 31,224,  0,170,165, 85, 85, 89,  0,  0,
+      3,192,  7,192, 15,192, 31,192, 63,192,  3,192, 63,252,  0,255,
+    213,255,170,255,  0,  0, 63,240,127,248,248,124,240, 60,224, 60,
+     60,124,248,  1,240,  3,224,  7,192, 15,128, 31, 62,124,248,240,
+     60,240, 60,255,252,255,252,  0,170,150,154, 85,170,  0,  0, 63,
+    240,127,248,248,124,240, 60,  0, 60,  0,120, 15,240,  0,120,  0,
+     60,240, 60,248,124,127,248, 63,240,  0,170,170,169,149, 89,  0,
+      0,  0,240,  1,240,  3,240,  7,240, 15,240, 31,240, 62,240,124,
+    240,248,240,240,240,255,252,  0,240,  3,252,  0,153, 85,170, 85,
+    170,  0,  0,255,252,240,  0,255,240,255,248,  0,124,  0, 60,240,
+     60,248,124,127,248, 63,240,  0,170,165,170, 85,106,  0,  0, 15,
+    240, 31,240, 62,  0,124,  0,248,  0,240,  0,255,240,255,248,248,
+    124,240, 60,248,124,127,248, 63,240,  0,153,154,170,149, 85,  0,
+      0,255,252,240, 60,  0, 60,  0,124,  0,248,  1,240,  3,224,  7,
+    192, 15,128, 15,  0,  0,170, 86,154, 85,106,  0,  0, 63,240,127,
+    248,248,124,240, 60,120,120, 63,240,120,120,240, 60,248,124,127,
+    248, 63,240,  0,170, 86,169, 86,170,  0,  0, 63,240,127,248,248,
+    124,240, 60,248,124,127,252, 63,252,  0, 60,  0,124,  0,248,  1,
+    240, 63,224, 63,192,  0,  0,149,  0,  9, 80,  0,  0,  3,192,  3,
+    192,  0,  0,149,  0,  0,150,160,  0,  3,192,  3,192,  7,192, 15,
+    128, 15,  0,  0,  5,127,234,191,213,  0,  0, 60,124,248,  1,240,
+      3,224,  7,192, 15,128, 31, 62, 62, 31, 15,128,  7,192,  3,224,
+      1,240,248,124, 60,  0,  0,  2, 80, 37,  0,  0,  0,255,252,255,
+    252,  0, 10,191,213,127,234,  0,  0, 60, 62, 31, 15,128,  7,192,
+      3,224,  1,240,248,124,124,248,  1,240,  3,224,  7,192, 15,128,
+     31, 62, 60,  0,170, 90,170, 80,149,  0,  0, 63,240,127,248,248,
+    124,240, 60,  0, 60,  0,124,  0,248,  1,240,  3,224,  3,192,  3,
+    192,  0, 10,165,165, 90,170,  0,  0, 63,240,127,248,248,124,240,
+     60,241,252,243,252,243,240,241,240,240,  0,248,  0,127,240, 63,
+    240,  0,170,170, 89,149, 85,  0,  0,  3,  0,  7,128, 15,192, 31,
+    224, 63,240,124,248,248,124,240, 60,255,252,240, 60,  0,170, 86,
+    154, 85,106,  0,  0,255,240,255,248, 60,124, 60, 60, 60,120, 63,
+    240, 60,120, 60, 60, 60,124,255,248,255,240,  0,170,165, 85, 86,
+    170,  0,  0, 31,240, 63,248,124,124,248, 60,240, 28,240,  0,240,
+     28,248, 60,124,124, 63,248, 31,240,  0,170,101, 85, 86,106,  0,
+      0,255,192,255,224, 60,240, 60,120, 60, 60, 60,120, 60,240,255,
+    224,255,192,  0,154,169,153,150,169,  0,  0,255,252, 60, 60, 60,
+     28, 60, 12, 60,  0, 60,192, 63,192, 60,192, 60,  0, 60, 12, 60,
+     28, 60, 60,255,252,  0,154,169,153,149, 89,  0,  0,255,252, 60,
+     60, 60, 28, 60, 12, 60,  0, 60,192, 63,192, 60,192, 60,  0,255,
+      0,  0,170,165, 89,149,170,  0,  0, 31,240, 63,248,124,124,248,
+     60,240, 28,240,  0,241,252,240, 60,248, 60,124,124, 63,252, 31,
+    236,  0,149, 85,153, 85, 85,  0,  0,240, 60,255,252,240, 60,  0,
+    153, 85, 85, 85, 89,  0,  0, 31,224,  7,128, 31,224,  0,153, 85,
+     85,149,106,  0,  0,  3,252,  0,240,240,240,249,240,127,224, 63,
+    192,  0,153,106,166,170, 89,  0,  0,252, 60, 60, 60, 60,124, 60,
+    248, 61,240, 63,224, 63,192, 63,224, 61,240, 60,248, 60,124, 60,
+     60,252, 60,  0,153, 85, 85, 86,169,  0,  0,255,  0, 60,  0, 60,
+     12, 60, 28, 60, 60,255,252,  0,153,153, 89,153, 85,  0,  0,240,
+     60,248,124,252,252,255,252,247,188,243, 60,240, 60,  0,166,102,
+    102,102,102,  0,  0,240, 60,248, 60,252, 60,254, 60,255, 60,247,
+    188,243,252,241,252,240,252,240,124,240, 60,  0,170, 85, 85, 85,
+    106,  0,  0, 63,240,127,248,248,124,240, 60,248,124,127,248, 63,
+    240,  0,170, 86,169, 85, 89,  0,  0,255,240,255,248, 60,124, 60,
+     60, 60,124, 63,248, 63,240, 60,  0,255,  0,  0,170, 85, 85, 90,
+    170,170,  0, 63,240,127,248,248,124,240, 60,243, 60,243,188,243,
+    252,249,252,127,248, 63,240,  0,224,  0,240,  0,124,  0, 60,  0,
+    170, 86,170,169, 89,  0,  0,255,240,255,248, 60,124, 60, 60, 60,
+    124, 63,248, 63,240, 63,224, 61,240, 60,248, 60,124, 60, 60,252,
+     60,  0,170, 90,170,153,106,  0,  0, 63,240,127,248,248,124,240,
+     60,240,  0,120,  0, 63,  0, 15,192,  3,240,  0,120,  0, 60,240,
+     60,248,124,127,248, 63,240,  0,150,101, 85, 85, 89,  0,  0,255,
+    252,199,140,  7,128, 31,224,  0,149, 85, 85, 85,106,  0,  0,240,
+     60,248,124,127,248, 63,240,  0,149, 85, 85,106,170,  0,  0,240,
+     60,248,124,124,248, 63,240, 31,224, 15,192,  7,128,  3,  0,  0,
+    149, 85,150,101,153,  0,  0,240, 60,243, 60,247,188,255,252,124,
+    248, 56,112,  0,153,153,149,153,153,  0,  0,240, 60,120,120, 60,
+    240, 31,224, 15,192, 31,224, 60,240,120,120,240, 60,  0,149, 86,
+    170, 85, 89,  0,  0, 60, 60, 62,124, 31,248, 15,240,  7,224,  3,
+    192, 15,240,  0,255,215,254,171,255,  0,  0,255,252,255,252,240,
+     60,224, 60,192, 60,124,248,  1,240,  3,224,  7,192, 15,128, 31,
+     62,124,248,240, 12,240, 28,240, 60,255,252,255,252,  0,153, 85,
+     85, 85, 89,  0,  0, 15,240, 15,  0, 15,240,  0,153,153,153,153,
+    153,144,  0,240,  0,120,  0, 60,  0, 30,  0, 15,  0,  7,128,  3,
+    192,  1,224,  0,240,  0,120,  0, 60,  0,153, 85, 85, 85, 89,  0,
+      0, 15,240,  0,240, 15,240,191,255,  0,  0,  0,  0,  0,  0,  3,
+      7,128, 15,192, 31,224, 60,240,120,120,240, 60,224, 28,  0,  0,
+      0,  0,  0,  0,  9,  0,255,255,  9,106,  0,  0,  0,  0,  0,  0,
+     15,  0, 15,128,  7,192,  3,192,  0,  0, 10,170,165,106,  0,  0,
+     63,192, 63,224,  1,240,  0,240, 63,240,127,240,248,240,240,240,
+    249,240,127,252, 63, 60,  0,153, 90,170, 85,106,  0,  0,252,  0,
+     60,  0, 63,128, 63,224, 63,240, 60,248, 60,124, 60, 60, 60,124,
+     63,248, 63,240,  0,  0, 10,169, 85,170,  0,  0, 63,240,127,248,
+    248,124,240, 60,240,  0,240, 60,248,124,127,248, 63,240,  0,153,
+     90,169, 85,106,  0,  0,  3,240,  0,240, 15,240, 31,240, 60,240,
+    120,240,240,240,121,240, 63,252, 31, 60,  0,  0, 10,166,101,170,
+      0,  0, 63,240,127,248,248,124,240, 60,255,252,240,  0,240, 60,
+    248,124,127,248, 63,240,  0,170,165,153, 85, 89,  0,  0, 15,192,
+     31,224, 63,240, 60,240, 60,112, 60,  0,255,  0, 60,  0,255,  0,
+      0,  0, 10,165, 85,106,154,160, 63, 60,127,252,249,240,240,240,
+    248,240,127,240, 63,240,  0,240,240,240,249,240,127,224, 63,192,
+      0,153, 90,169, 85, 89,  0,  0,252,  0, 60,  0, 60,240, 63,248,
+     63,252, 63, 60, 60, 60,252, 60,  0,149,  9,149, 85, 89,  0,  0,
+      7,128, 31,128,  7,128, 31,224,  0,149,  9,149, 85, 85,150,160,
+      0, 60,  0,252,  0, 60, 60, 60, 62,124, 31,248, 15,240,  0,153,
+     90,170,106,169,  0,  0,252,  0, 60,  0, 60, 60, 60,124, 60,248,
+     61,240, 63,224, 63,192, 63,224, 61,240, 60,248, 60,124, 60, 60,
+    252, 60,  0,153, 85, 85, 85, 89,  0,  0, 31,128,  7,128, 31,224,
+      0,  0, 10,153, 85, 89,  0,  0,252,240,255,248,255,252,243, 60,
+    240, 60,  0,  0, 10,165, 85, 85,  0,  0,243,240,255,248, 62,124,
+     60, 60,  0,  0, 10,165, 85,106,  0,  0, 63,240,127,248,248,124,
+    240, 60,248,124,127,248, 63,240,  0,  0, 10,165, 85,106,149,144,
+    243,240,255,248, 62,124, 60, 60, 60,124, 63,248, 63,240, 60,  0,
+    255,  0,  0,  0, 10,165, 85,106,149,144, 63, 60,127,252,249,240,
+    240,240,248,240,127,240, 63,240,  0,240,  3,252,  0,  0, 10,169,
+    149, 89,  0,  0,243,240,255,248, 63,124, 62, 60, 60, 60, 60,  0,
+    255,  0,  0,  0, 15,250,253,255,  0,  0, 63,240,127,248,240,124,
+    240, 60,120, 62, 31,128,  7,224,  1,240,120,240, 60,248, 60,127,
+    248, 63,240,  0,170, 89,149, 85,170,  0,  0,  1,  0,  3,  0,  7,
+      0, 15,  0,255,240, 15,  0, 15, 28, 15,188,  7,248,  3,240,  0,
+      0,  9, 85, 85,106,  0,  0,240,240,249,240,127,252, 63, 60,  0,
+      0,  9, 85, 90,170,  0,  0, 60, 60, 62,124, 31,248, 15,240,  7,
+    224,  3,192,  1,128,  0,  0,  9, 89,102, 90,  0,  0,240, 60,243,
+     60,247,188,255,252,124,248, 56,112,  0,  0, 10,170, 86,170,  0,
+      0,240, 60,248,124,124,248, 63,240, 31,224, 15,192, 31,224, 63,
+    240,124,248,248,124,240, 60,  0,  0,  9, 85, 85,106,170,160,240,
+     60,248, 60,127,252, 63,252,  0, 60,  0,124,  0,248,  1,240,255,
+    224,255,192,  0,  0,  9,170,170,169,  0,  0,255,252,240,248,241,
+    240,  3,224,  7,192, 15,128, 31,  0, 62,  0,124,  0,248, 60,240,
+     60,255,252,  0,170, 86,154, 85,106,  0,  0,  0,252,  1,252,  3,
+    224,  3,192,  7,128, 63,  0,  7,128,  3,192,  3,224,  1,252,  0,
+    252,  0,149, 85,  9, 85, 85,  0,  0,  3,192,  3,192,  0,170, 86,
+    154, 85,106,  0,  0, 63,  0, 63,128,  7,192,  3,192,  1,224,  0,
+    252,  1,224,  3,192,  7,192, 63,128, 63,  0,  0,255,192,  0,  0,
+      0,  0,  0, 60, 28,127, 60,255,252,243,248,224,240,  0,  0,170,
+    170, 85,144,  0,  0,  3,  0,  7,128, 15,192, 31,224, 63,240,124,
+    248,248,124,240, 60,255,252,  0,153,153, 85,153,153,153,  0, 15,
+    240, 60, 60,240, 12,240,  0,240, 12, 60, 60, 15,240,  0,240,  0,
+     60, 63,240,  0,144,  9, 85, 85, 89,  0,  0,240,240,240,240, 63,
+     60,  9,153,  9,153,149,153,  0,  0,  0,240,  3,192, 15,  0, 63,
+    240,240, 60,255,252,240,  0,240, 60, 63,240,  9,153,  9,153,149,
+     89,  0,  0,  3,  0, 15,192, 60,240, 63,192,  0,240, 63,240,240,
+    240, 63, 60,  0,144,  9,153,149, 89,  0,  0,240,240, 63,192,  0,
+    240, 63,240,240,240, 63, 60,  9,153,  9,153,149, 89,  0,  0, 60,
+      0, 15,  0,  3,192, 63,192,  0,240, 63,240,240,240, 63, 60,  9,
+    153,  9,153,149, 89,  0,  0, 15,192, 60,240, 15,192, 63,192,  0,
+    240, 63,240,240,240, 63, 60,  0,  0,153,149,153,153,144,  0, 15,
+    240, 60, 60, 60,  0, 60, 60, 15,240,  0,240,  0, 60, 15,240,  9,
+    153,  9,153,149,153,  0,  0,  3,  0, 15,192, 60,240, 63,240,240,
+     60,255,252,240,  0,240, 60, 63,240,  0,144,  9,153,149,153,  0,
+      0,240, 60, 63,240,240, 60,255,252,240,  0,240, 60, 63,240,  9,
+    153,  9,153,149,153,  0,  0, 60,  0, 15,  0,  3,192, 63,240,240,
+     60,255,252,240,  0,240, 60, 63,240,  0,144,  9,149, 85, 89,  0,
+      0, 60, 60, 15,192,  3,192, 15,240,  9,153,  9,149, 85, 89,  0,
+      0,  3,192, 15,240, 60, 60, 15,192,  3,192, 15,240,  9,153,  9,
+    149, 85, 89,  0,  0, 60,  0, 15,  0,  3,192, 15,192,  3,192, 15,
+    240,  9,  9,153,149,153, 85,  0,  0,240, 60,  3,  0, 15,192, 60,
+    240,240, 60,255,252,240, 60,153,144,153,149,153, 85,  0,  0, 15,
+    192, 60,240, 15,192, 15,192, 60,240,240, 60,255,252,240, 60,153,
+    144,153,153,149,153,  0,  0,  3,192, 15,  0, 60,  0,255,252, 60,
+     60, 60,  0, 63,240, 60,  0, 60, 60,255,252,  0,  0,  9,153,153,
+     89,  0,  0,240,240, 63, 60, 15, 60, 63,252,243,192, 60,252,  0,
+    153,149,153, 85, 89,  0,  0, 15,252, 60,240,240,240,255,252,240,
+    240,240,252,  9,153,  9,149, 85, 89,  0,  0,  3,  0, 15,192, 60,
+    240, 63,240,240, 60, 63,240,  0,144,  9,149, 85, 89,  0,  0,240,
+     60, 63,240,240, 60, 63,240,  9,153,  9,149, 85, 89,  0,  0, 60,
+      0, 15,  0,  3,192, 63,240,240, 60, 63,240,  9,153,  9, 85, 85,
+     89,  0,  0, 15,  0, 63,192,240,240,240,240, 63, 60,  9,153,  9,
+     85, 85, 89,  0,  0, 60,  0, 15,  0,  3,192,240,240, 63, 60,  0,
+    144,  9, 85, 85, 89,153,144,240, 60,240, 60, 63,252,  0, 60,  0,
+    240, 63,192,  9,  9,149, 85, 85, 89,  0,  0,240, 60, 63,240,240,
+     60, 63,240,  9,  9, 85, 85, 85, 89,  0,  0,240, 60,240, 60, 63,
+    240,  9, 89,153, 85,153,149,  0,  0,  3,192, 15,240, 60, 60, 60,
+      0, 60, 60, 15,240,  3,192,  9,153,153,149, 85,153,  0,  0, 15,
+    192, 60,240, 60, 48, 60,  0,255,  0, 60,  0,252, 60,255,240,  0,
+    149,153,153,153, 85,  0,  0, 60, 60, 15,240,  3,192, 63,252,  3,
+    192, 63,252,  3,192,  9,149,153,153,149, 89,  0,  0,255,192,240,
+    240,255,192,240, 48,240,240,243,252,240,240,240, 60,  9,153, 85,
+    153, 85, 85,153,  0,  0,252,  3,207,  3,192, 63,252,  3,192,243,
+    192, 63,  0,  9,153,  9,153,149, 89,  0,  0,  3,192, 15,  0, 60,
+      0, 63,192,  0,240, 63,240,240,240, 63, 60,  9,153,  9,149, 85,
+     89,  0,  0,  0,240,  3,192, 15,  0, 15,192,  3,192, 15,240,  9,
+    153,  9,149, 85, 89,  0,  0,  3,192, 15,  0, 60,  0, 63,240,240,
+     60, 63,240,  9,153,  9, 85, 85, 89,  0,  0,  3,192, 15,  0, 60,
+      0,240,240, 63, 60,  0,153,  9,149, 85, 85,  0,  0, 63, 60,243,
+    240,243,240, 60, 60,153,  9,153,153,153, 85,  0,  0, 63, 60,243,
+    240,240, 60,252, 60,255, 60,255,252,243,252,240,252,240, 60,  9,
+    149,144,144,  0,  0,  0,  0, 15,240, 60,240, 15,252, 63,252,  9,
+    149,144,144,  0,  0,  0,  0, 15,192, 60,240, 15,192, 63,240,  0,
+    149,  9,106,169,106,  0,  0, 15,  0, 15,  0, 31,  0, 62,  0,124,
+      0,248,  0,240,  0,240, 60,248,124,127,248, 63,240,  0,  0,  0,
+    153, 85, 80,  0,  0,255,252,240,  0,  0,  0,  0,153, 85, 80,  0,
+      0,255,252,  0, 60,  9, 89,153,153,153,153,153,  0,240,  0,240,
+     12,240, 60,240,240,  3,192, 15,  0, 60,  0,243,240,192, 60,  0,
+    240,  3,192, 15,252,  9, 89,153,153,153,153,149,  0,240,  0,240,
+     12,240, 60,240,240,  3,192, 15,  0, 60, 60,240,252,195,252, 15,
+    252,  0, 60,  0,149,  9,101,149, 90,  0,  0,  3,192,  3,192,  7,
+    224, 15,240,  7,224,  3,192,  0,  0, 10,169,170,  0,  0,  0, 14,
+     28, 30, 60, 60,120,120,240,241,224,120,240, 60,120, 30, 60, 14,
+     28,  0,  0, 10,169,170,  0,  0,  0,225,192,241,224,120,240, 60,
+    120, 30, 60, 60,120,120,240,241,224,225,192,153,153,153,153,153,
+    153,153,153,  3,  3, 48, 48,  3,  3, 48, 48,  3,  3, 48, 48,  3,
+      3, 48, 48,  3,  3, 48, 48,  3,  3, 48, 48,  3,  3, 48, 48,  3,
+      3, 48, 48,153,153,153,153,153,153,153,153, 51, 51,204,204, 51,
+     51,204,204, 51, 51,204,204, 51, 51,204,204, 51, 51,204,204, 51,
+     51,204,204, 51, 51,204,204, 51, 51,204,204,153,153,153,153,153,
+    153,153,153,243,243, 63, 63,243,243, 63, 63,243,243, 63, 63,243,
+    243, 63, 63,243,243, 63, 63,243,243, 63, 63,243,243, 63, 63,243,
+    243, 63, 63,149, 85, 85, 85, 85, 85, 85, 85,  3,192,149, 85, 85,
+     89,149, 85, 85, 85,  3,192,255,192,  3,192,149, 85, 89,153,149,
+     85, 85, 85,  3,192,255,192,  3,192,255,192,  3,192,149, 85, 85,
+     89,149, 85, 85, 85, 15, 60,255, 60, 15, 60,  0,  0,  0,  9,149,
+     85, 85, 85,255,252, 15, 60,  0,  0,  9,153,149, 85, 85, 85,255,
+    192,  3,192,255,192,  3,192,149, 85, 89,153,149, 85, 85, 85, 15,
+     60,255, 60,  0, 60,255, 60, 15, 60,149, 85, 85, 85, 85, 85, 85,
+     85, 15, 60,  0,  0,  9,153,149, 85, 85, 85,255,252,  0, 60,255,
+     60, 15, 60,149, 85, 89,153,  0,  0,  0,  0, 15, 60,255, 60,  0,
+     60,255,252,149, 85, 85, 89,  0,  0,  0,  0, 15, 60,255,252,149,
+     85, 89,153,  0,  0,  0,  0,  3,192,255,192,  3,192,255,192,  0,
+      0,  0,  9,149, 85, 85, 85,255,192,  3,192,149, 85, 85, 89,  0,
+      0,  0,  0,  3,192,  3,255,149, 85, 85, 89,  0,  0,  0,  0,  3,
+    192,255,255,  0,  0,  0,  9,149, 85, 85, 85,255,255,  3,192,149,
+     85, 85, 89,149, 85, 85, 85,  3,192,  3,255,  3,192,  0,  0,  0,
+      9,  0,  0,  0,  0,255,255,149, 85, 85, 89,149, 85, 85, 85,  3,
+    192,255,255,  3,192,149, 85, 89,153,149, 85, 85, 85,  3,192,  3,
+    255,  3,192,  3,255,  3,192,149, 85, 85, 89,149, 85, 85, 85, 15,
+     60, 15, 63, 15, 60,149, 85, 89,153,  0,  0,  0,  0, 15, 60, 15,
+     63, 15,  0, 15,255,  0,  0,  9,153,149, 85, 85, 85, 15,255, 15,
+      0, 15, 63, 15, 60,149, 85, 89,  9,  0,  0,  0,  0, 15, 60,255,
+     63,255,255,  0,  0,  9,  9,149, 85, 85, 85,255,255,255, 63, 15,
+     60,149, 85, 89,153,149, 85, 85, 85, 15, 60, 15, 63, 15,  0, 15,
+     63, 15, 60,  0,  0,  9,  9,  0,  0,  0,  0,255,255,255,255,149,
+     85, 89,  9,149, 85, 85, 85, 15, 60,255, 63,255, 63, 15, 60,149,
+     85, 89,  9,  0,  0,  0,  0,  3,192,255,255,255,255,149, 85, 85,
+     89,  0,  0,  0,  0, 15, 60,255,255,  0,  0,  9,  9,149, 85, 85,
+     85,255,255,255,255,  3,192,  0,  0,  0,  9,149, 85, 85, 85,255,
+    255, 15, 60,149, 85, 85, 89,  0,  0,  0,  0, 15, 60, 15,255,149,
+     85, 89,153,  0,  0,  0,  0,  3,192,  3,255,  3,192,  3,255,  0,
+      0,  9,153,149, 85, 85, 85,  3,255,  3,192,  3,255,  3,192,  0,
+      0,  0,  9,149, 85, 85, 85, 15,255, 15, 60,149, 85, 85, 89,149,
+     85, 85, 85, 15, 60,255,255, 15, 60,149, 85, 89,153,149, 85, 85,
+     85,  3,192,255,255,  3,192,255,255,  3,192,149, 85, 85, 89,  0,
+      0,  0,  0,  3,192,255,192,  0,  0,  0,  9,149, 85, 85, 85,  3,
+    255,  3,192,149, 85, 85, 85, 85, 85, 85, 85,255,255,  0,  0,  0,
+      9, 85, 85, 85, 85,255,255,149, 85, 85, 85, 85, 85, 85, 85,255,
+      0,149, 85, 85, 85, 85, 85, 85, 85,  0,255,149, 85, 85, 80,  0,
+      0,  0,  0,255,255,  0,  0,  9,153, 85,153,  0,  0, 63, 60,243,
+    240,243,192,243,240, 63, 60,  0,170, 86,170,165,106,  0,  0, 63,
+    192,127,224,249,240,240,240,241,224,243,192,243,224,241,240,240,
+    248,240,124,240, 60,240,124,240,248,240,240,  0,153, 89, 85, 85,
+     85,  0,  0,255,252,240, 60,240,  0,  0,  0,153, 85, 85, 85,  0,
+      0,255,252, 60,240,  0, 15,250,191,234,255,  0,  0,255,252,255,
+    252,240, 60,248, 60,124, 62, 31, 15,128,  7,192,  7,192, 15,128,
+     31, 62,124,248, 60,240, 60,255,252,255,252,  0,  0,  9,149, 85,
+     89,  0,  0, 63,252,243,192, 63,  0,  0,  0,149, 85, 89,149,144,
+      0, 60, 60, 63,240, 60,  0,240,  0,  0,  0,153,149, 85, 85,  0,
+      0, 63, 60,243,240,  3,192,  0,  9,153,149, 89,153,  0,  0, 63,
+    252,  3,192, 15,240, 60, 60, 15,240,  3,192, 63,252,  0,  9,153,
+     89,149,153,  0,  0, 15,192, 60,240,240, 60,255,252,240, 60, 60,
+    240, 15,192,  0,153,149, 89, 85, 89,  0,  0, 15,192, 60,240,240,
+     60, 60,240,252,252,  0,153,153,153, 85, 89,  0,  0,  3,252, 15,
+      0,  3,192,  0,240, 15,252, 60, 60, 15,240,  0,  0,  9,149, 89,
+      0,  0,  0, 63,252,243,207, 63,252,  0,  9,153,149,153,153,  0,
+      0,  0, 15,  0, 60, 63,252,243,207,255, 15, 63,252, 60,  0,240,
+      0,  0,153,149,153, 85,153,  0,  0,  3,240, 15,  0, 60,  0, 63,
+    240, 60,  0, 15,  0,  3,240,  0,  9,149, 85, 85, 85,  0,  0, 63,
+    240,240, 60,  0,  0,144,  9,  0,144,  0,  0,255,252,255,252,255,
+    252,  0,  0,149,150, 84, 37,  0,  0,  7,128,127,248,  7,128,255,
+    252,  0, 43,253,127,232, 63,  0,  0, 62, 31, 15,128,  7,192,  3,
+    224,  1,240,248,248,  1,240,  3,224,  7,192, 15,128, 31, 62,127,
+    248,127,248,127,248,  0, 63,234,171,252, 63,  0,  0,  1,240,  3,
+    224,  7,192, 15,128, 31, 62,124,124, 62, 31, 15,128,  7,192,  3,
+    224,  1,240,127,248,127,248,127,248,  0,169, 89, 85, 85, 85, 85,
+     85,  0,252,  1,254,  3,207,  3,192,149, 85, 85, 85,149, 90,  0,
+      0,  3,192,243,192,127,128, 63,  0,  0,  0,149,  9, 66, 84,  0,
+      0,  7,128,255,252,  7,128,  0,  0,  9,144,153,  0,  0,  0, 63,
+     60,243,240, 63, 60,243,240, 10,149,160,  0,  0,  0,  0,  0, 15,
+    192, 31,224, 60,240, 31,224, 15,192,  0,  0,  0,  9, 80,  0,  0,
+      0,  3,192,  0,  0,  0,  0,144,  0,  0,  0,  3,192,  9,149, 85,
+     89,149,153,  0,  0,  0,255,  0,240,252,240, 60,240, 15,240,  3,
+    240, 10,165, 85, 80,  0,  0,  0,  0,243,192,247,224, 62,240, 60,
+    240,  9,153,153,144,  0,  0,  0,  0, 63,  0,243,192, 15,  0, 60,
+      0,240,192,255,192,  0,  0,149, 85, 85, 80,  0,  0, 63,240,
+};
+
+// offset
+static const font_prow_t FontAscii_16x32_meta[256] = {
+    { 0x80000000 }, { 0x80000014 }, { 0x8000003A }, { 0x8000005E }, { 0x00000078 }, { 0x8000009A }, { 0x800000AC }, { 0x800000CC },
+    { 0x800000DE }, { 0x800000F4 }, { 0x8000010E }, { 0x8000012C }, { 0x80000150 }, { 0x8000016C }, { 0x80000182 }, { 0x8000019A },
+    { 0x000001B8 }, { 0x000001DC }, { 0x80000204 }, { 0x80000226 }, { 0x80000232 }, { 0x8000024A }, { 0x80000268 }, { 0x80000272 },
+    { 0x80000296 }, { 0x800002AC }, { 0x000002C2 }, { 0x000002D8 }, { 0x800002EC }, { 0x800002F8 }, { 0x80000312 }, { 0x80000328 },
+    { 0x0000033E }, { 0x80000346 }, { 0x8000035A }, { 0x80000368 }, { 0x8000037A }, { 0x800003A6 }, { 0x800003C8 }, { 0x000003EE },
+    { 0x800003FC }, { 0x8000041A }, { 0x00000438 }, { 0x80000456 }, { 0x80000464 }, { 0x80000474 }, { 0x8000047E }, { 0x80000488 },
+    { 0x800004A6 }, { 0x800004C8 }, { 0x000004DE }, { 0x80000507 }, { 0x80000529 }, { 0x8000054B }, { 0x80000567 }, { 0x80000589 },
+    { 0x800005A5 }, { 0x800005C3 }, { 0x800005E5 }, { 0x800005F1 }, { 0x00000603 }, { 0x80000625 }, { 0x00000631 }, { 0x80000653 },
+    { 0x80000671 }, { 0x80000691 }, { 0x800006AD }, { 0x800006CB }, { 0x800006E9 }, { 0x80000703 }, { 0x80000725 }, { 0x80000741 },
+    { 0x80000761 }, { 0x8000076F }, { 0x8000077D }, { 0x80000791 }, { 0x800007B3 }, { 0x800007C7 }, { 0x800007DD }, { 0x800007FB },
+    { 0x80000811 }, { 0x8000082B }, { 0x8000084F }, { 0x80000871 }, { 0x80000897 }, { 0x800008A7 }, { 0x800008B7 }, { 0x800008CF },
+    { 0x800008E3 }, { 0x800008FD }, { 0x00000913 }, { 0x8000093D }, { 0x8000094B }, { 0x80000969 }, { 0x00000977 }, { 0x8000098E },
+    { 0x80000998 }, { 0x800009A8 }, { 0x800009C6 }, { 0x800009E4 }, { 0x800009FE }, { 0x80000A1A }, { 0x80000A36 }, { 0x80000A50 },
+    { 0x80000A70 }, { 0x80000A88 }, { 0x80000A98 }, { 0x80000AAE }, { 0x80000AD2 }, { 0x80000AE0 }, { 0x80000AF2 }, { 0x80000B02 },
+    { 0x80000B18 }, { 0x80000B32 }, { 0x80000B4C }, { 0x00000B62 }, { 0x80000B83 }, { 0x80000B9F }, { 0x80000BAF }, { 0x80000BC5 },
+    { 0x80000BD9 }, { 0x80000BF7 }, { 0x80000C13 }, { 0x80000C33 }, { 0x80000C51 }, { 0x80000C5D }, { 0x00000C7B }, { 0x80000C8D },
+    { 0x80000CA7 }, { 0x80000CC3 }, { 0x80000CD1 }, { 0x80000CEB }, { 0x80000D03 }, { 0x80000D17 }, { 0x80000D2F }, { 0x80000D47 },
+    { 0x80000D5F }, { 0x80000D79 }, { 0x80000D8F }, { 0x80000DA9 }, { 0x80000DB9 }, { 0x80000DCD }, { 0x80000DE1 }, { 0x80000DF7 },
+    { 0x80000E0F }, { 0x80000E2B }, { 0x80000E3F }, { 0x80000E53 }, { 0x80000E67 }, { 0x80000E77 }, { 0x80000E8B }, { 0x80000E9D },
+    { 0x80000EAF }, { 0x80000EC3 }, { 0x80000ED3 }, { 0x80000EE1 }, { 0x80000EF7 }, { 0x80000F0F }, { 0x80000F25 }, { 0x80000F3D },
+    { 0x80000F53 }, { 0x80000F6B }, { 0x80000F7F }, { 0x80000F93 }, { 0x80000FA5 }, { 0x80000FB5 }, { 0x80000FCF }, { 0x80000FDF },
+    { 0x80000FEF }, { 0x8000100D }, { 0x80001019 }, { 0x80001025 }, { 0x80001045 }, { 0x80001063 }, { 0x80001077 }, { 0x80001091 },
+    { 0x800010AB }, { 0x800010D3 }, { 0x800010FB }, { 0x80001123 }, { 0x8000112D }, { 0x8000113B }, { 0x8000114D }, { 0x8000115B },
+    { 0x80001167 }, { 0x80001177 }, { 0x80001189 }, { 0x80001193 }, { 0x800011A3 }, { 0x800011B3 }, { 0x800011BF }, { 0x800011CF },
+    { 0x800011DB }, { 0x800011E7 }, { 0x800011F3 }, { 0x800011FF }, { 0x8000120D }, { 0x80001217 }, { 0x80001225 }, { 0x80001237 },
+    { 0x80001245 }, { 0x80001255 }, { 0x80001265 }, { 0x80001273 }, { 0x80001281 }, { 0x80001293 }, { 0x8000129F }, { 0x800012AF },
+    { 0x800012BD }, { 0x800012C9 }, { 0x800012D7 }, { 0x800012E3 }, { 0x800012EF }, { 0x800012FF }, { 0x8000130F }, { 0x8000131B },
+    { 0x80001329 }, { 0x8000133B }, { 0x80001347 }, { 0x80001353 }, { 0x8000135D }, { 0x80001367 }, { 0x80001371 }, { 0x8000137B },
+    { 0x80001385 }, { 0x80001397 }, { 0x800013BB }, { 0x800013C9 }, { 0x000013D5 }, { 0x800013FB }, { 0x80001409 }, { 0x80001419 },
+    { 0x80001427 }, { 0x8000143D }, { 0x80001453 }, { 0x80001465 }, { 0x8000147B }, { 0x80001489 }, { 0x800014A1 }, { 0x800014B7 },
+    { 0x800014C3 }, { 0x800014D1 }, { 0x000014E1 }, { 0x00001505 }, { 0x80001529 }, { 0x80001539 }, { 0x80001549 }, { 0x80001557 },
+    { 0x80001567 }, { 0x80001579 }, { 0x80001583 }, { 0x8000158D }, { 0x800015A1 }, { 0x800015B1 }, { 0x800015C5 }, { 0x0000033E },
+};
+
+const font_face_t FontAscii_16x32 = {
+    "FontAscii_16x32", 16, 32, 2, 256,
+    FontAscii_16x32_rows, NULL, 0, FontAscii_16x32_meta
+};
+
@@ -0,0 +1,318 @@
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+// Generated by tools/fontc. Do not edit. (make fonts)
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+#include <stddef.h>
+#include "../../lib_fb.h"
+#include "../../lib_font.h"
+
+// FontHangul_Hanboot : 360 glyphs, 11520 -> 4066 bytes (+ 1440 bytes meta)
+static const unsigned char FontHangul_Hanboot_rows[4066] = {
+      0,  0,  0,  0,  0,170,170,  0, 30,  3,  1,  3,  6, 12, 16, 96,
+      0,170,170,  0, 30,115, 27, 27, 50,100,136, 16,  0,170,250,  0,
+     96,176, 48, 48, 48, 64, 48,128, 63, 24,  2,170,190,  0,  2,127,
+      4, 48, 96, 96, 64, 64,127,128, 60,  2,202,190,  0, 68,127,128,
+     18, 54,108,108, 64, 63,128, 27,  0,170,186,  0, 62,  3,  4,126,
+     24, 48,128, 63, 28,  2,234,249,  0, 71, 41,128, 51, 50, 49, 49,
+    128, 51,128, 47,128,  2,170,170,  0,  6, 99, 51, 51, 51, 55, 59,
+     55, 34,  0,191,254,  0,219,109,128,109,128,111,128,125,128,109,
+    128,127,128, 73,  2,170,186,128,  4,  6,  6,  6, 14, 15, 25,128,
+     51, 69,134,  0,170,191,128, 18, 27, 27, 27, 63,109,128, 25,128,
+     34,128,  3, 10,170,168,  0, 24,  8, 24, 50, 99, 99, 99, 54, 28,
+      0,250,190,  0, 63,128, 17,128,  3,  6, 15, 25,128, 50,128,195,
+      0,254,190,  0,127,128, 45,128, 13,128, 27, 63,109,128,216,128,
+     33, 10, 42,170,  0, 12,  6, 63, 19,  6, 12, 31, 49,195,  0,170,
+    170,128, 60,  6,  2,126,  4,  8, 16, 32,192,  2,170,186,  0, 98,
+     63,  4, 16, 39,120, 96,128, 63, 24,  2,138,186,  0, 96, 31,102,
+     46, 50, 37,128,126, 32, 10,186,168,  0,  6,  3,  4,127,128,  6,
+     28, 51, 51, 30, 15,213, 80,  0,  3,192, 15,224, 16, 48, 48, 48,
+     32, 32, 64, 10,166,128,  0, 14,112, 31,248, 35, 24,  3, 24,  2,
+     16,  4, 32, 10,175, 80,  0,  4, 14,  6,  4, 12,  8, 15,248, 32,
+     64, 15,175, 64,  0, 12, 32,  7,240,  2,  8, 24, 24, 15,224, 64,
+      7,239,  0,  0, 16, 63,248,  8,128, 17, 25,136, 14,240, 15,123,
+    192,  0,  1,224, 14, 32, 64, 31,240,  7, 12, 16,  7,224, 11,255,
+    192,  0, 16, 11,240, 12, 48, 12, 96, 14, 48, 13,240,  8, 64,  7,
+    255,192,  0, 96, 24, 48, 12, 48, 13,240, 14, 48, 13,240,  4, 32,
+      3,255,192,  0, 51, 48, 25,152, 27,184, 29,216, 31,248, 17, 16,
+     11,239,192,  0,  1,  1,128,  1,128,  3,  7,240, 12, 56,112, 32,
+     10,106,128,  0,  2, 64,  3, 96,  6,192, 15,240, 27, 48, 36, 32,
+     42,150,  0,  0,  3,  0,  1,  0,  7, 64, 12, 96,  7,192,  3,255,
+    208,  0, 15,224, 17,192,  3,128,  6,224, 12, 48, 48, 48, 64,  3,
+    255,192,  0, 15,240, 19, 96,  6,192, 15,224, 27, 48,100, 32, 55,
+    255,192,  0,  3,128,192,  7,240,  8,240,  1,192,  3,112, 12, 16,
+     48, 32,  3,221, 80,  0,  1,224, 30, 48,240, 31, 48, 32, 32, 64,
+     15,187,192,  0, 24, 32,  7,240,  2, 15,224, 28, 24, 16, 15,224,
+     11,255,160,  0, 24,  7,248,  8,224,  7, 96,  6,128,  2,248, 31,
+      8, 10,169,128,  0,  3,  0, 17,128, 15,240,  3,128,  6, 96,  3,
+    192, 63, 84,  0,  0,  1,224,  6, 48,  8, 48, 48, 32, 64, 63,252,
+      0,  0,  6, 48, 15,120, 19,152,  3, 24,  2, 16,  4, 32, 42,240,
+      0,  0,  8, 28,  4, 12, 48, 15,192, 62,240,  0,  0, 12, 32,  3,
+    240,  4, 12, 48,  7,192, 15,240,  0,  0, 63,240,  8,128, 25,136,
+     14,240, 13,236,  0,  0, 15,240, 32, 31,248,  4, 15,240, 15,248,
+      0,  0, 27,240, 12, 48, 12, 96, 13,240,  8, 31,252,  0,  0,192,
+     24, 96, 12, 96, 13,224, 14, 96, 15,192, 15,252,  0,  0, 27, 96,
+     13,176, 15,240, 13,176,  7,224, 41,168,  0,  0,  1,  0,  1,128,
+      3,224,  6, 48, 56, 32, 41,168,  0,  0,  4, 64,  6, 96, 15,240,
+     25,152, 98, 16, 42, 88,  0,  0,  1,  0,  3, 64,  6, 96,  3,192,
+     15,252,  0,  0, 15,224,  3,192,  7, 96, 12, 48,112, 32, 15,252,
+      0,  0, 31,248,  6, 96, 15,240, 25,152, 98, 16, 47,252,  0,  0,
+      3,  1,128, 31,240,  1,192, 15,112,120, 32, 31,125,  0,  0,224,
+     15, 48,  4, 48,240, 15, 48,  4, 32, 64, 46,252,  0,  0, 12,  3,
+    240,  4, 15,192, 12, 24,  7,224, 63,248,  0,  0, 30, 16,  1,248,
+      6, 96,  6, 64,  3,248, 30, 47,252,  0,  0,  3,  1,160, 15,240,
+      3, 64,  6, 96,  3,192,  2,255,160,  0,  7, 31,128, 33,128,  1,
+    128,  1,128,  1,  2,  2,254,128,  0, 17, 59,128, 93,128, 25,128,
+     17, 34,  0,174,  0,  0, 96, 48, 49,128, 30,  2,239,  0,  0, 49,
+     15,128, 16, 48, 64, 31,128,  0,235,  0,  0,255,128, 34,110,119,
+    128,  0,238,192,  0, 63,128,  1,127,128, 16, 63,128,  0,251,128,
+      0,111,128, 49,128, 49, 55,128, 32,  2,254,128,  0, 99, 49,128,
+     55,128, 57,128, 63, 32,  2,254,  0,  0,219,109,128,127,128,109,
+    128, 63, 10,175,128,  0,  4,  6,  6, 12, 31,128, 49,128, 66,  2,
+    175,128,  0, 18, 27, 27, 63,128,109,128,146,  2,190,  0,  0,  4,
+     29, 49,128, 49,128, 31,  0,175,128,  0, 63, 12, 31,128, 49,128,
+     66,  0,239,128,  0, 63,128, 27, 63,128, 77,128, 18,  2,171,224,
+      0, 12,  4, 63, 14, 27,128, 49,128, 66,  2,255,160,  0,  3, 31,
+    128, 33,128, 15,128, 49,128,  1,  2,  2,235,192,  0,112, 15,128,
+     16, 63, 48, 64, 31,128,  2,170,160,  0,114, 15, 36, 54, 20, 15,
+    112,  2,186,128,  0, 28, 12,127,128, 30, 51, 30, 11,250,  0,  0,
+      3, 15,128, 49,128,  1,128,  1,  2, 11,250,  0,  0, 17, 59,128,
+     93,128, 25,128, 17, 34,  2,184,  0,  0, 48, 24, 24,128, 15, 11,
+    188,  0,  0, 24,  7,128,  8, 24, 64, 15,128,  3,188,  0,  0,127,
+    128, 18, 54, 64, 27,128, 14,236,  0,  0, 31,128,  1, 63,128,  8,
+     31,128,  3,238,  0,  0, 55,128, 25,128, 25, 27,128, 16, 11,250,
+      0,  0, 51, 25,128, 27,128, 29,128, 31, 16, 11,248,  0,  0,219,
+    109,128,127,128,109,128, 63, 10,174,  0,  0, 12, 12, 12, 31, 51,
+    128, 66, 10,190,  0,  0, 18, 27, 27, 31,128, 45,128, 73, 10,168,
+      0,  0,  8, 26, 51, 51, 30, 10,190,  0,  0, 31,  3,  6, 15,128,
+     25,128, 34, 15,190,  0,  0, 63,128, 13,128, 27, 63,192,108,192,
+      1, 43,174,  0,  0, 12,  6, 63,128,  6, 15, 25,128, 98, 11,254,
+    128,  0,  3, 31,128, 33,128, 15,128, 49,128,  1,  2, 11,175,  0,
+      0, 24,  7,128,  8, 31, 24, 64, 15,128, 11,171,128,  0, 48, 15,
+    128,  2, 27, 10,  7,128, 56, 10,234,  0,  0, 12,  6, 63,128, 14,
+     27, 14, 10,170,128,  0, 30, 35,  3,  6, 12, 24, 32, 11,234,128,
+      0, 27, 63,128, 13,128, 27, 54, 76, 16,  2,175,128,  0, 56,  8,
+     24, 48, 64, 63,128, 30, 10,175,128,  0, 48, 15, 16, 48, 48, 64,
+     48,128, 31,  3,174,  0,  0,127,128, 18, 54, 63,128, 27,  2,171,
+    128,  0, 63,  2,127, 48, 97,128, 62,  2,170,128,  0,103, 59, 50,
+     51, 55, 32, 10,170,128,  0,  6, 99, 51, 55, 59, 63, 32, 10,170,
+    160,  0,  4,  6,  6, 12, 30, 51, 69,  2, 10,171,128,  0,  2, 19,
+     27, 27, 63, 77,128, 17, 42,170,  0,  0, 24,  8, 26, 51, 51, 51,
+     30,  2,170,160,  0, 63,  6, 12, 30, 51, 69,  2,  3,235,128,  0,
+     63,128,  9,128, 27, 63, 77,128, 17, 10,170,128,  0, 24, 12, 62,
+     12, 30, 51, 66, 10,170,160,  0, 30, 63,  3,126, 12, 24, 48, 64,
+     10,171,128,  0, 48, 15, 16, 62, 48, 49,128, 30, 10,174,128,  0,
+    112, 15, 36, 54, 21,128, 14,112, 10,170,128,  0, 24, 12,127, 24,
+     54, 54, 28, 63, 84,  0,  0,  1,192,  3,240, 12, 48, 48, 32, 64,
+     15,240,  0,  0, 28,112, 38,152,  4, 16,  8, 32, 10,240,  0,  0,
+     12,  6,  6, 16,  3,224, 46,240,  0,  0, 12,  3,224,  4, 12, 16,
+      7,224, 15,240,  0,  0, 31,240,  4,128, 13,144,  6,224, 13,236,
+      0,  0,  7,240, 32, 15,240,  2,  7,240, 15,248,  0,  0, 12,240,
+      6, 48,  6, 32,  6,240,  4, 15,252,  0,  0, 12, 96,  6, 48,  6,
+    240,  7, 48,  3,224, 47,244,  0,  0,  1,  1,128,  3,128,  7,240,
+     28, 56, 64, 41,170,  0,  0,  4, 64,  6, 96, 12,192, 31,248, 51,
+     24,  0, 32, 42, 96,  0,  0,  1,  0,  3, 64,  6, 96,  3,192, 15,
+    244,  0,  0, 15,224,  1,192,  3,240, 30, 56, 64, 15,253,  0,  0,
+     31,240,  6, 96, 12,192, 31,248, 99, 24, 32, 47,253,  0,  0,  3,
+      1,128, 31,240,  3,192, 14,120, 56, 24, 32, 31,245,  0,  0,224,
+      7,240, 24, 48,  3,240, 28, 48, 32, 64, 46,252,  0,  0,  6,  1,
+    224,  2,  7,192,  6, 16,  3,224, 47,248,  0,  0, 14,  1,240,  6,
+     96,  2,192,  1,240, 14, 47,252,  0,  0,  3,  1,128, 15,240,  3,
+     64,  6, 96,  3,192, 31, 84,  0,  0,224, 15,240,  4, 48, 48, 32,
+     64, 63,240,  0,  0, 12, 48, 30,120, 38,152,  4, 16,  8, 32, 10,
+    240,  0,  0, 12,  6,  6,  8,  3,240, 15,240,  0,  0, 31,240,  4,
+    128, 13,136,  6,240, 55,176,  0,  0, 15,224, 64, 15,224, 12,  7,
+    224, 15,248,  0,  0, 12,240,  7, 48,  6, 32,  6,240,  4, 63,240,
+      0,  0, 12, 96,  6, 48,  6,240,  7, 48,  3,224, 63,240,  0,  0,
+     27, 96, 13,176, 15,240, 13,176,  7,224, 15,253,  0,  0, 31,240,
+      6, 96, 12,192, 31,248, 35, 24, 32, 15,245,  0,  0,  3,240, 12,
+     48,  3,240, 28, 48, 32, 64, 41, 85, 86,168,  0, 48,  0, 24,  0,
+     27,  0, 30,  0, 28,  0, 24, 21, 85, 85, 84, 12,  6,102, 54, 54,
+     54, 54, 54, 62, 54, 38,  6,  6,  4, 21, 85, 85, 84, 16, 56, 24,
+     24, 24, 31, 25, 26, 28, 31, 24, 24, 24, 16, 21, 85, 85, 84, 12,
+     38,118, 54, 54, 62, 54, 54, 62, 54, 38,  6,  6,  4,  1, 85, 85,
+     84, 24, 60, 44, 76, 12, 12, 12, 12, 12, 12, 12,  8, 21, 93, 85,
+     84,  4, 14, 46,118,182,  1, 54, 54, 54, 54, 54, 54, 54, 38,  4,
+     21, 85, 85, 84,  8, 12, 12, 12,108,172, 92,236, 12, 12, 12, 12,
+     12,  8, 21, 85, 85, 84, 12,  6,102, 54, 54,246, 54, 54,246, 54,
+     54, 54, 38,  4,  0,  0,170,240,  4, 12, 12, 24, 24, 12, 15,254,
+     21, 85,255,212, 48, 24, 24, 24, 24, 24, 26, 24, 31, 12, 56, 24,
+    216,127, 24, 48, 24, 24, 16, 21, 85,255,212, 12,102, 54, 54, 54,
+     54, 54, 24, 62, 12,118, 25,182,126, 54, 48, 54, 38,  4, 41, 85,
+    170,168,  0, 24,  0, 12, 24, 12, 12, 44, 24,204,127, 12, 48, 12,
+      0, 12,  0,  8,  0,  0,127,224, 64, 14,224,  6, 96,  2,204,127,
+    254, 32,  0,  0,169, 88,127,224, 32,112,  0, 48,  0, 32, 21, 85,
+    127,244, 24, 12, 12, 12, 12, 12, 28,108,127,140, 54,252, 12, 76,
+     12, 12, 24, 12,  8, 21, 85,255,244, 12,102, 54, 54, 54, 54,118,
+      1,182,126, 54, 45,246, 24,182, 24, 54, 48, 38,  4, 41, 86,170,
+    104,  0, 24,  0, 12,  0, 28,  0,108,127,140, 54, 12, 12, 12, 24,
+     12,  0,  8,  0,  0,255,244,127,240, 35,176,  7, 48, 14, 48, 28,
+     48, 56, 48, 32,  0,  0,  1,224, 12,127,254, 32, 21, 85, 87,212,
+     24, 12, 12, 12, 12, 12, 12, 12, 44,204,127, 12, 48, 12, 12,  8,
+     41, 85, 85, 88,  0, 24,  0, 12,  0,  8, 21, 85, 85, 84, 12,102,
+     54, 54, 54, 54, 54, 54, 62, 54, 38,  6,  6,  4, 21, 85, 85, 84,
+     48, 24, 24, 24, 24, 31, 25, 26, 28, 31, 24, 24, 24, 16, 21, 85,
+     85, 84, 12,102, 54, 54, 54, 62, 54, 54, 62, 54, 38,  6,  6,  4,
+      0, 85, 85, 84, 24, 60,108,140, 12, 12, 12, 12, 12, 12,  8, 21,
+     87, 85, 84,  2,  6,  6, 38,118,246,  1,182, 54, 54, 54, 54, 38,
+      6,  4, 21, 85, 85, 84, 24, 12, 12, 12,108,172, 92,236, 12, 12,
+     12, 12, 12,  8, 21, 93,213, 84, 12,  6,102, 54,246,  1,118,182,
+      1,246, 54, 54, 54, 38,  6,  4,  0,  0, 23,224, 64,192,  3,140,
+    127,254, 32, 21, 85,255,212, 48, 24, 24, 24, 24, 24, 26, 12, 31,
+      6, 56, 12,216,127, 24, 48, 24, 24, 16, 21, 85,255,212, 12,102,
+     54, 54, 54, 54, 54, 12, 62,  6,118, 13,182,126, 54, 48, 54, 38,
+      4, 41, 85,170,168,  0, 24,  0, 12, 12, 12,  6, 44, 12,204,127,
+     12, 48, 12,  0, 12,  0,  8,  0,  0,255,244,127,224, 35,176,  7,
+     48, 14, 48, 28, 48, 56, 48, 32, 21, 85, 64,  0, 48, 24, 24, 24,
+     27, 28, 24, 16, 21, 85, 64,  0, 12,102, 54, 54, 62, 54, 38,  4,
+     21, 85, 64,  0, 48, 24, 24, 31, 26, 31, 24, 16, 21, 85, 64,  0,
+     12,102, 54, 62, 54, 62, 54, 36,  5, 85, 64,  0, 24, 44, 76, 12,
+     12, 12,  8, 21,117, 64,  0, 12,  6,102,182,  1, 54, 54, 54, 36,
+     21, 85, 64,  0, 24, 12, 12,124, 44,124, 12,  8, 21, 85, 64,  0,
+     12,102, 54,246, 54,246, 54, 36,  0, 55,192,  0,  1,128,128, 33,
+      4,127,254, 21,127,240,  0, 48, 24, 24, 26, 24, 31, 12, 24,  8,
+    216,127, 24, 48, 16, 21,127,244,  0, 12,102, 54, 54, 24, 62, 12,
+     54,  8,246,127, 54, 48, 38,  4, 21,127,244,  0, 24, 12, 12, 12,
+     24, 12, 12, 12,  8,204,127, 12, 48, 12,  8,  0, 63,224,  0,  1,
+    128, 12,128,  5,  4,127,254, 32,  0,  3,212,  0,127,240, 32, 48,
+     48, 32, 21, 95,240,  0, 24, 12, 12, 12, 76,127,140, 44,124, 24,
+     12, 48,  8, 21, 95,240,  0, 12,102, 54, 54,182,127, 54, 54,246,
+     12, 54, 24, 36, 21, 95,240,  0, 24, 12, 12, 12,108,127,140, 54,
+     12, 12, 12, 24,  8,  0,  3,252,  0,127,240, 35, 48,  6, 48,  4,
+     32,  0,  7,128,  0,  4,127,254, 32, 21, 87,240,  0, 24, 12, 12,
+     12, 12,108,  1,140,126, 12, 48,  8, 41, 85,128,  0,  0, 24,  0,
+     12,  0,  8,  0, 11,224,  0,  1,  3,  4,127,254, 32, 21,127,240,
+      0, 48, 24, 24, 26, 12, 31,  6, 24, 12,120,127,152, 48, 16, 21,
+    127,240,  0, 12,102, 54, 54, 12, 62,  6, 54, 12,246,127, 38, 48,
+      4, 21,127,240,  0, 24, 12, 12, 12, 12, 12,  6, 12, 12,108,127,
+    140, 48,  8,  0, 31,224,  0,192,  6, 64,  2,132,127,254, 32, 21,
+     87,248,  0, 24, 12, 12, 12, 12,108,127,140, 54, 60, 12,  8,  8,
+     21, 87,248,  0, 12,102, 54, 54, 54,182,127, 54, 54,246, 12, 36,
+      8, 21, 87,248,  0, 24, 12, 12, 12, 12,108,127,140, 54, 12, 12,
+      8,  8,  0,  3,252,  0,127,240, 33,176,  3, 48,  2, 32,  0,  1,
+    224,  0,  4,127,254, 32, 21, 85,240,  0, 24, 12, 12, 12, 12, 44,
+    204,127, 12, 48,  8,  0,  0, 15, 84,  1,240,  6, 24, 24, 24, 16,
+      0,  0, 10,152, 14,112, 19,152,  3, 24,  2, 16,  0,  0, 15,252,
+     14, 48, 19, 16,  3, 56,  3,108,  2,204,  0,  0, 22,175, 16, 64,
+      3,  6,  6,  3,248,  1,224,  0,  0, 10,104, 24,124, 12, 24, 12,
+    188,  7,102,  0,  0, 31,252, 48, 24, 24, 12,124, 12, 56, 12,108,
+      7,184,  0,  0, 14,188, 15,240,  2,  6,  6, 16,  3,248,  0,  0,
+     13,236,  7,248, 16,  7,248,  6,  3,248,  0,  0, 15,252, 15,252,
+      1,140, 15,140, 12, 12,  7,200,  0,  0, 15,252, 15,252,  1,236,
+     15,108, 12,108,  7,252,  0,  0, 15,252, 15,204,  1,236, 15,124,
+     12,108,  7,252,  0,  0, 15,252, 15,152,  1,152, 15,152, 12, 60,
+      7,230,  0,  0, 15,252, 15,252,  1,224, 15,120, 12, 96,  7,188,
+      0,  0, 15,252, 15,252,  1,168, 15, 40, 12, 40,  7,252,  0,  0,
+     31,252, 48, 15,152,  1,252, 15, 56, 12,108,  7,184,  0,  0, 15,
+    252,  6,120,  3,152,  3, 16,  3, 24,  2,120,  0,  0, 31,252, 48,
+      6, 24,  3, 24,  3,120,  3,152,  3,240,  0,  0, 15,252,  9,152,
+     13,152, 15,152, 13,190, 15,230,  0,  0, 21,254,128,192,192,  1,
+    224,  3, 56,  6, 24,  8,  0,  0, 41,168,  2, 32,  3, 48,  7,240,
+     12,220, 25,140,  0,  0, 42, 88,  0, 64,  1,176,  3, 24,  1,240,
+      0,  0, 13,254,  7,240,192,  1,224,  3, 56,  6, 24,  8,  0,  0,
+     55,254,  1,128,192,  7,240,  1,224,  3, 56,  6, 24,  8,  0,  0,
+     13,244,  7,248, 24,  7,248,  2, 24, 16,  0,  0, 14,236,  7,248,
+      1,  3,240,  3,  1,248,  0,  0, 15,252,  7,248,  3,112,  1,176,
+      9, 32,  7,252,  0,  0, 55,252,  1,128,192,  7,248,  1,224,  3,
+     48,  1,224,  0,  0, 15, 84,  1,248,  6, 12, 12, 12,  8,  0,  0,
+     10,152,  7, 56,  9,204,  1,140,  1,  8,  0,  0, 15,252,  7, 24,
+      9,136,  1,156,  1,182,  1,102,  0,  0, 21,245,  8, 32,128,  1,
+    128,  1,128,254,120,  0,  0, 10,104, 12, 62,  6, 12,  6, 94,  3,
+    179,  0,  0, 31,252, 24, 12, 12,  6, 62,  6, 28,  6, 54,  3,220,
+      0,  0, 14,188,  7,248,  1,  3,  3,  8,  1,252,  0,  0, 13,236,
+      3,252,  8,  3,248,  3,  1,252,  0,  0, 13,252,  7,254,198,  7,
+    198,  6,  6,  3,228,  0,  0, 13,252,  7,254,246,  7,182,  6, 54,
+      3,254,  0,  0, 13,252,  7,230,246,  7,190,  6, 54,  3,254,  0,
+      0, 13,252,  7,204,204,  7,204,  6, 30,  3,243,  0,  0, 13,252,
+      7,254,240,  7,188,  6, 48,  3,222,  0,  0, 13,252,  7,254,212,
+      7,148,  6, 20,  3,254,  0,  0, 29,252, 24,  7,204,254,  7,156,
+      6, 54,  3,220,  0,  0, 15,252,  3, 60,  1,204,  1,136,  1,140,
+      1, 60,  0,  0, 31,244, 12,  3, 12,  1,140,  1,188,  1,204,248,
+      0,  0, 15,252,  4,204,  6,204,  7,204,  6,223,  3,243,  0,  0,
+     21,126, 64, 96, 96,240,  1,156,  3, 12,  4,  0,  0, 41,168,  1,
+     16,  1,152,  3,248,  6,110, 12,198,  0,  0, 42, 88,  0, 32,  0,
+    216,  1,140,  0,248,  0,  0, 13,126,  3,248, 96,240,  1,156,  3,
+     12,  4,  0,  0, 23,126,192, 96,  3,248,224,  1,188,  3, 12,  4,
+      0,  0, 13,244,  3,252, 12,  3,252,  1, 12,  8,  0,  0, 15,244,
+      3,252,  1,128,  1,252,  1,128,252,  0,  0, 15, 92,  3,252,  1,
+    152,216,144,  3,254,  0,  0, 23,116,192, 96,  3,252,240,  1,152,
+    240,  0,  0, 15, 84,  3,156,  4,230,198,198,132,  0,  0, 15, 84,
+      3,140,  4,196,206,219,179,  0,  0, 13,244,  3,252,128,  1,128,
+      1,132,254,  0,  0, 13,236,  3,252, 12,  3,248,  3,  1,252,  0,
+      0, 15,252,  3, 60,  1,204,  1,136,  1,140,  1,124,  0,  0, 21,
+     94, 32, 48, 48,120,206,  1,134,  2,  0,  0, 13, 94,  1,252, 48,
+    120,206,  1,134,  2,  0,  0, 23, 94, 96, 48,  1,252,112,222,  1,
+    134,  2,  0,  0, 13,244,  3,254,128,  1,252,  1,128,254,  0,  0,
+     15, 92,  3,252,  1,184,216,144,  3,254,  0,  0, 23, 84, 96, 48,
+      1,254,120,204,120,  0,  0, 15, 84,  3,224, 12, 48, 48, 48, 32,
+      0,  0, 22,188, 32,128,  2,  6,  6, 16,  3,248,  0,  0, 10,104,
+     24,248, 12, 48, 13,120,  6,204,  0,  0, 31,252, 96, 24, 48, 12,
+    248, 12,112, 13,216,  7,112,  0,  0, 13,252, 15,240, 48, 15,224,
+     12, 16,  7,248,  0,  0, 15,252, 15,248,  1,152, 15, 24, 12, 24,
+      7,144,  0,  0, 15,252, 31,248,  3,216, 30,216, 24,216, 15,248,
+      0,  0, 15,252, 31,152,  3,216, 30,248, 24,216, 15,248,  0,  0,
+     15,252, 31, 48,  3, 48, 31, 48, 24,120, 15,204,  0,  0, 15,252,
+     31,124,  3, 96, 30,120, 24, 96, 15, 60,  0,  0, 15,252, 31,248,
+      3, 80, 30, 80, 24, 80, 15,248,  0,  0, 15,252, 12,240,  7, 48,
+      6, 32,  6, 48,  4,240,  0,  0, 31,252, 32, 12, 48,  6, 48,  6,
+    240,  7, 48,  3,224,  0,  0, 15,252, 19, 48, 27, 48, 31, 48, 27,
+    124, 15,204,  0,  0, 47,254,  1,  1,128,  1,128,  3,192,  6,112,
+     12, 48, 16,  0,  0, 41,168,  4, 64,  6, 96, 15,224, 25,184, 51,
+     24,  0,  0, 42, 88,  0,128,  3, 96,  6, 48,  3,224,  0,  0, 55,
+    254,  1,128,192,  7,240,  1,192,  3,120,  6, 24,  8,  0,  0, 13,
+    244, 15,248, 24, 15,248,  4, 24, 16,  0,  0, 14,236, 15,248,  2,
+      7,240,  6,  3,248,  0,  0, 15,252, 15,240,  6,224,  3, 96,  2,
+     64, 15,248,  0,  0, 47,252,  3,  1,128, 15,240,  3,192,  6, 96,
+      3,192,
+};
+
+// offset
+static const font_prow_t FontHangul_Hanboot_meta[360] = {
+    { 0x00000000 }, { 0x00000004 }, { 0x00000010 }, { 0x0000001C }, { 0x0000002A }, { 0x00000039 }, { 0x00000048 }, { 0x00000055 },
+    { 0x00000065 }, { 0x00000072 }, { 0x00000084 }, { 0x00000093 }, { 0x000000A3 }, { 0x000000B0 }, { 0x000000C0 }, { 0x000000D1 },
+    { 0x000000DE }, { 0x000000EB }, { 0x000000F9 }, { 0x00000106 }, { 0x00000000 }, { 0x00000114 }, { 0x80000123 }, { 0x00000133 },
+    { 0x00000141 }, { 0x00000150 }, { 0x0000015E }, { 0x0000016E }, { 0x0000017F }, { 0x00000190 }, { 0x000001A0 }, { 0x800001B0 },
+    { 0x800001C0 }, { 0x000001CE }, { 0x000001DF }, { 0x000001EF }, { 0x00000202 }, { 0x00000210 }, { 0x00000220 }, { 0x80000231 },
+    { 0x00000000 }, { 0x00000241 }, { 0x0000024E }, { 0x0000025E }, { 0x00000269 }, { 0x00000276 }, { 0x00000282 }, { 0x0000028E },
+    { 0x0000029B }, { 0x000002AA }, { 0x800002B8 }, { 0x800002C6 }, { 0x800002D4 }, { 0x000002E0 }, { 0x000002EE }, { 0x000002FC },
+    { 0x0000030B }, { 0x0000031A }, { 0x00000328 }, { 0x00000337 }, { 0x00000000 }, { 0x00000346 }, { 0x00000355 }, { 0x00000362 },
+    { 0x0000036B }, { 0x00000377 }, { 0x00000381 }, { 0x0000038D }, { 0x00000399 }, { 0x000003A6 }, { 0x000003B2 }, { 0x000003BF },
+    { 0x000003CB }, { 0x000003D6 }, { 0x000003E1 }, { 0x000003ED }, { 0x000003FA }, { 0x00000409 }, { 0x00000416 }, { 0x00000421 },
+    { 0x00000000 }, { 0x0000042C }, { 0x00000439 }, { 0x00000446 }, { 0x0000044F }, { 0x0000045B }, { 0x00000466 }, { 0x00000472 },
+    { 0x0000047E }, { 0x0000048B }, { 0x00000497 }, { 0x000004A2 }, { 0x000004AE }, { 0x000004B7 }, { 0x000004C3 }, { 0x000004D1 },
+    { 0x000004DE }, { 0x000004ED }, { 0x000004FA }, { 0x00000507 }, { 0x00000000 }, { 0x00000512 }, { 0x0000051D }, { 0x0000052A },
+    { 0x00000536 }, { 0x00000543 }, { 0x0000054E }, { 0x00000559 }, { 0x00000563 }, { 0x000003A6 }, { 0x0000056E }, { 0x0000057A },
+    { 0x00000586 }, { 0x00000591 }, { 0x0000059C }, { 0x000005A9 }, { 0x000005B4 }, { 0x000005C0 }, { 0x000005CC }, { 0x000005D8 },
+    { 0x00000000 }, { 0x000005E3 }, { 0x000005F0 }, { 0x000005FC }, { 0x00000606 }, { 0x00000612 }, { 0x0000061E }, { 0x0000062A },
+    { 0x00000637 }, { 0x000002AA }, { 0x00000645 }, { 0x80000653 }, { 0x80000663 }, { 0x0000066F }, { 0x0000067C }, { 0x0000068B },
+    { 0x0000069B }, { 0x000006AA }, { 0x000006B8 }, { 0x000006C6 }, { 0x00000000 }, { 0x000006D5 }, { 0x000006E1 }, { 0x000006EF },
+    { 0x00000606 }, { 0x000006F9 }, { 0x00000705 }, { 0x00000711 }, { 0x0000071E }, { 0x0000072C }, { 0x00000645 }, { 0x80000653 },
+    { 0x80000663 }, { 0x0000066F }, { 0x0000073A }, { 0x0000068B }, { 0x00000749 }, { 0x000006AA }, { 0x000006B8 }, { 0x000006C6 },
+    { 0x00000000 }, { 0x80000757 }, { 0x00000767 }, { 0x00000779 }, { 0x0000078B }, { 0x0000079D }, { 0x000007AD }, { 0x000007C0 },
+    { 0x000007D2 }, { 0x000007E4 }, { 0x000007F0 }, { 0x00000807 }, { 0x8000081E }, { 0x00000834 }, { 0x80000842 }, { 0x0000084E },
+    { 0x00000865 }, { 0x8000087D }, { 0x00000893 }, { 0x000008A4 }, { 0x000008AC }, { 0x800008C0 }, { 0x00000000 }, { 0x80000757 },
+    { 0x000008CA }, { 0x000008DC }, { 0x000008EE }, { 0x00000900 }, { 0x0000090F }, { 0x00000922 }, { 0x00000934 }, { 0x00000948 },
+    { 0x00000953 }, { 0x0000096A }, { 0x80000981 }, { 0x00000834 }, { 0x80000842 }, { 0x0000084E }, { 0x00000865 }, { 0x8000087D },
+    { 0x00000997 }, { 0x000008A4 }, { 0x000008AC }, { 0x800008C0 }, { 0x00000000 }, { 0x000009A8 }, { 0x000009B4 }, { 0x000009C0 },
+    { 0x000009CC }, { 0x000009D8 }, { 0x000009E3 }, { 0x000009F0 }, { 0x000009FC }, { 0x00000A08 }, { 0x00000A13 }, { 0x00000A25 },
+    { 0x00000A38 }, { 0x00000A4B }, { 0x00000A58 }, { 0x00000A62 }, { 0x00000A73 }, { 0x00000A84 }, { 0x00000A95 }, { 0x00000AA1 },
+    { 0x00000AA9 }, { 0x80000AB9 }, { 0x00000000 }, { 0x000009A8 }, { 0x000009B4 }, { 0x000009C0 }, { 0x000009CC }, { 0x000009D8 },
+    { 0x000009E3 }, { 0x000009F0 }, { 0x000009FC }, { 0x00000AC3 }, { 0x00000ACD }, { 0x00000ADF }, { 0x00000AF1 }, { 0x00000B03 },
+    { 0x00000A58 }, { 0x00000B0F }, { 0x00000B20 }, { 0x00000B31 }, { 0x00000B42 }, { 0x00000B4E }, { 0x00000B56 }, { 0x80000AB9 },
+    { 0x00000000 }, { 0x00000B65 }, { 0x80000B70 }, { 0x00000B7C }, { 0x00000B8A }, { 0x80000B97 }, { 0x00000BA3 }, { 0x00000BB2 },
+    { 0x00000BBE }, { 0x00000BCA }, { 0x00000BD8 }, { 0x00000BE6 }, { 0x00000BF4 }, { 0x00000C02 }, { 0x00000C10 }, { 0x00000C1E },
+    { 0x00000C2D }, { 0x00000C3B }, { 0x00000C4A }, { 0x00000C58 }, { 0x80000C66 }, { 0x80000C74 }, { 0x00000C80 }, { 0x00000C8E },
+    { 0x00000C9E }, { 0x00000CAA }, { 0x00000CB6 }, { 0x00000CC4 }, { 0x00000000 }, { 0x00000CD3 }, { 0x80000CDE }, { 0x00000CEA },
+    { 0x00000CF8 }, { 0x80000D05 }, { 0x00000D11 }, { 0x00000D20 }, { 0x00000D2C }, { 0x00000D38 }, { 0x00000D45 }, { 0x00000D52 },
+    { 0x00000D5F }, { 0x00000D6C }, { 0x00000D79 }, { 0x00000D86 }, { 0x00000D94 }, { 0x00000DA2 }, { 0x00000DB0 }, { 0x00000DBE },
+    { 0x80000DCB }, { 0x80000DD9 }, { 0x00000DE5 }, { 0x00000DF2 }, { 0x00000E00 }, { 0x00000E0C }, { 0x00000E19 }, { 0x00000E25 },
+    { 0x00000000 }, { 0x00000CD3 }, { 0x00000E31 }, { 0x00000E3C }, { 0x00000CF8 }, { 0x80000D05 }, { 0x00000D11 }, { 0x00000E47 },
+    { 0x00000E53 }, { 0x00000D38 }, { 0x00000D45 }, { 0x00000D52 }, { 0x00000D5F }, { 0x00000D6C }, { 0x00000D79 }, { 0x00000D86 },
+    { 0x00000E5F }, { 0x00000DA2 }, { 0x00000DB0 }, { 0x00000E6D }, { 0x80000DCB }, { 0x80000DD9 }, { 0x00000E79 }, { 0x00000E85 },
+    { 0x00000E00 }, { 0x00000E92 }, { 0x00000E9E }, { 0x00000EAA }, { 0x00000000 }, { 0x00000EB5 }, { 0x80000B70 }, { 0x00000B7C },
+    { 0x00000EC0 }, { 0x80000ECC }, { 0x00000ED8 }, { 0x00000BB2 }, { 0x00000EE7 }, { 0x00000EF4 }, { 0x00000F02 }, { 0x00000F10 },
+    { 0x00000F1E }, { 0x00000F2C }, { 0x00000F3A }, { 0x00000C1E }, { 0x00000F48 }, { 0x00000F56 }, { 0x00000F65 }, { 0x00000F73 },
+    { 0x80000F83 }, { 0x80000F91 }, { 0x00000C80 }, { 0x00000F9D }, { 0x00000FAD }, { 0x00000FB9 }, { 0x00000FC5 }, { 0x00000FD3 },
+};
+
+const font_hangul_t FontHangul_Hanboot = {
+    "FontHangul_Hanboot", FontHangul_Hanboot_meta, NULL, FontHangul_Hanboot_rows, NULL
+};
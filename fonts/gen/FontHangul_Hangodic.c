@@ -0,0 +1,285 @@
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+// Generated by tools/fontc. Do not edit. (make fonts)
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+#include <stddef.h>
+#include "../../lib_fb.h"
+#include "../../lib_font.h"
+
+// FontHangul_Hangodic : 360 glyphs, 11520 -> 3540 bytes (+ 1440 bytes meta)
+static const unsigned char FontHangul_Hangodic_rows[3540] = {
+      0,  0,  0,  0, 10,170,170,  0,126,  6,  6,  6, 12, 12, 24, 24,
+     48, 96, 10, 86, 89,  0,127,  0, 27,  0, 54,  0,108,  0,  9, 85,
+     86,  0, 96,  0,127,128, 10, 85, 86,  0,127,  0, 96,  0,127,128,
+     10, 85, 86,  0,127,128,108,  0,127,192, 10, 90, 86,  0,127,  0,
+      3,  0,127,  0, 96,  0,127,128, 10, 85, 86,  0,127,  0, 99,  0,
+    127,  0,  9, 90, 86,  0, 99,  0,127,  0, 99,  0,127,  0,  9, 90,
+     86,  0,109,128,127,128,109,128,127,128,  9, 89,153,  0, 12,  0,
+     30,  0, 51,  0, 97,128,  9, 86,101,  0, 54,  0,111,  0,217,128,
+     10,149, 90,  0, 30,  0, 51,  0, 97,128, 51,  0, 30,  0, 10, 89,
+    153,  0,127,128, 12,  0, 30,  0, 51,  0, 97,128, 10, 85,153,  0,
+    255,128, 54,  0,111,  0,217,128, 42,101,153,  0, 12,  0,127,128,
+     12,  0, 30,  0, 51,  0, 97,128, 10,170,170,  0,126,  6,  6,  6,
+    124, 12, 24, 24, 48, 96, 10, 90, 86,  0,127,  0, 96,  0,126,  0,
+     96,  0,127,128, 10, 85, 86,  0,127,  0, 54,  0,127,  0, 40,169,
+     90,  0, 12,  0,127,128, 30,  0, 51,  0, 97,128, 51,  0, 30,  0,
+     10, 85, 64,  0, 63,252,  0, 12, 10, 85, 64,  0, 62,124,  6, 12,
+      9, 85,128,  0, 48,  0, 63,252, 10, 85,128,  0, 63,252, 48,  0,
+     63,252, 10, 85,128,  0, 62,252, 48,192, 62,252, 13,122,192,  0,
+     63,252, 12, 12, 63,252, 48, 48, 63,252, 10, 85,128,  0, 63,252,
+     48, 12, 63,252,  9,105,128,  0, 48, 12, 63,252, 48, 12, 63,252,
+      9,105,128,  0, 49,140, 63,252, 49,140, 63,252,  9,170,  0,  0,
+      1,128,  3,192,  6, 96, 12, 48, 56, 28,  9, 90,128,  0,  6, 96,
+     15,240, 25,152, 51, 12, 10,150,128,  0, 15,240, 24, 24, 48, 12,
+     24, 24, 15,240, 10,106,128,  0, 63,252,  1,128,  3,192,  6, 96,
+     12, 48, 56, 28, 10, 90,128,  0, 63,252,  6, 96, 15,240, 25,152,
+     51, 12, 15,255,192,  0,  1,128, 63,252,  1,128,  3,192,  6, 96,
+     12, 48, 56, 28, 10,105, 64,  0, 63,252,  0, 12, 31,252,  0, 12,
+     14,186,192,  0, 63,252, 48, 48, 63,248, 48, 48, 63,252, 10, 85,
+    128,  0, 63,252, 12, 48, 63,252, 15,255,192,  0,  1,128, 63,252,
+     15,240, 24, 24, 48, 12, 24, 24, 15,240,  9, 88,  0,  0, 48,  0,
+     63,252, 10, 88,  0,  0, 63,252, 48,  0, 63,252, 10, 88,  0,  0,
+     62,252, 48,192, 62,252, 13,236,  0,  0, 63,252, 12, 63,252, 48,
+     63,252, 10, 88,  0,  0, 63,252, 48, 12, 63,252,  9,168,  0,  0,
+     48, 12, 63,252, 48, 12, 63,252,  9,168,  0,  0, 49,140, 63,252,
+     49,140, 63,252,  9,106,  0,  0,  6, 96, 15,240, 25,152, 51, 12,
+     10,154,  0,  0, 15,240, 24, 24, 48, 12, 24, 24, 15,240, 15,255,
+      0,  0, 63,252,  1,128,  3,192,  6, 96, 12, 48, 56, 28, 10,106,
+      0,  0, 63,252,  6, 96, 15,240, 25,152, 51, 12, 63,255,  0,  0,
+      1,128, 63,252,  1,128,  3,192,  6, 96, 12, 48, 56, 28, 10,105,
+     64,  0, 63,252,  0, 12, 63,252,  0, 12, 14,236,  0,  0, 63,252,
+     48, 63,252, 48, 63,252, 10, 88,  0,  0, 63,252, 12, 48, 63,252,
+     63,255,  0,  0,  1,128, 63,252, 15,240, 24, 24, 48, 12, 24, 24,
+     15,240, 10, 85, 64,  0,127,128,  1,128, 10, 85, 64,  0,127,128,
+     25,128,  9, 85,128,  0, 96,  0,127,128, 10, 85,128,  0,127,128,
+     96,  0,127,128, 10, 85,128,  0,119,128,102,  0,127,128, 10,105,
+    128,  0,127,128,  1,128,127,128, 96,  0,127,128, 10, 85,128,  0,
+    127,128, 97,128,127,128,  9,105,128,  0, 97,128,127,128, 97,128,
+    127,128,  9,105,128,  0,109,128,127,128,109,128,127,128, 10,170,
+    192,  0, 12, 12, 12, 12, 30, 51, 97,128, 10,170,192,  0, 54, 54,
+     54, 54, 62,111,217,128, 10,254,128,  0, 30, 51, 97,128, 97,128,
+     97,128, 51, 30, 14,170,192,  0,127,128, 12, 12, 12, 30, 51, 97,
+    128, 10, 86,128,  0,127,128, 27,  0, 63,128,108,192, 11,170,192,
+      0, 12,127,128, 12, 12, 30, 51, 97,128, 10,105, 64,  0,127,128,
+      1,128,127,128,  1,128, 14,170,192,  0,127,128, 96, 96,127, 96,
+     96,127,128, 10, 85,128,  0,127,128, 51,  0,127,128, 46,190,128,
+      0, 12,127,128, 30, 51, 97,128, 97,128, 51, 30, 10, 85,  0,  0,
+    127,128,  1,128, 10, 84,  0,  0,127,128, 25,128,  9, 88,  0,  0,
+     96,  0,127,128, 10, 88,  0,  0,127,128, 96,  0,127,128, 10, 88,
+      0,  0,119,128,102,  0,127,128, 15,236,  0,  0,127,128,  1,128,
+    127,128, 96,127,128, 10, 88,  0,  0,127,128, 97,128,127,128,  9,
+    168,  0,  0, 97,128,127,128, 97,128,127,128,  9,168,  0,  0,109,
+    128,127,128,109,128,127,128, 10,172,  0,  0, 12, 12, 30, 51, 97,
+    128, 10,172,  0,  0, 54, 54, 62,111,217,128, 10,232,  0,  0, 30,
+     51, 97,128, 51, 30, 14,172,  0,  0,127,128, 12, 30, 51, 97,128,
+     14,188,  0,  0,127,128, 27, 27, 63,128,108,192, 46,172,  0,  0,
+     12,127,128, 12, 30, 51, 97,128, 10,165,  0,  0,127,128,  1,128,
+    127,128,  1,128, 14,172,  0,  0,127,128, 96,127, 96,127,128, 10,
+     88,  0,  0,127,128, 51,  0,127,128, 46,232,  0,  0, 12,127,128,
+     51, 97,128, 51, 30, 42,170,  0,  0,126,  6,  6, 12, 12, 24, 96,
+     41, 90,  0,  0,127,128, 25,128, 51,  0,102,  0, 37, 86,  0,  0,
+     96,  0,127,128, 41, 86,  0,  0,127,128, 96,  0,127,128, 41, 86,
+      0,  0,119,128,102,  0,119,128, 41,166,  0,  0,127,128,  1,128,
+    127,128, 96,  0,127,128, 41, 86,  0,  0,127,128, 97,128,127,128,
+     37,166,  0,  0, 97,128,127,128, 97,128,127,128, 37,166,  0,  0,
+    109,128,127,128,109,128,127,128, 42,171,  0,  0, 12, 12, 12, 12,
+     30, 51, 97,128, 42,171,  0,  0, 54, 54, 54, 54, 62,111,217,128,
+     43,250,  0,  0, 30, 51, 97,128, 97,128, 97,128, 51, 30, 58,171,
+      0,  0,127,128, 12, 12, 12, 30, 51, 97,128, 41, 90,  0,  0,127,
+    192, 27,  0, 63,128,108,192, 46,171,  0,  0, 12,127,128, 12, 12,
+     30, 51, 97,128, 42,170,  0,  0,127,  3,  3,127,  6, 28,112, 58,
+    171,  0,  0,127,128, 96, 96,127, 96, 96,127,128, 41, 86,  0,  0,
+    127,128, 51,  0,127,128, 46,186,  0,  0, 12,127,128, 30, 51, 97,
+    128, 51, 30, 41, 84,  0,  0, 63,252,  0, 12, 41, 80,  0,  0, 63,
+    124,  3, 12, 37, 96,  0,  0, 48,  0, 63,252, 41, 96,  0,  0, 63,
+    252, 48,  0, 63,252, 41, 96,  0,  0, 62,252, 48,192, 62,252, 55,
+    176,  0,  0, 63,252, 12, 63,252, 48, 63,252, 41, 96,  0,  0, 63,
+    252, 48, 12, 63,252, 38,160,  0,  0, 48, 12, 63,252, 48, 12, 63,
+    252, 38,160,  0,  0, 49,140, 63,252, 49,140, 63,252, 38,160,  0,
+      0,  1,128,  3,192, 14,112, 48, 12, 37,160,  0,  0, 12, 48, 30,
+    120, 51,204, 63,240,  0,  0, 15,240, 24, 24, 48, 12, 24, 24, 15,
+    240, 63,240,  0,  0, 63,252,  1,128,  3,192, 14,112, 48, 12, 41,
+    160,  0,  0, 63,252, 12, 48, 30,120, 51,204, 63,240,  0,  0,  1,
+    128, 63,252,  3,192, 14,112, 48, 12, 55, 84,  0,  0, 63,252, 12,
+     63,252, 12, 12, 12, 59,176,  0,  0, 63,252, 48, 63,252, 48, 63,
+    252, 41, 96,  0,  0, 63,252, 12, 48, 63,252, 63,240,  0,  0,  1,
+    128, 63,252, 24, 24, 48, 12, 31,248, 41, 80,  0,  0,127,128,  1,
+    128, 41, 80,  0,  0,127,128, 25,128, 37,128,  0,  0, 96,  0,127,
+    128, 58,192,  0,  0, 63,128, 48, 48, 63,128, 58,192,  0,  0,119,
+    128,102,102,127,128, 63,176,  0,  0,127,128,  1,128,127,128, 96,
+    127,128, 41,128,  0,  0,127,128, 97,128,127,128, 63,192,  0,  0,
+     97,128,127,128, 97,128,127,128, 63,192,  0,  0,109,128,127,128,
+    109,128,127,128, 42,192,  0,  0, 12, 12, 30,115,128, 42,192,  0,
+      0, 54, 62,111,217,128, 43,160,  0,  0, 30, 51, 97,128, 51, 30,
+     58,192,  0,  0,127,128, 12, 30,115,128, 58,192,  0,  0,127,128,
+     51, 51,109,128, 46,176,  0,  0, 12,127,128, 12, 30,115,128, 63,
+    224,  0,  0,127,128,  1,128,127,128,  1,128,  3, 58,176,  0,  0,
+    127,128, 96,127, 96,127,128, 58,192,  0,  0,127,128, 51, 51,127,
+    128, 37, 90, 85, 80,  0, 24,  0, 31,  0, 24, 37, 90, 85, 80,  0,
+     54,  0, 62,  0, 54, 37,165,165, 80,  0, 24,  0, 31,  0, 24,  0,
+     31,  0, 24, 37,165,165, 80,  0, 54,  0, 62,  0, 54,  0, 62,  0,
+     54, 37, 90, 85, 80,  0, 12,  0,124,  0, 12, 37, 90, 85, 80,  0,
+     54,  0,246,  0, 54, 37,165,165, 80,  0, 12,  0,124,  0, 12,  0,
+    124,  0, 12, 37,165,165, 80,  0, 54,  0,246,  0, 54,  0,246,  0,
+     54,  0,  0,149,128,  1,128,127,254, 37, 90,149,160,  0, 24,  0,
+     31,  0, 24, 12, 24,127,248,  0, 24, 37, 90,149,160,  0, 54,  0,
+     62,  0, 54, 12, 54,127,182,  0, 54, 37, 85,149,160,  0, 12, 12,
+     12,127,252,  0, 12,  0,  0,149,128,  6, 96,127,254,  0,  0, 41,
+     80,127,254,  1,128, 37, 85,170, 80,  0, 12,127,252, 12, 12, 12,
+    252, 12, 12, 37, 85,170, 80,  0, 54,127,246, 12, 54, 12,246, 12,
+     54, 37, 85,165, 80,  0, 12,127,252, 12, 12,  0,  0, 41, 80,127,
+    254, 12, 48,  0,  0,  0,192,127,254, 37, 85, 85,160,  0, 12,127,
+    252,  0, 12, 37, 85, 85, 80,  0, 12,  0,  0, 37,128,  1,128,127,
+    254, 37, 90,101,160,  0, 24,  0, 31,  0, 24, 12, 24,127,248,  0,
+     24, 37, 90,101,160,  0, 54,  0, 62,  0, 54, 12, 54,127,246,  0,
+     54, 37, 85,101,160,  0, 12, 12, 12,127,252,  0, 12,  0,  0, 37,
+    128, 12, 48,127,254, 37,165,  0,  0,  0, 24,  0, 31,  0, 24, 37,
+    165,  0,  0,  0, 54,  0, 62,  0, 54, 21, 85,  0,  0, 24, 24, 31,
+     24, 31, 24, 24, 21, 85,  0,  0, 54, 54, 62, 54, 62, 54, 54, 37,
+    165,  0,  0,  0, 12,  0,124,  0, 12, 37,165,  0,  0,  0, 54,  0,
+    246,  0, 54, 21, 85,  0,  0, 12, 12,124, 12,124, 12, 12, 21, 85,
+      0,  0, 54, 54,246, 54,246, 54, 54,  0,150,  0,  0,  1,128,127,
+    254, 37,166,128,  0,  0, 24,  0, 31, 12, 24,127,248,  0, 24, 37,
+    166,128,  0,  0, 54,  0, 62, 12, 54,127,246,  0, 54, 37,102,128,
+      0,  0, 12,  6, 12,127,252,  0, 12,  0,150,  0,  0,  6, 96,127,
+    254,  0,  2,144,  0,127,254,  1,128, 37, 90,128,  0,  0, 12,127,
+    252, 12,124, 12, 12, 37, 90,128,  0,  0, 54,127,246, 12,246, 12,
+     54, 37, 90, 64,  0,  0, 12,127,252, 12, 12,  0,  2,144,  0,127,
+    254, 12, 48,  0,  3,  0,  0,127,254, 37, 86,128,  0,  0, 12,127,
+    252,  0, 12, 37, 85,  0,  0,  0, 12,  0, 38,  0,  0,  1,128,127,
+    254, 37,102,128,  0,  0, 12, 12, 12,127,252,  0, 12,  0, 38,  0,
+      0, 12, 48,127,254,  0,  0, 41, 80, 31,248,  0, 24,  0,  0, 41,
+     80, 31,248,  3, 24,  0,  0, 41,160, 31,152,  1,152,  1,188,  1,
+    230,  0,  0, 37, 96, 24,  0, 31,248,  0,  0, 41,160, 25,248, 24,
+     96, 24,240, 31,152,  0,  0, 63,240, 24, 96, 25,248, 24,240, 25,
+    152, 30,240,  0,  0, 41, 96, 31,248, 24,  0, 31,248,  0,  0, 55,
+    176, 31,248, 24, 31,248, 24, 31,248,  0,  0, 63,240, 31,248,  3,
+     24, 31, 24, 24, 24, 31, 24,  0,  0, 63,240, 31,248,  3,216, 31,
+    216, 24,216, 31,248,  0,  0, 63,240, 31,216,  3,216, 31,248, 24,
+    216, 31,248,  0,  0, 63,240, 31, 48,  3, 48, 31, 48, 24,120, 31,
+    204,  0,  0, 63,240, 31,248,  3,192, 31,248, 24,192, 31,248,  0,
+      0, 63,240, 31,248,  7,176, 31,176, 25,176, 31,248,  0,  0, 63,
+    240, 30, 96,  7,248, 30,240, 25,152, 30,240,  0,  0, 41, 96, 31,
+    248, 24, 24, 31,248,  0,  0, 38,160, 24, 24, 31,248, 24, 24, 31,
+    248,  0,  0, 38,160, 27, 48, 31, 48, 27,120, 31,204,  0,  0, 38,
+    160,  1,128,  3,192,  6, 96, 28, 56,  0,  0, 37,160,  6, 48, 15,
+    120, 25,204,  0,  0, 63,240,  7,224, 12, 48, 24, 24, 12, 48,  7,
+    224,  0,  0, 63,240, 31,248,  1,128,  3,192,  6, 96, 28, 56,  0,
+      0,255,240,  1,128, 31,248,  1,128,  3,192,  6, 96, 28, 56,  0,
+      0, 55, 80, 31,248, 24, 31,248, 24, 24,  0,  0, 59,176, 31,248,
+     24, 31,248, 24, 31,248,  0,  0, 41, 96, 31,248,  6, 96, 31,248,
+      0,  0,255,240,  1,128, 31,248, 12, 48, 24, 24, 12, 48,  7,224,
+      0,  0, 41, 80, 15,252,  0, 12,  0,  0, 41, 80, 15,252,  1,140,
+      0,  0, 53, 80, 15,204,204,204,222,243,  0,  0, 37, 96, 12,  0,
+     15,252,  0,  0, 41,160, 12,252, 12, 48, 12,120, 15,204,  0,  0,
+     63,240, 12, 48, 12,252, 12,120, 12,204, 15,120,  0,  0, 41, 96,
+     15,252, 12,  0, 15,252,  0,  0, 55,176, 15,252, 12, 15,252, 12,
+     15,252,  0,  0, 63,240, 15,252,  1,140, 15,140, 12, 12, 15,140,
+      0,  0, 63,240, 15,252,  1,236, 15,236, 12,108, 15,252,  0,  0,
+     63,240, 15,236,  1,236, 15,252, 12,108, 15,252,  0,  0, 63,240,
+     15,152,  1,152, 15,152, 12, 60, 15,230,  0,  0, 63,240, 15,252,
+      1,224, 15,252, 12, 96, 15,252,  0,  0, 63,240, 15,252,  3,216,
+     15,216, 12,216, 15,252,  0,  0, 63,240, 15, 48,  3,252, 15,120,
+     12,204, 15,120,  0,  0, 41, 96, 15,252, 12, 12, 15,252,  0,  0,
+     38,160, 12, 12, 15,252, 12, 12, 15,252,  0,  0, 38,160, 13,152,
+     15,152, 13,188, 15,230,  0,  0, 23,240,192,192,  1,224,  3, 48,
+     14, 28,  0,  0, 37,160,  3, 24,  7,188, 12,230,  0,  0, 63,240,
+      3,240,  6, 24, 12, 12,  6, 24,  3,240,  0,  0, 55,240, 15,252,
+    192,  1,224,  3, 48, 14, 28,  0,  0,119,240,192, 15,252,192,  1,
+    224,  3, 48, 14, 28,  0,  0, 55, 80, 15,252, 12, 15,252, 12, 12,
+      0,  0, 59,176, 15,252, 12, 15,252, 12, 15,252,  0,  0, 41, 96,
+     15,252,  3, 48, 15,252,  0,  0,127,240,192, 15,252,  6, 24, 12,
+     12,  6, 24,  3,240,  0,  0, 41, 80, 31,254,  0,  6,  0,  0, 41,
+     80, 31,254,  1,134,  0,  0, 37, 96, 24,  0, 31,254,  0,  0, 41,
+    160, 24,126, 24, 24, 24, 60, 31,230,  0,  0, 63,240, 24, 56, 24,
+    254, 24,124, 24,198, 31,124,  0,  0, 41, 96, 31,254, 24,  0, 31,
+    254,  0,  0, 55,176, 31,254,  6, 31,254, 24, 31,254,  0,  0, 63,
+    240, 31,254,  1,134, 31,134, 24,  6, 31,134,  0,  0, 63,240, 31,
+    254,  1,230, 31,230, 24,102, 31,254,  0,  0, 63,240, 31,230,  1,
+    230, 31,254, 24,102, 31,254,  0,  0, 63,240, 31,152,  1,152, 31,
+    152, 24, 60, 31,230,  0,  0, 63,240, 31,254,  1,224, 31,254, 24,
+     96, 31,254,  0,  0, 63,240, 31,254,  3,108, 31,108, 24,108, 31,
+    254,  0,  0, 63,240, 31,152,  1,254, 31,188, 24,102, 31,188,  0,
+      0, 41, 96, 31,254, 24,  6, 31,254,  0,  0, 38,160, 24,  6, 31,
+    254, 24,  6, 31,254,  0,  0, 38,160, 25,152, 31,152, 25,188, 31,
+    230,  0,  0, 23,240,192,192,  1,224,  7, 56, 28, 14,  0,  0, 37,
+    160,  6, 24, 15, 60, 25,230,  0,  0, 63,240,  7,248, 12, 12, 24,
+      6, 12, 12,  7,248,  0,  0, 55,240, 31,254,192,  1,224,  7, 56,
+     28, 14,  0,  0, 31,240,192, 31,254,  1,224,  7, 56, 28, 14,  0,
+      0, 55, 80, 31,254,  6, 31,254,  6,  6,  0,  0, 59,176, 31,254,
+     24, 31,254, 24, 31,254,  0,  0, 41, 96, 31,254,  6, 24, 31,254,
+      0,  0, 31,240,192, 31,254, 12, 12, 24,  6, 15,252,  0,  0, 41,
+     80, 63,252,  0, 12,  0,  0, 41, 80, 63,252,  3, 12,  0,  0, 41,
+    160, 63, 48,  3, 48,  3,120,  3,204,  0,  0, 37, 96, 48,  0, 63,
+    252,  0,  0, 41,160, 48,252, 48, 48, 48,120, 63,204,  0,  0, 63,
+    240, 48,112, 49,252, 48,248, 49,140, 62,248,  0,  0, 41, 96, 63,
+    252, 48,  0, 63,252,  0,  0, 55,176, 63,252, 12, 63,252, 48, 63,
+    252,  0,  0, 63,240, 63,252,  3, 12, 63, 12, 48, 12, 63, 12,  0,
+      0, 63,240, 62,252,  6,204, 62,204, 48,204, 62,252,  0,  0, 63,
+    240, 62,204,  6,204, 62,252, 48,204, 62,252,  0,  0, 63,240, 63,
+     48,  3, 48, 63, 48, 48,120, 63,204,  0,  0, 63,240, 63,124,  3,
+     96, 63,124, 48, 96, 63,124,  0,  0, 63,240, 63,252,  6,216, 62,
+    216, 48,216, 63,252,  0,  0, 63,240, 63, 48,  3,252, 63,120, 48,
+    204, 63,120,  0,  0, 41, 96, 63,252, 48, 12, 63,252,  0,  0, 38,
+    160, 48, 12, 63,252, 48, 12, 63,252,  0,  0, 38,160, 51, 48, 63,
+     48, 51,120, 63,204,  0,  0, 38,160,  1,128,  3,192, 14,112, 56,
+     28,  0,  0, 37,160, 12, 48, 30,120, 51,204,  0,  0, 63,240, 15,
+    240, 56, 28, 48, 12, 56, 28, 15,240,  0,  0, 63,240, 63,252,  1,
+    128,  3,192, 14,112, 56, 28,  0,  0, 63,240,  1,128, 63,252,  3,
+    192, 14,112, 56, 28,  0,  0, 55, 80, 63,252, 12, 63,252, 12, 12,
+      0,  0, 59,176, 63,252, 48, 63,252, 48, 63,252,  0,  0, 41, 96,
+     63,252, 12, 48, 63,252,  0,  0, 63,240,  1,128, 63,252, 24, 24,
+     48, 12, 31,248,
+};
+
+// offset
+static const font_prow_t FontHangul_Hangodic_meta[360] = {
+    { 0x00000000 }, { 0x00000004 }, { 0x80000012 }, { 0x8000001E }, { 0x80000026 }, { 0x80000030 }, { 0x8000003A }, { 0x80000048 },
+    { 0x80000052 }, { 0x8000005E }, { 0x8000006A }, { 0x80000076 }, { 0x80000080 }, { 0x8000008E }, { 0x8000009C }, { 0x800000A8 },
+    { 0x000000B8 }, { 0x800000C6 }, { 0x800000D4 }, { 0x800000DE }, { 0x00000000 }, { 0x800000F0 }, { 0x800000F8 }, { 0x80000100 },
+    { 0x80000108 }, { 0x80000112 }, { 0x0000011C }, { 0x8000012A }, { 0x80000134 }, { 0x80000140 }, { 0x8000014C }, { 0x8000015A },
+    { 0x80000166 }, { 0x80000174 }, { 0x80000184 }, { 0x00000192 }, { 0x800001A4 }, { 0x000001B0 }, { 0x800001BE }, { 0x000001C8 },
+    { 0x00000000 }, { 0x800000F0 }, { 0x800000F8 }, { 0x800001DA }, { 0x800001E2 }, { 0x800001EC }, { 0x000001F6 }, { 0x80000202 },
+    { 0x8000020C }, { 0x80000218 }, { 0x8000014C }, { 0x80000224 }, { 0x80000230 }, { 0x0000023E }, { 0x8000024E }, { 0x0000025C },
+    { 0x8000026E }, { 0x0000027A }, { 0x80000286 }, { 0x00000290 }, { 0x00000000 }, { 0x800002A2 }, { 0x800002AA }, { 0x800002B2 },
+    { 0x800002BA }, { 0x800002C4 }, { 0x800002CE }, { 0x800002DC }, { 0x800002E6 }, { 0x800002F2 }, { 0x000002FE }, { 0x0000030A },
+    { 0x00000316 }, { 0x00000324 }, { 0x80000331 }, { 0x0000033D }, { 0x8000034A }, { 0x00000356 }, { 0x80000363 }, { 0x0000036D },
+    { 0x00000000 }, { 0x8000037C }, { 0x80000384 }, { 0x8000038C }, { 0x80000394 }, { 0x8000039E }, { 0x000003A8 }, { 0x800003B5 },
+    { 0x800003BF }, { 0x800003CB }, { 0x000003D7 }, { 0x000003E1 }, { 0x000003EB }, { 0x000003F5 }, { 0x00000400 }, { 0x0000040C },
+    { 0x80000418 }, { 0x00000424 }, { 0x8000042F }, { 0x00000439 }, { 0x00000000 }, { 0x00000445 }, { 0x80000450 }, { 0x8000045C },
+    { 0x80000464 }, { 0x8000046E }, { 0x80000478 }, { 0x80000486 }, { 0x80000490 }, { 0x8000049C }, { 0x000004A8 }, { 0x000004B4 },
+    { 0x000004C0 }, { 0x000004CE }, { 0x800004DB }, { 0x000004E7 }, { 0x000004F4 }, { 0x000004FF }, { 0x8000050C }, { 0x00000516 },
+    { 0x00000000 }, { 0x80000523 }, { 0x8000052B }, { 0x80000533 }, { 0x8000053B }, { 0x80000545 }, { 0x0000054F }, { 0x8000055B },
+    { 0x80000565 }, { 0x80000571 }, { 0x8000057D }, { 0x80000589 }, { 0x00000593 }, { 0x000005A1 }, { 0x800005AF }, { 0x000005BB },
+    { 0x000005C9 }, { 0x000005D5 }, { 0x800005E1 }, { 0x000005EB }, { 0x00000000 }, { 0x800005F9 }, { 0x80000601 }, { 0x80000609 },
+    { 0x00000611 }, { 0x0000061B }, { 0x00000625 }, { 0x80000632 }, { 0x0000063C }, { 0x00000648 }, { 0x00000654 }, { 0x0000065D },
+    { 0x00000666 }, { 0x00000670 }, { 0x0000067A }, { 0x00000684 }, { 0x0000068F }, { 0x0000069C }, { 0x000006A7 }, { 0x00000439 },
+    { 0x00000000 }, { 0x800006B1 }, { 0x800006BB }, { 0x800006C5 }, { 0x800006D3 }, { 0x800006E1 }, { 0x800006EB }, { 0x800006F5 },
+    { 0x80000703 }, { 0x80000711 }, { 0x80000719 }, { 0x80000729 }, { 0x80000739 }, { 0x80000745 }, { 0x8000074D }, { 0x80000755 },
+    { 0x80000763 }, { 0x80000771 }, { 0x8000077B }, { 0x00000783 }, { 0x80000789 }, { 0x80000793 }, { 0x00000000 }, { 0x800006B1 },
+    { 0x800006BB }, { 0x800006C5 }, { 0x800006D3 }, { 0x800006E1 }, { 0x800006EB }, { 0x800006F5 }, { 0x80000703 }, { 0x80000799 },
+    { 0x800007A1 }, { 0x800007B1 }, { 0x800007C1 }, { 0x800007CD }, { 0x8000074D }, { 0x80000755 }, { 0x80000763 }, { 0x80000771 },
+    { 0x8000077B }, { 0x00000783 }, { 0x80000789 }, { 0x80000793 }, { 0x00000000 }, { 0x800007D5 }, { 0x800007DF }, { 0x000007E9 },
+    { 0x000007F4 }, { 0x800007FF }, { 0x80000809 }, { 0x00000813 }, { 0x0000081E }, { 0x80000829 }, { 0x80000831 }, { 0x8000083F },
+    { 0x8000084D }, { 0x80000859 }, { 0x80000861 }, { 0x80000869 }, { 0x80000875 }, { 0x80000881 }, { 0x8000088B }, { 0x00000893 },
+    { 0x80000899 }, { 0x800008A3 }, { 0x00000000 }, { 0x800007D5 }, { 0x800007DF }, { 0x000007E9 }, { 0x000007F4 }, { 0x800007FF },
+    { 0x80000809 }, { 0x00000813 }, { 0x0000081E }, { 0x800008A9 }, { 0x80000831 }, { 0x8000083F }, { 0x800008B1 }, { 0x800008BD },
+    { 0x80000861 }, { 0x80000869 }, { 0x80000875 }, { 0x80000881 }, { 0x8000088B }, { 0x00000893 }, { 0x80000899 }, { 0x800008A3 },
+    { 0x00000000 }, { 0x800008C5 }, { 0x800008CD }, { 0x800008D5 }, { 0x800008E1 }, { 0x800008E9 }, { 0x000008F5 }, { 0x80000903 },
+    { 0x0000090D }, { 0x00000919 }, { 0x00000927 }, { 0x00000935 }, { 0x00000943 }, { 0x00000951 }, { 0x0000095F }, { 0x0000096D },
+    { 0x8000097B }, { 0x80000985 }, { 0x80000991 }, { 0x8000099D }, { 0x800009A9 }, { 0x000009B3 }, { 0x000009C1 }, { 0x000009CF },
+    { 0x000009DF }, { 0x000009EA }, { 0x800009F6 }, { 0x00000A00 }, { 0x00000000 }, { 0x80000A10 }, { 0x80000A18 }, { 0x00000A20 },
+    { 0x80000A2A }, { 0x80000A32 }, { 0x00000A3E }, { 0x80000A4C }, { 0x00000A56 }, { 0x00000A62 }, { 0x00000A70 }, { 0x00000A7E },
+    { 0x00000A8C }, { 0x00000A9A }, { 0x00000AA8 }, { 0x00000AB6 }, { 0x80000AC4 }, { 0x80000ACE }, { 0x80000ADA }, { 0x00000AE6 },
+    { 0x80000AF2 }, { 0x00000AFC }, { 0x00000B0A }, { 0x00000B17 }, { 0x00000B25 }, { 0x00000B30 }, { 0x80000B3C }, { 0x00000B46 },
+    { 0x00000000 }, { 0x80000B55 }, { 0x80000B5D }, { 0x800008D5 }, { 0x80000B65 }, { 0x80000B6D }, { 0x00000B79 }, { 0x80000B87 },
+    { 0x00000B91 }, { 0x00000B9D }, { 0x00000BAB }, { 0x00000BB9 }, { 0x00000BC7 }, { 0x00000BD5 }, { 0x00000BE3 }, { 0x00000BF1 },
+    { 0x80000BFF }, { 0x80000C09 }, { 0x80000C15 }, { 0x00000C21 }, { 0x80000C2D }, { 0x00000C37 }, { 0x00000C45 }, { 0x00000C52 },
+    { 0x00000C5F }, { 0x00000C6A }, { 0x80000C76 }, { 0x00000C80 }, { 0x00000000 }, { 0x80000C8D }, { 0x80000C95 }, { 0x80000C9D },
+    { 0x80000CA9 }, { 0x80000CB1 }, { 0x00000CBD }, { 0x80000CCB }, { 0x00000CD5 }, { 0x00000CE1 }, { 0x00000CEF }, { 0x00000CFD },
+    { 0x00000D0B }, { 0x00000D19 }, { 0x00000D27 }, { 0x00000D35 }, { 0x80000D43 }, { 0x80000D4D }, { 0x80000D59 }, { 0x80000D65 },
+    { 0x80000D71 }, { 0x00000D7B }, { 0x00000D89 }, { 0x00000D97 }, { 0x00000DA5 }, { 0x00000DB0 }, { 0x80000DBC }, { 0x00000DC6 },
+};
+
+const font_hangul_t FontHangul_Hangodic = {
+    "FontHangul_Hangodic", FontHangul_Hangodic_meta, NULL, FontHangul_Hangodic_rows, NULL
+};
@@ -0,0 +1,335 @@
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+// Generated by tools/fontc. Do not edit. (make fonts)
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+#include <stddef.h>
+#include "../../lib_fb.h"
+#include "../../lib_font.h"
+
+// FontHangul_Hanpil : 360 glyphs, 11520 -> 4345 bytes (+ 1440 bytes meta)
+static const unsigned char FontHangul_Hanpil_rows[4345] = {
+      0,  0,  0,  0,  3,250,160,  0,  7,128,121,128,  1,128,  3,  6,
+     24, 96,  3,250,160,  0, 15,128,125,128, 13,128, 27, 98, 12, 48,
+      0,170,224,  0, 96, 48, 16, 16, 17,192, 30,  0,234,224,  0, 99,
+    128, 60, 16, 16, 49,128, 62,  0,234,224,  0, 99,128, 62, 18, 18,
+     51,128, 28,  0,254,224,  0,  3,128, 61,128,  3,128, 60, 11,128,
+     30,  0,255,224,  0,  3,128,109,128, 49,128, 17,128, 19,128, 29,
+      2,255,248,  0,  3,  1,128, 97,128, 51,128, 29,128, 17,128, 19,
+    128, 29,  2,255,248,  0,  3, 17,128, 73,128, 47,128, 61,128, 41,
+    128, 47,128, 57,  2,170,240,  0,  6,  3,  3,  6, 15, 25,128, 97,
+    128,  2,251,240,  0,  3, 25,128, 13,128,115,  7,128,121,128,  1,
+    128,  0,165,128,  0, 31,  0, 49,128, 31,  0,  0,234,240,  0,  7,
+    128,124,  6, 15, 25,128, 97,128,  3,187,240,  0,  7,128,121, 13,
+    128,115,  5,128,121,128,  1,128, 10,235,192,  0,  2, 28,  7,128,
+    124, 15, 25,128, 97,128,  3,250,160,  0,  7,128,121,128,  7,128,
+    123,  6, 24, 96,  0,234,224,  0,111,128, 48, 31, 16, 51,128, 62,
+      3,174,224,  0,  7,128,120,  3, 49,128, 27, 31,192,120, 10,235,
+    160,  0,  2, 28,  3,128,126, 27, 49,128, 51, 14,  1,245, 64,  0,
+     48, 12,120,  7,152, 24, 16, 32,  1,255, 64,  0, 48, 12,120,  7,
+    152,  1,152,  2, 16, 32,  2,171,  0,  0, 12,  6,  2,  6,  3,248,
+      2,235,  0,  0, 12,  7,248,  2,  6,  3,248,  3,255,  0,  0, 25,
+    128, 14,248,  4, 64, 12,192, 15,248,  3,123,  0,  0,  7,240, 48,
+      7,240,  3,  3,240,  1,255,  0,  0,112, 13,176,  6, 48,  2,112,
+      3,160,  7,255,  0,  0, 48, 12, 24,  6, 24,  3,248,  2, 24,  3,
+    240,  7,255,  0,  0, 24,  1,140,  8,204,  7,252,  4,204,  7,248,
+      1, 95,  0,  0,192, 96, 96,  1,152, 14, 24,  1,255,  0,  0, 48,
+      6, 24,  3, 48,  6,120, 29,204,  3,255,  0,  0,  3,224,  6, 48,
+      4, 16,  6, 48,  3,224,  1,223,  0,  0, 56, 15,192, 96,  1,152,
+     14, 24,  1,255,  0,  0,124, 15,152,  3, 48,  6,120, 29,204, 29,
+    223,  0,  0, 64,  1,128, 56, 15,192, 96,  1,152, 14, 24,  7,221,
+     64,  0, 48, 12,248,  7, 24,120,  7,152, 24, 16,  3,187,  0,  0,
+      7,248,  2,  3,248,  6,  3,248,  7,127,  0,  0,120, 15,128, 48,
+      3, 48,  3, 96, 15,252,  7,127,192,  0, 32,  1,192,120, 15,192,
+      1,224,  3, 48,  1,224,  7,213,  0,  0, 48, 12,120,  7,152, 24,
+     16, 32,  7,253,  0,  0, 48, 12,120,  7,152,  1,152,  2, 16, 32,
+      2,172,  0,  0, 12,  6,  2,  3,248, 11,172,  0,  0, 12,  7,248,
+      2,  6,  3,248, 15,252,  0,  0, 13,128,  7,248,  2, 64,  6,192,
+      7,248, 13,236,  0,  0,  7,240, 48,  7,240,  2,  7,240,  7,252,
+      0,  0,112, 13,176,  6, 48,  2,112,  3,160, 31,252,  0,  0, 48,
+     12, 24,  6, 24,  3,248,  2, 24,  3,240, 31,252,  0,  0, 24,  1,
+    140,  8,204,  7,252,  4,204,  7,248,  5,124,  0,  0,192, 96, 96,
+      1,152, 14, 24,  7,252,  0,  0, 48,  6, 24,  3, 48,  6,120, 29,
+    204, 15,252,  0,  0,  3,224,  6, 48,  4, 16,  6, 48,  3,224,  7,
+     92,  0,  0, 56,  7,192, 96,152,  7, 24,  7,252,  0,  0,124, 15,
+    152,  3, 48,  6,120, 29,204, 29,252,  0,  0, 64,  1,128, 56, 15,
+    192,  1,184, 14, 24,  7,221,  0,  0, 48, 12,248,  7, 24,120,  3,
+    144, 32, 14,236,  0,  0,  7,240,  2,  3,240,  6,  3,240,  6,124,
+      0,  0,240, 15, 96,  3, 96, 15,248,119,252,  0,  0, 64,  1,128,
+    112,  7,192,  1,224,  3, 48,  1,224,  3,245,128,  0,  1,128, 99,
+    192, 60,192,192,128,  1,  3,255,  0,  0,  1,192, 51,192, 30,192,
+      6,192,  4,128,  2,174,  0,  0, 48, 24,  8,  8,224, 15,  3,174,
+      0,  0, 55,128, 24,  8, 24,224, 31,  3,174,  0,  0, 49,192, 31,
+      9, 25,224, 14, 15,238,  0,  0,  3,192, 28,192,  1,192, 30,  8,
+    224, 15, 15,255,  0,  0,  1,192, 54,192, 24,192,  8,192,  9,192,
+     14,128, 13,255,  0,  0,  1,128,192, 49,192, 30,192,  9,192, 14,
+    128, 15,255,  0,  0,  1,128,  8,192, 37,192, 30,192, 23,192, 28,
+    128,  2,191,128,  0,  6,  3,  3,128,  4,192,  8,192, 48, 11,191,
+    128,  0,  3, 25,128, 11, 19,128,100,192, 24,192, 96,  2,150,  0,
+      0,  7,128, 12,192,  7,128, 14,191,  0,  0,  3,192, 30,  3,  7,
+    128, 12,192, 16,192,  3,191,128,  0,  7,128, 59, 11,128, 52,192,
+      8,192, 48, 43,175,  0,  0,  1, 14,  1,192, 30,  7, 12,192, 16,
+    192,  3,253,  0,  0,  3,192, 28,192,  3,192, 12,192,128, 14,238,
+      0,  0, 24,192, 15,  4,192,  7, 12,224, 15, 14,254,  0,  0,  3,
+    192, 28,  1,128, 12,128,  5,224, 30, 43,190,  0,  0,  1, 14,  1,
+    192, 30, 11,128, 25,128, 15, 15,214,  0,  0,  1,128, 51,192, 12,
+    192,192,128,  1, 15,250,  0,  0,  7,128, 61,128, 13,128, 13,128,
+      9, 18,  2,184,  0,  0, 48, 24,  8,224, 15,  3,184,  0,  0, 55,
+    128, 24,  8,224, 31, 14,248,  0,  0, 49,192, 31,  9, 32, 25,192,
+     14, 63,184,  0,  0,  7,128, 57,128,  3,128, 60, 17,192, 30, 15,
+    252,  0,  0,  1,192, 54,192, 24,192,  9,192, 14,128, 55,252,  0,
+      0,  1,128,192, 49,192, 14,192,  9,192, 14,128, 63,252,  0,  0,
+      1,128,  8,192, 37,192, 30,192, 23,192, 28,128, 10,252,  0,  0,
+      6,  3,  7,128, 12,192, 48,192, 11,252,  0,  0, 27, 13,128,115,
+    128,  6,192,120,192, 11,224,  0,  0, 15, 25,128, 25,128, 15, 14,
+    252,  0,  0,  3,192, 30,  7,128, 12,192, 48,192, 14,254,  0,  0,
+      7,128, 59, 19,128,102,192, 12,192, 48, 43,254,  0,  0,  1, 14,
+      1,192, 31,128,  6,192, 12,192, 16, 15,250,  0,  0,  7,128, 57,
+    128,  7,128, 25,128,  1,  2, 59,184,  0,  0, 49,128, 30,  9,128,
+     14, 25,192, 30, 58,184,  0,  0,  7,128, 56,  3, 25, 11,192, 60,
+    174,168,  0,  0,  2, 28,  3,128, 60, 23, 51, 14, 15,234,  0,  0,
+      7,128, 57,128,  1,128,  3, 12, 48, 15,170,  0,  0,  7,128,121,
+    128, 27, 98, 12, 48,  2,174,  0,  0, 48, 24,  8,  9,192, 14,  2,
+    174,  0,  0, 55, 24,  8, 25,192, 30, 14,190,  0,  0, 99,128, 62,
+     18, 18, 64, 51,128, 28, 15,238,  0,  0,  7,128, 57,128,  3,128,
+     60, 17,192, 62, 15,254,  0,  0,  3,128,109,128, 49,128, 17,128,
+     19,128, 29, 11,254,  0,  0,  3, 97,128, 51,128, 29,128, 19,128,
+     29, 47,254,  0,  0,  3, 17,128, 73,128, 47,128, 61,128, 47,128,
+     57, 10,191,  0,  0,  6,  3,  3,  7,128, 12,192, 48,192, 47,239,
+      0,  0,  3, 25,128, 13,128, 13,128,115,  7,128,121,128, 10, 88,
+      0,  0, 31,  0, 49,128, 31,  0, 14,175,  0,  0,  7,128,124,  6,
+     15, 25,128, 97,128, 14,239,  0,  0,  7,128,121, 13,128,115,  5,
+    128,121,128, 43,175,  0,  0,  2, 28,  3,128,124, 15, 25,128, 97,
+    128, 15,234,  0,  0,  7,128, 57,128,  7,128, 27, 12, 48, 14,238,
+      0,  0, 49,128, 30,  9,128, 14, 25,192, 30, 14,174,  0,  0,  7,
+    128, 56,  3, 25, 15,192, 56, 43,190,  0,  0,  1, 14,  1,192, 62,
+     11,128, 25,128, 15, 31, 84,  0,  0, 48, 12,120,  7,152, 24, 16,
+     32, 31,240,  0,  0, 48, 12,120,  7,152,  1, 24,  2, 16, 10,176,
+      0,  0, 12,  6,  6,  3,248, 46,176,  0,  0, 12,  7,240,  2,  6,
+      3,240, 10, 96,  0,  0, 15,248,  4, 64, 15,248, 55,176,  0,  0,
+      7,240, 48,  7,240,  3,  7,240, 31,240,  0,  0, 48, 12,120,  7,
+    152,  2, 24,  3,208, 31,240,  0,  0, 48, 12, 24,  7,248,  2, 24,
+      3,240,127,240,  0,  0, 48,  3, 24, 13,152,  7,248,  4,152,  7,
+    248, 21,240,  0,  0,192, 96, 96,  1,152, 14, 24, 31,240,  0,  0,
+     48,  6, 24,  3, 48,  6,120, 29,204, 41, 96,  0,  0,  3,224,  6,
+     48,  3,224, 29,240,  0,  0,112, 15,128,192,  1, 48, 14, 48, 31,
+    240,  0,  0,248, 15, 48,  3, 96,  6,240, 29,152, 55,240,  0,  0,
+      1,128, 56, 15,192,  1,176, 14, 24,125,208,  0,  0, 48, 12,248,
+      7, 24,120,  3,152, 16, 59,176,  0,  0,  7,240,  2,  3,240,  6,
+      3,240, 27,240,  0,  0,240, 15,  6, 96,  3, 96, 15,248, 55,240,
+      0,  0,  1,192,120, 15,224,  3, 48,  1,224, 63,160,  0,  0, 51,
+    128, 29,128,  1,128,  3,  4, 63,160,  0,  0,  7,128, 61,128, 13,
+    128, 27, 36, 11,128,  0,  0, 48, 25,128, 30, 59,128,  0,  0, 55,
+    128, 24, 25,128, 30, 59,128,  0,  0, 51,128, 30, 19,128, 28,254,
+    224,  0,  0,  7,128, 57,128,  7,128, 56, 19,128, 28,255,128,  0,
+      0,  3,128, 53,128, 25,128, 11,128, 13,191,128,  0,  0,  3, 51,
+    128, 29,128, 19,128, 29,255,128,  0,  0,  9,128, 39,128, 29,128,
+     23,128, 29,171,192,  0,  0, 12,  6,  7, 13,128, 49,128,187,192,
+      0,  0, 27, 13,128, 59,  7,128, 57,128, 47,128,  0,  0, 15, 25,
+    128, 25,128, 15, 59,192,  0,  0,  7,128, 62, 13,128, 49,128,235,
+    192,  0,  0,  7,128, 61, 11, 54,128, 25,128,187,192,  0,  0, 28,
+      3,128, 62, 13,128, 49,128, 63,160,  0,  0, 51,128, 29,128,  7,
+    128, 59,  6,238,224,  0,  0, 51,128, 28, 19,128, 28, 19,128, 28,
+    235,128,  0,  0,  7,128, 59, 27, 27,192, 60,186,128,  0,  0, 28,
+      3,128, 62, 27, 14,165, 90, 85, 88,  0, 24,  0, 12,  0, 15,  0,
+     12,  0,  8, 85, 85, 85, 84,  6, 51, 27, 27, 27, 27, 31, 27, 27,
+     27, 27, 27, 19,  3,  2,165,166,149, 88,  0, 24,  0, 12,  0, 15,
+      0, 12,  0, 15,  0, 12,  0,  8, 85, 85, 85, 84, 12,102, 54, 54,
+     62, 54, 54, 62, 54, 54, 54, 54, 38,  6,  4,165, 90, 85, 88,  0,
+     24,  0, 12,  0,124,  0, 12,  0,  8, 85, 85, 85, 84,  6, 51, 27,
+     27, 27, 27,123, 27, 27, 27, 27, 27, 19,  3,  2,165,105,165, 88,
+      0, 24,  0, 12,  0, 60,  0, 12,  0, 60,  0, 12,  0,  8, 85, 85,
+     85, 84,  6, 51, 27, 27, 27,123, 27, 27,123, 27, 27, 27, 19,  3,
+      2,  0,  0,166,128,  3,  0,  1,128,  1,252,126,  3,165, 90,170,
+     88,  0, 48,  0, 24,  0, 31, 24, 24, 12,120, 15,152,124, 24,  0,
+     24,  0, 16, 85, 87,253, 84,  6, 51, 27, 27, 27, 27, 31, 24, 27,
+     12,123, 15,155,124, 27, 27, 19,  3,  2,165, 86,170, 88,  0, 48,
+      0, 24, 24, 24, 12,120, 15,152,124, 24,  0, 24,  0, 16,  0,  2,
+    166,128,  1,128, 12,192,  6,192,  7,252,124,  3,  0,  0,169, 88,
+     15,252,112,199,  0,192,  0,128, 85, 87,255, 84, 48, 24, 24, 24,
+     24, 24, 56,  1,216,127, 24,  6,248, 12, 24, 48, 24, 24, 24, 16,
+     85, 87,255, 84,  6, 51, 27, 27, 27, 27, 59,  1,219,127, 27,  6,
+    251, 12, 27, 48, 27, 27, 19,  2, 85, 87,255, 84, 48, 24, 24, 24,
+     24, 24, 56,  1,216,127, 24,  6, 24, 12, 24, 48, 24, 24, 24, 16,
+      0,  0,169,104,  1,252,127, 51,  3, 48,  2, 48,  0, 32,  0,  0,
+      3,192,  3,252,124,  3,165, 85,170,152,  0, 48,  0, 24,  0, 56,
+      0,216,  7, 24,120, 24,  0, 24,  0, 16,165, 85, 85, 88,  0, 24,
+      0, 12,  0,  8,165,166,149, 88,  0, 24,  0, 12,  0, 60,  0, 12,
+      0, 60,  0, 12,  0,  8, 85, 85, 85, 84,  6, 51, 27, 27, 59, 27,
+     27, 59, 27, 27, 27, 27, 19,  3,  2,  0,  0, 87,192,192, 96, 96,
+      1,252,126,  3,165, 86,170, 88,  0, 48,  0, 24,  0, 31,  3, 56,
+      3,216,126, 24,  0, 24,  0, 16, 85, 85,253, 84,  6, 51, 27, 27,
+     27, 27, 27, 31,  3, 59,  3,219,126, 27, 27, 19,  3,  2,165, 85,
+    170, 88,  0, 24,  0, 12,  3, 60,  3,204,124, 12,  0, 12,  0,  8,
+      0,  0, 38,128,  3, 96,  3,252,124,  3,  0,  0,169, 88,  3,252,
+    124,195,  0,192,  0,128, 85, 87,255, 84, 24, 12, 12, 12, 12, 12,
+     60,  3,204,126, 12,  6,124, 12, 12, 48, 12, 12, 12,  8, 85, 87,
+    255, 84,  6, 51, 27, 27, 27, 27,123,  3,155,126, 27,  6,251, 12,
+     27, 48, 27, 27, 19,  2, 85, 87,255, 80, 48, 24, 24, 24, 24, 24,
+     56,  1,216,126, 24,  6, 24, 12, 24, 48, 24, 24, 16,  0,  0,169,
+    104,  3,252,127, 51,  3, 48,  2, 48,  0, 32,165, 85,170, 88,  0,
+     48,  0, 24,  0, 56,  3,216,124, 24,  0, 24,  0, 16, 85, 85, 64,
+      0, 24, 12, 12, 12, 15, 12, 12, 12,  8, 85, 85, 64,  0,  6, 51,
+     27, 27, 31, 27, 27, 19,  2, 85, 85, 64,  0, 24, 12, 12, 15, 12,
+     15, 12, 12,  8, 85, 85, 64,  0,  6, 51, 27, 31, 27, 31, 27, 19,
+      2, 85, 85, 64,  0, 24, 12, 12, 12, 60, 12, 12, 12,  8, 85, 85,
+     64,  0,  6, 51, 27, 27, 59, 27, 27, 19,  2, 85, 85, 64,  0, 24,
+     12, 12, 60, 12, 60, 12, 12,  8, 85, 85, 64,  0,  6, 51, 27, 59,
+     27, 59, 27, 19,  2,  0, 43,192,  0,  6,  3,  3,252,126,  3, 85,
+    127,192,  0, 48, 24, 24, 24, 31, 24, 24, 12, 56, 15,216,124, 16,
+     85,127,192,  0,  6, 51, 27, 27, 31, 24, 27, 12,123, 15,147,124,
+      2,165,106,128,  0,  0, 48,  0, 24, 24, 24, 12, 56, 15,216,124,
+     16,  0,255,192,  0,  1,128, 12,192,  6,128,  7,252,124,  3,  0,
+     15, 64,  0,  1,252,126,195,192, 85, 95,192,  0, 24, 12, 12, 12,
+     12,124,127,140,  6,124, 12,  8, 85,127,192,  0,  6, 51, 27, 27,
+     27,  1,251,127, 27, 12,251, 24, 18, 85, 95,192,  0, 48, 24, 24,
+     24, 24,120,127,152,  6, 24, 12, 16,  0, 15,192,  0,  3,252,127,
+     51,  3, 48,  0,  3,192,  0,  1,252,126,  3,165, 90,128,  0,  0,
+     48,  0, 24,  0, 56,  3,216,124, 16,165, 85,128,  0,  0, 24,  0,
+     12,  0,  8, 85, 85, 64,  0, 12,  6,  6,  6, 62,  6,  6,  6,  4,
+     85, 85, 64,  0, 12,  6,  6, 30,  6, 30,  6,  6,  4,  0,  7,192,
+      0,192,  1,252,126,  3, 85, 95,192,  0, 48, 24, 24, 24, 31, 24,
+      6, 56,  7,216,124, 16, 85, 95,192,  0,  6, 51, 27, 27, 31, 27,
+      6, 59,  7,219,124, 18,165, 90,128,  0,  0, 48,  0, 24,  6, 56,
+      7,216,124, 16,  0, 31,192,  0, 96,  3, 96,  3,252,126,  3,  0,
+      3,208,  0,  3,252,124,195,192, 85, 95,192,  0, 24, 12, 12, 12,
+     12,252,127, 12, 12,124, 24,  8, 85, 95,192,  0,  6, 51, 27, 27,
+     27,251,127, 27, 12,251, 24, 18, 85, 95,192,  0, 48, 24, 24, 24,
+     24,248,127, 24, 12, 24, 24, 16,  0,  3,240,  0,  3,252,127, 51,
+      3, 48,  0,  3,192,  0,  3,252,124,  3,165, 90,128,  0,  0, 48,
+      0, 24,  0,120,  7,152,124, 16,  0,  0, 29, 84,248, 15, 24, 24,
+     24, 24, 16,  0,  0, 31,244,248, 15,152,  1,152,  1,152,  1, 24,
+     16,  0,  0, 63,252, 30, 48,102, 24,  6, 24,  6, 56,  6,108,  5,
+    140,  0,  0, 10,180, 14,  3,  3,  1, 24,240,  0,  0, 31,252, 24,
+     48,240, 24, 48, 24, 56, 27,108, 14,140,  0,  0, 31,252,112, 96,
+     60, 48, 96, 16, 56, 19,108, 14, 56,  0,  0, 30,244, 28,  6,224,
+      3,  1,128,  1,140,240,  0,  0, 29,252,120,  7,152,120,  7,128,
+      3, 24,  3,224,  0,  0, 63,252, 14, 56, 54,216, 14, 24, 56, 24,
+     27, 24, 28, 16,  0,  0, 63,252, 14, 56, 54,216, 14,216, 56,216,
+     27,216, 28,224,  0,  0, 63,252, 14, 24, 54,216, 14,248, 56,216,
+     27,216, 28,240,  0,  0, 63,252, 14, 48, 54, 24, 14, 24, 56, 56,
+     26,108, 29,140,  0,  0, 63,252, 14, 24, 54,224, 14,216, 56,224,
+     27,216, 28,224,  0,  0, 63,252, 14, 56, 54,192, 14, 24, 56,216,
+     27, 88, 28,252,  0,  0, 63,252, 14,112, 54, 60, 14,224, 56,120,
+     27,204, 28,120,  0,  0,  7,252,120, 13,152,  6, 24,  3, 24,  3,
+    112,  0,  0, 31,252, 48,  6, 24,  3, 24,  3,248,  3, 24,  1,240,
+      0,  0, 63,252,  6, 48, 51, 24, 23, 24, 27, 56, 23,108, 25,140,
+      0,  0, 55,252,  1,128,192,  1,128,  3, 96,  6, 56, 24, 30,  0,
+      0, 31,252, 48,  6, 24,  3, 24,  7,188, 12,230, 49,134,  0,  0,
+     10, 88,  1,240,  3, 24,  1,240,  0,  0, 31,252,248, 15,192,  1,
+    128,  3, 96,  6, 56, 24, 30,  0,  0, 63,252,  1,128,  1,248, 15,
+    128,  3, 96,  6, 56, 24, 30,  0,  0, 29,212,248, 15, 24,120,  3,
+    152, 24, 16,  0,  0, 31,252, 56, 13,192,  6, 56,  3,192,  3, 56,
+      1,192,  0,  0, 29,252,120, 15,128, 48,  3, 48,  1,124,  7,192,
+      0,  0, 55,252,  3,192,248, 15,192,  1,224,  3, 48,  1,224,  0,
+      0, 29, 84,124,  7,140, 12, 12, 12,  8,  0,  0, 31,244,252, 31,
+    140,  1,140,  1,140,  1, 12,  8,  0,  0, 63,252, 15, 24,115, 12,
+      3, 12,  3, 28,  3, 54,  2,230,  0,  0, 10,180, 14,  3,  3,  1,
+     28,224,  0,  0, 31,252, 12, 24,120, 12, 24, 12, 28, 13,182,  7,
+     70,  0,  0, 31,252, 56, 96, 30, 48,112, 16, 28, 17,182, 15, 28,
+      0,  0, 29,252, 60,  3,204, 60,  3,192,  1,140,  1,240,  0,  0,
+     63,252,  7, 14, 59,118,  7,  6, 56,  6, 27,134, 28,  4,  0,  0,
+     63,252,  7, 28, 59,108,  7,108, 56,108, 25,236, 30,112,  0,  0,
+     63,252,  7, 12, 59,108,  7,124, 60,108, 25,236, 30,120,  0,  0,
+     63,252, 15, 48, 51, 24,  7, 24, 56, 60, 27,102, 28,134,  0,  0,
+     63,252, 15, 14, 51,112, 15,110, 56,112, 27,238, 28,112,  0,  0,
+     63,252, 15, 28, 51, 96,  7, 12, 56,108, 25,172, 30,126,  0,  0,
+     63,252,  7, 56, 59, 30,  7,112, 56, 60, 25,102, 30, 60,  0,  0,
+      7,252, 60,  6,204,  3, 12,  1,140,  1,184,  0,  0, 31,244, 24,
+      3, 12,  1,140,  1,252,  1,140,248,  0,  0, 63,252,  6, 24, 51,
+     12, 27, 12, 31, 28, 19, 54, 29,230,  0,  0, 21,252,192, 96,192,
+      1,176,  3, 28, 12, 15,  0,  0, 10, 88,  0,248,  1,140,  0,248,
+      0,  0, 29,252, 60,  7,224,192,  1,176,  3, 28, 12, 15,  0,  0,
+     23,252,192,252,  7,192,  1,176,  3, 28, 12, 15,  0,  0, 29,212,
+    124,  7,140, 60,  1,204, 12,  8,  0,  0, 31,244, 28,  6,224,  3,
+     28,  1,224,  1,156,224,  0,  0, 29,220, 60,  7,192, 24,  1,152,
+    190,  3,224,  0,  0, 55,116,  1,224,124,  7,224,240,  1,152,240,
+      0,  0, 29, 84, 62,  7,198,  6,  6,  6,  4,  0,  0, 29, 84,126,
+      7,198,198,198,134,  4,  0,  0, 63,252, 15, 24,115, 12,  3, 12,
+      3, 30,  3, 51,  2,227,  0,  0, 10,180, 14,  3,  3,  1, 14,240,
+      0,  0, 31,252,  6, 24,124, 12, 12, 12, 14, 13,155,  7, 99,  0,
+      0, 30,244, 14,  6,240,  3,  1,128,  1,142,240,  0,  0, 29,252,
+     30,  3,230, 30,  3,224,  1,142,  1,240,  0,  0, 63,252,  7, 30,
+     59,102,  7,  6, 56,  6, 27,134, 28,  4,  0,  0, 63,252,  7, 30,
+     59,102,  7,102, 56,102, 25,238, 30,112,  0,  0, 63,252,  7,  6,
+     59,102,  7,110, 60,118, 25,238, 30,116,  0,  0, 63,252, 15, 24,
+     51, 12,  7, 12, 56, 30, 27, 51, 28,195,  0,  0, 63,252,  7,156,
+     57,143,  7,184, 56, 30, 25,179, 30, 30,  0,  0,  7,212, 30,  3,
+    102,  1,134,198,220,  0,  0, 29, 84, 12,  1,134,198,254,198,124,
+      0,  0, 63,252,  3, 12, 25,134, 13,134, 15,142,  9,155, 14,227,
+      0,  0, 31,252, 24,  6, 12,  3, 12,  7,158, 12,179,113,195,  0,
+      0,  5, 84,124,198,198,198,124,  0,  0, 29,252, 62,  7,224,192,
+      1,176,  3, 28, 12, 15,  0,  0, 23,252,192,254, 15,192,  1,176,
+      3, 28, 12, 15,  0,  0, 29,212,126,  7,134, 30,  1,230,  6,  4,
+      0,  0, 31,244, 30,  6,224,  3, 30,  1,224,  1,158,224,  0,  0,
+     29,220, 62,  7,192, 28,  1,140,222,  3,224,  0,  0, 23, 84,240,
+     62,  3,240,120,204,120,  0,  0, 61, 84,  1,240, 14, 48, 48, 48,
+     48, 32,  0,  0, 42,104,  1,240, 31, 48,  3, 48,  2, 48,  0, 32,
+      0,  0, 10,188, 28,  6,  6,  2, 48,  1,224,  0,  0, 14,172, 27,
+    224, 12,  4, 12,  7,224,  0,  0, 13,236,  7,240, 48,  7,240,  3,
+      3,240,  0,  0, 63,252,  7, 56, 27,216,  7, 24, 28, 24, 13,152,
+     14, 16,  0,  0, 63,252, 14, 28, 54,108, 14,108, 56,108, 27,108,
+     28,112,  0,  0, 63,252, 14, 12, 54,108, 14,124, 56,108, 27,108,
+     28,120,  0,  0, 63,252, 14, 48, 54, 24, 14, 24, 56, 56, 27, 44,
+     28,204,  0,  0, 63,252, 14, 12, 54,112, 14,108, 56,112, 27,108,
+     28,112,  0,  0, 63,252, 14, 60, 54,192, 14, 24, 56,216, 22, 88,
+     28,252,  0,  0, 63,252, 14,112, 54, 60, 14,224, 56,120, 22,204,
+     28,120,  0,  0, 10, 88, 13,240,  6, 48,  7,224,  0,  0, 31,252,
+     96, 12, 48,  6, 48,  7,240,  6, 48,  7,224,  0,  0, 63,252,  6,
+     48, 51, 24, 31, 24, 27, 56, 23,108, 25,140,  0,  0, 10, 88,  3,
+    224,  6, 48,  3,224,  0,  0, 29,212,240, 15, 48,112,  3,176, 48,
+     32,  0,  0, 14,236,  6,248,  3,  1,240,  3,  1,248,  0,  0, 13,
+    252,  7,248, 48,  3, 48,  1,176,  7,248,  0,  0, 55,252,  3,192,
+    252, 15,192,  1,240,  3, 24,  1,240,
+};
+
+// offset
+static const font_prow_t FontHangul_Hanpil_meta[360] = {
+    { 0x00000000 }, { 0x00000004 }, { 0x00000012 }, { 0x00000020 }, { 0x0000002B }, { 0x00000037 }, { 0x00000043 }, { 0x00000051 },
+    { 0x00000060 }, { 0x00000072 }, { 0x00000084 }, { 0x00000091 }, { 0x800000A1 }, { 0x000000AB }, { 0x000000B8 }, { 0x000000C8 },
+    { 0x000000D6 }, { 0x000000E4 }, { 0x000000F0 }, { 0x000000FE }, { 0x00000000 }, { 0x0000010C }, { 0x00000118 }, { 0x00000126 },
+    { 0x00000130 }, { 0x0000013B }, { 0x00000149 }, { 0x00000155 }, { 0x00000162 }, { 0x00000171 }, { 0x00000180 }, { 0x0000018B },
+    { 0x00000198 }, { 0x000001A6 }, { 0x000001B2 }, { 0x000001BF }, { 0x000001CE }, { 0x000001DC }, { 0x000001E8 }, { 0x000001F6 },
+    { 0x00000000 }, { 0x00000206 }, { 0x00000212 }, { 0x00000220 }, { 0x00000229 }, { 0x00000234 }, { 0x00000242 }, { 0x0000024E },
+    { 0x0000025B }, { 0x0000026A }, { 0x00000279 }, { 0x00000284 }, { 0x00000291 }, { 0x0000029F }, { 0x000002AA }, { 0x000002B7 },
+    { 0x000002C5 }, { 0x000002D2 }, { 0x000002DE }, { 0x000002E9 }, { 0x00000000 }, { 0x000002F9 }, { 0x00000306 }, { 0x00000314 },
+    { 0x0000031E }, { 0x00000329 }, { 0x00000334 }, { 0x00000342 }, { 0x00000352 }, { 0x00000361 }, { 0x00000371 }, { 0x0000037E },
+    { 0x8000038D }, { 0x00000397 }, { 0x000003A5 }, { 0x000003B3 }, { 0x000003C1 }, { 0x000003CE }, { 0x000003DB }, { 0x000003E9 },
+    { 0x00000000 }, { 0x000003F7 }, { 0x00000404 }, { 0x00000412 }, { 0x0000041B }, { 0x00000425 }, { 0x00000431 }, { 0x0000043F },
+    { 0x0000044D }, { 0x0000045C }, { 0x0000046C }, { 0x00000478 }, { 0x00000485 }, { 0x0000048F }, { 0x0000049C }, { 0x000004AA },
+    { 0x000004B9 }, { 0x000004C7 }, { 0x000004D4 }, { 0x000004E0 }, { 0x00000000 }, { 0x000004EC }, { 0x000004F9 }, { 0x00000505 },
+    { 0x0000050F }, { 0x00000519 }, { 0x00000526 }, { 0x00000534 }, { 0x00000543 }, { 0x00000551 }, { 0x00000561 }, { 0x0000056E },
+    { 0x8000057E }, { 0x00000588 }, { 0x00000595 }, { 0x000005A3 }, { 0x000005B1 }, { 0x000005BE }, { 0x000005CB }, { 0x000005D7 },
+    { 0x00000000 }, { 0x000005E5 }, { 0x000005F1 }, { 0x000005FE }, { 0x00000607 }, { 0x80000612 }, { 0x0000061C }, { 0x00000628 },
+    { 0x00000635 }, { 0x00000642 }, { 0x00000651 }, { 0x0000065C }, { 0x80000669 }, { 0x00000673 }, { 0x0000067F }, { 0x0000068C },
+    { 0x00000699 }, { 0x000006A6 }, { 0x000006B2 }, { 0x000006BE }, { 0x00000000 }, { 0x000006CB }, { 0x000006D7 }, { 0x000006E3 },
+    { 0x000006EB }, { 0x000006F5 }, { 0x000006FF }, { 0x0000070D }, { 0x0000071A }, { 0x00000726 }, { 0x00000733 }, { 0x0000073E },
+    { 0x0000074A }, { 0x00000754 }, { 0x0000075F }, { 0x0000076B }, { 0x00000777 }, { 0x00000783 }, { 0x00000790 }, { 0x0000079B },
+    { 0x00000000 }, { 0x800007A5 }, { 0x000007B3 }, { 0x800007C6 }, { 0x000007D8 }, { 0x800007EB }, { 0x000007F9 }, { 0x8000080C },
+    { 0x0000081E }, { 0x80000831 }, { 0x8000083D }, { 0x00000853 }, { 0x8000086A }, { 0x8000087E }, { 0x8000088C }, { 0x00000898 },
+    { 0x000008B0 }, { 0x000008C8 }, { 0x800008E0 }, { 0x000008EE }, { 0x800008F6 }, { 0x8000090A }, { 0x00000000 }, { 0x800007A5 },
+    { 0x000007B3 }, { 0x800007C6 }, { 0x000007D8 }, { 0x800007EB }, { 0x000007F9 }, { 0x80000914 }, { 0x00000926 }, { 0x00000939 },
+    { 0x80000944 }, { 0x00000958 }, { 0x8000096E }, { 0x80000980 }, { 0x8000098A }, { 0x00000996 }, { 0x000009AE }, { 0x000009C6 },
+    { 0x800009DD }, { 0x000008EE }, { 0x800009EB }, { 0x8000090A }, { 0x00000000 }, { 0x000009FD }, { 0x00000A0A }, { 0x00000A17 },
+    { 0x00000A24 }, { 0x00000A31 }, { 0x00000A3E }, { 0x00000A4B }, { 0x00000A58 }, { 0x00000A65 }, { 0x00000A6F }, { 0x00000A80 },
+    { 0x80000A91 }, { 0x00000AA1 }, { 0x00000AAF }, { 0x00000AB8 }, { 0x00000AC8 }, { 0x00000AD9 }, { 0x00000AE9 }, { 0x00000AF3 },
+    { 0x80000AFB }, { 0x80000B09 }, { 0x00000000 }, { 0x000009FD }, { 0x00000A0A }, { 0x00000A17 }, { 0x00000A24 }, { 0x00000B13 },
+    { 0x00000A3E }, { 0x00000B20 }, { 0x00000A58 }, { 0x00000B2D }, { 0x00000B36 }, { 0x00000B46 }, { 0x80000B56 }, { 0x00000B64 },
+    { 0x00000B6F }, { 0x00000B78 }, { 0x00000B88 }, { 0x00000B98 }, { 0x00000BA8 }, { 0x00000BB2 }, { 0x80000BBA }, { 0x80000B09 },
+    { 0x00000000 }, { 0x00000BC8 }, { 0x00000BD3 }, { 0x00000BE1 }, { 0x00000BF1 }, { 0x00000BFB }, { 0x00000C0A }, { 0x00000C19 },
+    { 0x00000C26 }, { 0x00000C34 }, { 0x00000C44 }, { 0x00000C54 }, { 0x00000C64 }, { 0x00000C74 }, { 0x00000C84 }, { 0x00000C94 },
+    { 0x00000CA4 }, { 0x00000CB1 }, { 0x00000CC0 }, { 0x00000CD0 }, { 0x00000CDF }, { 0x80000CEE }, { 0x00000CF8 }, { 0x00000D07 },
+    { 0x00000D17 }, { 0x00000D23 }, { 0x00000D32 }, { 0x00000D40 }, { 0x00000000 }, { 0x00000D4F }, { 0x00000D5A }, { 0x00000D68 },
+    { 0x00000D78 }, { 0x00000D82 }, { 0x00000D91 }, { 0x00000C19 }, { 0x00000DA0 }, { 0x00000DAE }, { 0x00000DBE }, { 0x00000DCE },
+    { 0x00000DDE }, { 0x00000DEE }, { 0x00000DFE }, { 0x00000E0E }, { 0x00000E1E }, { 0x00000E2B }, { 0x00000E39 }, { 0x00000E49 },
+    { 0x00000CDF }, { 0x80000E56 }, { 0x00000E60 }, { 0x00000E6E }, { 0x00000E7C }, { 0x00000E88 }, { 0x00000E96 }, { 0x00000EA3 },
+    { 0x00000000 }, { 0x00000EB0 }, { 0x00000EBB }, { 0x00000EC6 }, { 0x00000ED6 }, { 0x00000EE0 }, { 0x00000D91 }, { 0x00000EEF },
+    { 0x00000EFC }, { 0x00000F0A }, { 0x00000F1A }, { 0x00000F2A }, { 0x00000F3A }, { 0x00000DEE }, { 0x00000DFE }, { 0x00000F4A },
+    { 0x00000F5A }, { 0x00000F65 }, { 0x00000F70 }, { 0x00000E49 }, { 0x00000F80 }, { 0x00000F8F }, { 0x00000F98 }, { 0x00000FA6 },
+    { 0x00000FB4 }, { 0x00000FC0 }, { 0x00000FCE }, { 0x00000FDB }, { 0x00000000 }, { 0x00000FE6 }, { 0x80000FF2 }, { 0x00000BE1 },
+    { 0x00001000 }, { 0x00000BFB }, { 0x00000C0A }, { 0x0000100B }, { 0x00001016 }, { 0x00001022 }, { 0x00001032 }, { 0x00001042 },
+    { 0x00001052 }, { 0x00001062 }, { 0x00001072 }, { 0x00001082 }, { 0x80001092 }, { 0x0000109C }, { 0x000010AB }, { 0x00000CD0 },
+    { 0x00000CDF }, { 0x800010BB }, { 0x00000CF8 }, { 0x00000D07 }, { 0x000010C5 }, { 0x000010D1 }, { 0x000010DD }, { 0x000010EA },
+};
+
+const font_hangul_t FontHangul_Hanpil = {
+    "FontHangul_Hanpil", FontHangul_Hanpil_meta, NULL, FontHangul_Hanpil_rows, NULL
+};
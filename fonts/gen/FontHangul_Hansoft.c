@@ -0,0 +1,277 @@
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+// Generated by tools/fontc. Do not edit. (make fonts)
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+#include <stddef.h>
+#include "../../lib_fb.h"
+#include "../../lib_font.h"
+
+// FontHangul_Hansoft : 360 glyphs, 11520 -> 3419 bytes (+ 1440 bytes meta)
+static const unsigned char FontHangul_Hansoft_rows[3419] = {
+      0,  0,  0,  0, 10,170,170,128,124, 14,  6,  6, 12, 12, 12, 24,
+     24, 48, 96, 10,149,150, 64,126,  0, 31,  0, 27,  0, 54,  0,108,
+      0,  9, 85, 86,128, 96,  0, 97,128, 62,  0, 10, 85, 86,128,127,
+      0, 96,  0, 99,  0, 60,  0, 10, 85, 86,128,127,128,108,  0,109,
+    128, 62,  0, 10,170,170,128,126,  3,  3,  3,  3, 62, 96, 96, 96,
+     99, 60, 10, 85, 86,128,127,  0, 99,  0,103,  0, 60,  0,  9, 86,
+    150,128, 99,  0,127,  0, 99,  0,103,  0, 60,  0,  9, 86,150,128,
+    109,128,127,128,109,128,111,128, 62,  0, 10,165,149, 64, 12,  0,
+     30,  0, 63,  0, 51,  0, 97,128, 10, 85,149, 64, 54,  0,111,  0,
+    217,128, 10,149, 86,128, 30,  0, 51,  0, 97,128, 51,  0, 30,  0,
+     10,170,171,192,126,  7,  6,  6, 14, 28, 30, 51, 51, 97,128, 97,
+    128, 11,250,171,192,255, 25,128, 25,128, 59,128, 55, 54, 62,111,
+    111,217,128,217,128, 42,170,171,192, 24,126,  7,  6,  6, 14, 28,
+     30, 51, 51, 97,128, 97,128, 10,170,170,128,124, 14,  6,  6, 12,
+    124, 12, 24, 24, 48, 96, 10,170,170,128, 63, 96, 96, 96, 96,126,
+     96, 96, 96, 99, 60, 10, 85, 86,128,127,  0, 54,  0, 55,  0,124,
+      0, 40,169, 86,128, 12,  0,127,128, 30,  0, 51,  0, 97,128, 51,
+      0, 30,  0, 10,149, 64,  0, 63,248,  0, 28,  0, 12, 10, 85, 64,
+      0,124,248,  6, 12,  9, 86,128,  0, 48,  0, 48, 28, 31,224, 10,
+     86,128,  0, 63,252, 48,  0, 48, 28, 31,224, 10, 86,128,  0, 62,
+    252, 48,192, 48,204, 30,112, 13,123,192,  0, 63,248, 12, 12, 31,
+    248, 48, 48, 28, 31,224, 10, 86,128,  0, 63,252, 48, 12, 48, 60,
+     31,224,  9,106,128,  0, 48, 12, 63,252, 48, 12, 48, 60, 31,224,
+      9,106,128,  0, 49,140, 63,252, 49,140, 49,188, 31,224, 10,165,
+     64,  0,  3,192, 14,112, 24, 24, 48, 12, 10,101, 64,  0, 14,240,
+     25,152, 51, 12, 10,150,128,  0, 15,240, 24, 24, 48, 12, 24, 24,
+     15,240, 13,127,192,  0, 63,224, 48,240,  3,224, 14,112, 24, 24,
+     48, 12, 15,255,192,  0, 63,224,  3, 48,  3,112,  7,224, 13,240,
+     27, 24, 54, 12, 45,127,192,  0,  3, 63,224, 48,240,  3,224, 14,
+    112, 24, 24, 48, 12, 13,117, 64,  0, 63,248, 28, 12, 31,252, 12,
+     12, 12, 14,187,192,  0, 63,252, 48, 48, 63,248, 48, 48, 28, 31,
+    224, 10, 86,128,  0, 63,252, 12, 48, 12, 60, 63,224, 15,255,192,
+      0,  3,192, 63,252, 15,240, 56, 28, 48, 12, 56, 28, 15,240,  9,
+    104,  0,  0, 48,  0, 48, 12, 31,240, 14,188,  0,  0, 63,252, 48,
+     48, 48, 12, 31,240, 10,104,  0,  0, 62,252, 48,192, 48,204, 30,
+    112, 13,236,  0,  0, 63,248, 12, 31,248, 48, 31,252, 10,104,  0,
+      0, 63,252, 48, 12, 48, 28, 31,240,  9,168,  0,  0, 48, 12, 63,
+    252, 48, 28, 31,240,  9,168,  0,  0, 49,140, 63,252, 49,156, 31,
+    240, 10,165,  0,  0,  3,192, 14,112, 24, 24, 48, 12, 10,101,  0,
+      0, 14,240, 25,152, 51, 12, 10,154,  0,  0, 15,240, 24, 24, 48,
+     12, 24, 24, 15,240, 13,127,  0,  0, 63,224, 48,240,  3,224, 14,
+    112, 56, 28, 15,255,  0,  0, 63,224,  3, 48,  3,112,  7,224, 13,
+    240, 59, 28, 45,127,  0,  0,  3, 63,224, 48,240,  3,224, 14,112,
+     56, 28, 14,236,  0,  0, 63,252, 48, 63,252, 48, 31,252, 10,104,
+      0,  0, 63,252, 12, 48, 12, 52, 63,248, 63,255,  0,  0,  1,128,
+     63,252, 15,240, 56, 28, 48, 12, 56, 28, 15,240, 10,149, 64,  0,
+    127,  0,  3,128,  1,128, 10, 85, 64,  0,127,  0, 25,128,  9, 86,
+    128,  0, 96,  0, 97,128, 62,  0, 10, 86,128,  0,127,128, 96,  0,
+     97,128, 62,  0, 10, 86,128,  0,119,128,102,  0,102,128, 51,  0,
+     11,235,128,  0,127,  1,128,  1,128, 63, 96, 97,128, 62, 10, 86,
+    128,  0,127,128, 97,128, 99,128, 62,  0,  9,106,128,  0, 97,128,
+    127,128, 97,128, 99,128, 62,  0,  9,106,128,  0,109,128,127,128,
+    109,128,111,128, 62,  0, 10,101, 64,  0, 30,  0, 51,  0, 97,128,
+     10,101, 64,  0, 54,  0,111,  0,217,128, 10,254,128,  0, 30, 51,
+     97,128, 97,128, 97,128, 51, 30, 10,170,192,  0,126,  3,  6, 12,
+     30, 51, 97,128, 11,171,192,  0,127, 27,128, 27, 31, 31, 61,128,
+    108,192, 42,170,192,  0, 24,126,  3,  6, 12, 30, 51, 97,128, 11,
+    255,128,  0,127,  3,128,  1,128, 63,128,  1,128,  1,128,  3, 14,
+    171,128,  0,127,128, 96, 96,127, 96, 97,128, 62, 10, 86,128,  0,
+    127,128, 51,  0, 51,128,126,  0, 46,190,128,  0, 12,127,128, 30,
+     51, 97,128, 97,128, 51, 30, 10,149,  0,  0,127,  0,  3,128,  1,
+    128, 10, 84,  0,  0,119,  0, 25,128, 10,184,  0,  0, 96, 96, 96,
+     97,128, 62, 14,184,  0,  0,127,128, 96, 96, 97,128, 62, 14,184,
+      0,  0,119,128,102,102,102,128, 51, 11,172,  0,  0,127,  1,128,
+     63, 96, 63,128, 10,104,  0,  0,127,128, 97,128, 99,128, 62,  0,
+      9,168,  0,  0, 97,128,127,128, 99,128, 62,  0,  9,168,  0,  0,
+    109,128,127,128,109,128, 62,  0, 10,148,  0,  0, 30,  0, 51,  0,
+     97,128, 10,148,  0,  0, 54,  0,111,  0,217,128, 11,248,  0,  0,
+     30,115,128, 97,128,115,128, 30, 10,172,  0,  0,126,  7, 30, 51,
+     97,128, 11,188,  0,  0,127, 27,128, 27, 63,128,108,192, 42,172,
+      0,  0, 24,126,  7, 30, 51, 97,128, 10,165,  0,  0,127,  0,  3,
+    128,127,128,  1,128, 14,236,  0,  0,127,128, 96,127,128, 96, 63,
+    128, 10, 88,  0,  0,127,128, 51,  0,127,128, 46,248,  0,  0, 12,
+    127,128, 63, 97,128, 97,128, 63, 42, 85,  0,  0,127,  0,  3,128,
+      1,128, 41, 85,  0,  0,127,  0, 25,128, 37, 90,  0,  0, 96,  0,
+     97,128, 62,  0, 41, 90,  0,  0,127,128, 96,  0, 97,128, 62,  0,
+     41, 90,  0,  0,119,128,102,  0,102,128, 51,  0, 47,174,  0,  0,
+    127,  1,128,  1,128, 63, 96, 97,128, 62, 41, 90,  0,  0,127,128,
+     97,128, 99,128, 62,  0, 37,170,  0,  0, 97,128,127,128, 97,128,
+     99,128, 62,  0, 37,170,  0,  0,109,128,127,128,109,128,111,128,
+     62,  0, 41,149,  0,  0, 30,  0, 51,  0, 97,128, 41,149,  0,  0,
+     54,  0,111,  0,217,128, 43,250,  0,  0, 30, 51, 97,128, 97,128,
+     97,128, 51, 30, 42,171,  0,  0,126,  3,  6, 12, 30, 51, 97,128,
+    170,171,  0,  0, 24,126,  3,  6, 12, 30, 51, 97,128, 42,170,  0,
+      0,126,  7,  3, 63,  6, 28,112, 58,238,  0,  0,127,128, 96, 96,
+    127,128, 96, 97,128, 62, 41, 90,  0,  0,127,128, 51,  0, 51,128,
+    126,  0, 46,254,  0,  0, 12,127,128, 30,115,128, 97,128,115,128,
+     30, 42, 84,  0,  0, 63,248,  0, 28,  0, 12, 41, 80,  0,  0, 62,
+    248,  3, 12, 37,160,  0,  0, 48,  0, 48, 28, 31,224, 58,240,  0,
+      0, 63,252, 48, 48, 48, 28, 31,224, 41,160,  0,  0, 62,252, 48,
+    192, 48,204, 30,240, 55,176,  0,  0, 63,248, 12, 31,248, 48, 31,
+    252, 41,160,  0,  0, 63,252, 48, 12, 48, 60, 31,224, 38,160,  0,
+      0, 48, 12, 63,252, 48, 60, 31,224, 38,160,  0,  0, 49,140, 63,
+    252, 49,156, 31,240, 42, 80,  0,  0,  7,224, 28, 56, 48, 12, 42,
+     80,  0,  0, 14,240, 25,152, 51, 12, 63,240,  0,  0, 15,240, 56,
+     28, 48, 12, 56, 28, 15,240, 55,240,  0,  0, 63,240,120,  3,224,
+     14,112, 48, 12, 63,240,  0,  0, 63,240,  6,120, 14, 48, 30,120,
+     51,204,183,240,  0,  0,  3, 63,240,120,  3,224, 14,112, 48, 12,
+     55, 84,  0,  0, 63,240, 28, 31,252, 12, 12, 12, 59,176,  0,  0,
+     63,252, 48, 63,252, 48, 31,252, 41,160,  0,  0, 63,252, 12, 48,
+     12, 60, 63,224, 63,240,  0,  0,  7,224, 63,252, 31,248, 48, 12,
+     31,248, 42, 80,  0,  0,127,  0,  3,128,  1,128, 41, 80,  0,  0,
+    127,  0, 25,128, 43,128,  0,  0, 96, 96, 97,128, 62, 59,128,  0,
+      0, 63,128, 48, 49,128, 30, 58,192,  0,  0,119,128,102,102, 51,
+    128, 46,176,  0,  0,127,  1,128, 63, 96, 63,128, 63,128,  0,  0,
+    127,128, 97,128, 99,128, 62, 63,128,  0,  0, 97,128,127,128, 99,
+    128, 62, 63,128,  0,  0,109,128,127,128,109,128, 62, 43,192,  0,
+      0, 30, 51, 97,128, 97,128, 43,192,  0,  0, 54,111,217,128,217,
+    128, 47,224,  0,  0, 30,115,128, 97,128,115,128, 30, 46,192,  0,
+      0,127, 15,128, 59, 97,128, 46,192,  0,  0,127, 27,128, 59,109,
+    128, 43,176,  0,  0, 12,127, 15,128, 59, 97,128, 47,224,  0,  0,
+    127,  3,128, 63,128,  1,128,  3, 59,176,  0,  0,127,128, 96,127,
+    128, 96, 63,128, 58,192,  0,  0,127,128, 51, 51,127,128, 46,224,
+      0,  0, 12,127,128, 63, 97,128, 63, 37, 86,149, 80,  0, 24,  0,
+     31,  0, 24, 37, 86,149, 80,  0, 54,  0, 62,  0, 54, 37,105,105,
+     80,  0, 24,  0, 31,  0, 24,  0, 31,  0, 24, 37,105,105, 80,  0,
+     54,  0, 62,  0, 54,  0, 62,  0, 54, 37, 86,149, 80,  0, 12,  0,
+    124,  0, 12, 37, 86,149, 80,  0, 54,  0,246,  0, 54, 37,105,105,
+     80,  0, 12,  0,124,  0, 12,  0,124,  0, 12, 37,105,105, 80,  0,
+     54,  0,246,  0, 54,  0,246,  0, 54,  0,  2, 85,128,  1,128,127,
+    254, 37, 86,149,160,  0, 24, 12, 31, 12, 24,127,248,  0, 24, 37,
+     86,149,160,  0, 54, 12, 62, 12, 54,127,246,  0, 54, 37, 86, 85,
+    160,  0, 12, 12, 12,127,252,  0, 12,  0,  2, 85,128,  6, 96,127,
+    254,  0,  0, 41, 80,127,254,  1,128, 37, 85,170, 80,  0, 12,127,
+    252, 12, 12, 12,252, 12, 12, 37, 85,170, 80,  0, 54,127,246, 12,
+     54, 12,246, 12, 54, 37, 85,165, 80,  0, 12,127,252, 12, 12,  0,
+      0, 41, 80,127,254, 12, 48,  0,  0,  0,192,127,254, 37, 85, 85,
+    160,  0, 12,127,252,  0, 12, 37, 85, 85, 80,  0, 12,  0,  0, 37,
+    128,  1,128,127,254, 37, 86,165,160,  0, 24,  0, 31,  0, 24, 12,
+     24,127,248,  0, 24, 37, 86,165,160,  0, 54,  0, 62,  0, 54, 12,
+     54,127,246,  0, 54, 37, 85,101,160,  0, 12, 12, 12,127,252,  0,
+     12,  0,  0, 37,128, 12, 48,127,254, 37,165,  0,  0,  0, 24,  0,
+     31,  0, 24, 37,165,  0,  0,  0, 54,  0, 62,  0, 54, 21, 85,  0,
+      0, 24, 24, 31, 24, 31, 24, 24, 21, 85,  0,  0, 54, 54, 62, 54,
+     62, 54, 54, 37,165,  0,  0,  0, 12,  0,124,  0, 12, 37,165,  0,
+      0,  0, 54,  0,246,  0, 54, 21, 85,  0,  0, 12, 12,124, 12,124,
+     12, 12, 21, 85,  0,  0, 54, 54,246, 54,246, 54, 54,  0,150,  0,
+      0,  1,128,127,254, 37,166,128,  0,  0, 24,  0, 31, 12, 24,127,
+    248,  0, 24, 37,166,128,  0,  0, 54,  0, 62, 12, 54,127,246,  0,
+     54, 37,102,128,  0,  0, 12,  6, 12,127,252,  0, 12,  0,150,  0,
+      0,  6, 96,127,254,  0,  2,144,  0,127,254,  1,128, 37, 90,128,
+      0,  0, 12,127,252, 12,124, 12, 12, 37, 90,128,  0,  0, 54,127,
+    246, 12,246, 12, 54, 37, 90, 64,  0,  0, 12,127,252, 12, 12,  0,
+      2,144,  0,127,254, 12, 48,  0,  3,  0,  0,127,254, 37, 86,128,
+      0,  0, 12,127,252,  0, 12, 37, 85,  0,  0,  0, 12,  0, 38,  0,
+      0,  1,128,127,254, 37,102,128,  0,  0, 12, 12, 12,127,252,  0,
+     12,  0, 38,  0,  0, 12, 48,127,254,  0,  0, 53, 80, 63,240, 56,
+     24, 24, 24,  0,  0, 41, 80, 63,240,  3, 24,  0,  0, 42, 80, 62,
+     24,  3, 60,  3,102,  0,  0, 37,160, 48,  0, 48, 24, 31,224,  0,
+      0, 63,240, 49,240, 48, 56, 48, 96, 48,240, 31,152,  0,  0, 63,
+    240, 48, 96, 49,248, 48,240, 49,152, 30,240,  0,  0, 58,240, 63,
+    248, 48, 48, 48, 24, 31,224,  0,  0, 55,176, 63,240, 24, 31,240,
+     48, 31,248,  0,  0, 63,240, 60,240,  6, 24, 28, 24, 48, 24, 30,
+     24,  0,  0, 63,240, 60,248,  6,216, 28,216, 48,216, 30,120,  0,
+      0, 63,240, 60,216,  6,216, 28,248, 48,216, 30,120,  0,  0, 63,
+    240, 60, 48,  6,120, 28,204, 48,204, 30,204,  0,  0, 63,240, 60,
+    248,  6,192, 28,248, 48,192, 30,120,  0,  0, 63,240, 63,248,  7,
+    176, 29,176, 49,176, 31,248,  0,  0, 63,240, 60, 96,  7,248, 28,
+    240, 49,152, 30,240,  0,  0, 41,160, 63,248, 48, 24, 48, 56, 31,
+    224,  0,  0, 38,160, 48, 24, 63,248, 48, 56, 31,224,  0,  0, 63,
+    240, 54, 48, 54,120, 62,204, 54,236, 30,204,  0,  0, 42,144,  7,
+    128, 28,224, 48, 48, 96, 24,  0,  0, 42, 80, 14,240, 25,152, 51,
+     12,  0,  0, 63,240, 15,224, 56, 56, 48, 24, 56, 56, 15,224,  0,
+      0, 63,240,127,192,  3,224,  7,128, 28,224, 96, 24,  0,  0, 47,
+    252,  6,127,192,  3,224,  7,128, 28,224, 96, 24,  0,  0, 55, 80,
+     63,240, 56, 31,248, 24, 24,  0,  0, 59,176, 63,248, 48, 63,248,
+     48, 31,248,  0,  0, 41,160, 63,248, 12, 96, 12,120, 63,224,  0,
+      0,170, 96,  3,128, 63,248, 31,240, 48, 24, 31,240,  0,  0, 53,
+     80, 63,248, 28, 12, 12, 12,  0,  0, 41, 80, 62,248,  3, 12,  0,
+      0, 37,160, 48,  0, 48, 12, 31,240,  0,  0, 63,240, 48,248, 48,
+     28, 48, 48, 48,120, 31,204,  0,  0, 63,240, 48,112, 49,252, 48,
+    248, 49,140, 30,248,  0,  0, 58,240, 63,252, 48, 48, 48, 12, 31,
+    240,  0,  0, 55,176, 63,248, 12, 31,248, 48, 31,252,  0,  0, 63,
+    240, 62,120,  3, 12, 30, 12, 48, 12, 31, 12,  0,  0, 63,240, 60,
+    252,  6,204, 28,204, 48,204, 30,124,  0,  0, 63,240, 60,204,  6,
+    204, 28,252, 48,204, 30,124,  0,  0, 63,240, 62, 24,  3, 60, 30,
+    102, 48,102, 31,102,  0,  0, 63,240, 62,124,  3, 96, 30,124, 48,
+     96, 31, 60,  0,  0, 63,240, 63,252,  6,216, 28,216, 48,216, 31,
+    252,  0,  0, 63,240, 62, 48,  3,252, 30,120, 48,204, 31,120,  0,
+      0, 41,160, 63,252, 48, 12, 48, 28, 31,240,  0,  0, 38,160, 48,
+     12, 63,252, 48, 28, 31,240,  0,  0, 63,240, 51, 24, 51, 60, 63,
+    102, 51,102, 31,102,  0,  0, 42,144,  3,192, 14,112, 24, 24, 48,
+     12,  0,  0, 42, 80,  6,112, 29,220, 51,  6,  0,  0, 63,240, 15,
+    240, 56, 28, 48, 12, 56, 28, 15,240,  0,  0, 55,240, 63,240,248,
+      3,192, 14,112, 48, 12,  0,  0, 45,252,  3, 63,240,248,  3,192,
+     14,112, 48, 12,  0,  0, 55, 80, 63,248, 28, 31,252, 12, 12,  0,
+      0, 59,176, 63,252, 48, 63,248, 48, 31,252,  0,  0, 41,160, 63,
+    252, 12, 48, 12, 60, 63,240,  0,  0, 63,240,  3,192, 63,252, 31,
+    248, 48, 12, 31,248,  0,  0, 53, 80, 63,252, 14,  6,  6,  6,  0,
+      0, 41, 80, 62,252,  3,  6,  0,  0, 37,160, 48,  0, 48,  6, 31,
+    248,  0,  0, 63,240, 48,124, 48, 14, 48, 24, 48, 60, 31,102,  0,
+      0, 63,240, 48, 56, 48,254, 48,124, 48,198, 31,124,  0,  0, 58,
+    240, 63,254, 48, 48, 48,  6, 31,248,  0,  0, 55,176, 63,252,  6,
+     31,252, 48, 31,254,  0,  0, 63,240, 62,124,  3,  6, 30,  6, 48,
+      6, 31,  6,  0,  0, 63,240, 62,126,  3,102, 30,102, 48,102, 31,
+     62,  0,  0, 63,240, 62,102,  3,102, 30,126, 48,102, 31, 62,  0,
+      0, 63,240, 62,126,  3, 96, 30,126, 48, 96, 31, 62,  0,  0, 63,
+    240, 63,254,  3,108, 30,108, 48,108, 31,254,  0,  0, 63,240, 62,
+     56,  3,254, 30,124, 48,198, 31,124,  0,  0, 41,160, 63,254, 48,
+      6, 48, 14, 31,248,  0,  0, 38,160, 48,  6, 63,254, 48, 14, 31,
+    248,  0,  0, 63,240, 51, 24, 51, 60, 63,102, 51,102, 31,230,  0,
+      0, 42,144,  3,224, 14, 56, 24, 12, 48,  6,  0,  0, 63,240, 15,
+    248, 56, 14, 48,  6, 56, 14, 15,248,  0,  0, 55,240, 63,240,248,
+      3, 96, 14, 56, 56, 14,  0,  0, 61,252,  1,128, 63,240,248,  3,
+     96, 14, 56, 56, 14,  0,  0, 55, 80, 63,252, 14, 31,254,  6,  6,
+      0,  0, 59,176, 63,254, 48, 63,254, 48, 31,254,  0,  0, 41,160,
+     63,254, 12, 24, 12, 30, 63,248,  0,  0, 63,240,  3,224, 63,254,
+     31,252, 48,  6, 31,252,  0,  0, 42, 80, 62, 48,  3,120,  3,204,
+      0,  0, 63,240, 62,248,  3, 12, 30, 12, 48, 12, 31, 12,  0,  0,
+     63,240, 62, 48,  3,120, 30,204, 48,204, 31,204,  0,  0, 63,240,
+     51, 48, 51,120, 63,204, 51,204, 31,204,  0,  0, 42, 80,  6, 96,
+     29,248, 51, 12,  0,  0, 55,240, 63,224,240,  3,192, 14,112, 48,
+     12,  0,  0, 45,252,  3, 63,224,240,  3,192, 14,112, 48, 12,  0,
+      0, 59,176, 63,252, 48, 63,252, 48, 31,252,
+};
+
+// offset
+static const font_prow_t FontHangul_Hansoft_meta[360] = {
+    { 0x00000000 }, { 0x00000004 }, { 0x80000013 }, { 0x80000021 }, { 0x8000002B }, { 0x80000037 }, { 0x00000043 }, { 0x80000052 },
+    { 0x8000005E }, { 0x8000006C }, { 0x8000007A }, { 0x80000088 }, { 0x80000092 }, { 0x000000A0 }, { 0x000000B1 }, { 0x000000C5 },
+    { 0x000000D7 }, { 0x000000E6 }, { 0x800000F5 }, { 0x80000101 }, { 0x00000000 }, { 0x80000113 }, { 0x8000011D }, { 0x80000125 },
+    { 0x8000012F }, { 0x8000013B }, { 0x00000147 }, { 0x80000156 }, { 0x80000162 }, { 0x80000170 }, { 0x8000017E }, { 0x8000018A },
+    { 0x80000194 }, { 0x000001A2 }, { 0x000001B2 }, { 0x000001C4 }, { 0x000001D5 }, { 0x000001E2 }, { 0x800001F1 }, { 0x000001FD },
+    { 0x00000000 }, { 0x80000113 }, { 0x8000011D }, { 0x8000020F }, { 0x00000219 }, { 0x80000225 }, { 0x00000231 }, { 0x8000023D },
+    { 0x80000249 }, { 0x80000255 }, { 0x80000261 }, { 0x8000026D }, { 0x80000277 }, { 0x00000285 }, { 0x00000293 }, { 0x000002A3 },
+    { 0x000001D5 }, { 0x000002B2 }, { 0x800002BE }, { 0x000002CA }, { 0x00000000 }, { 0x800002DC }, { 0x800002E6 }, { 0x800002EE },
+    { 0x800002F8 }, { 0x80000304 }, { 0x00000310 }, { 0x8000031E }, { 0x8000032A }, { 0x80000338 }, { 0x80000346 }, { 0x80000350 },
+    { 0x0000035A }, { 0x00000368 }, { 0x00000374 }, { 0x00000382 }, { 0x0000038F }, { 0x0000039F }, { 0x800003AC }, { 0x000003B8 },
+    { 0x00000000 }, { 0x800003C7 }, { 0x800003D1 }, { 0x000003D9 }, { 0x000003E3 }, { 0x000003EE }, { 0x000003F9 }, { 0x80000404 },
+    { 0x80000410 }, { 0x8000041C }, { 0x80000428 }, { 0x80000432 }, { 0x0000043C }, { 0x00000448 }, { 0x00000452 }, { 0x0000045E },
+    { 0x80000469 }, { 0x00000475 }, { 0x80000481 }, { 0x0000048B }, { 0x00000000 }, { 0x80000498 }, { 0x800004A2 }, { 0x800004AA },
+    { 0x800004B4 }, { 0x800004C0 }, { 0x000004CC }, { 0x800004DA }, { 0x800004E6 }, { 0x800004F4 }, { 0x80000502 }, { 0x8000050C },
+    { 0x00000516 }, { 0x00000524 }, { 0x00000374 }, { 0x00000530 }, { 0x0000053D }, { 0x00000548 }, { 0x80000556 }, { 0x00000562 },
+    { 0x00000000 }, { 0x80000571 }, { 0x8000057B }, { 0x80000583 }, { 0x0000058D }, { 0x80000599 }, { 0x000005A5 }, { 0x800005B1 },
+    { 0x800005BD }, { 0x800005C9 }, { 0x800005D5 }, { 0x800005DF }, { 0x000005E9 }, { 0x000005F7 }, { 0x00000604 }, { 0x00000612 },
+    { 0x00000620 }, { 0x0000062C }, { 0x80000638 }, { 0x00000644 }, { 0x00000000 }, { 0x80000652 }, { 0x8000065C }, { 0x00000664 },
+    { 0x0000066D }, { 0x00000677 }, { 0x00000681 }, { 0x0000068C }, { 0x00000697 }, { 0x000006A2 }, { 0x000006AD }, { 0x000006B7 },
+    { 0x000006C1 }, { 0x000006CD }, { 0x000006D7 }, { 0x000006E1 }, { 0x000006EC }, { 0x000006F8 }, { 0x00000704 }, { 0x0000070E },
+    { 0x00000000 }, { 0x80000719 }, { 0x80000723 }, { 0x8000072D }, { 0x8000073B }, { 0x80000749 }, { 0x80000753 }, { 0x8000075D },
+    { 0x8000076B }, { 0x80000779 }, { 0x80000781 }, { 0x8000078F }, { 0x8000079D }, { 0x800007A9 }, { 0x800007B1 }, { 0x800007B9 },
+    { 0x800007C7 }, { 0x800007D5 }, { 0x800007DF }, { 0x000007E7 }, { 0x800007ED }, { 0x800007F7 }, { 0x00000000 }, { 0x80000719 },
+    { 0x80000723 }, { 0x8000072D }, { 0x8000073B }, { 0x80000749 }, { 0x80000753 }, { 0x8000075D }, { 0x8000076B }, { 0x800007FD },
+    { 0x80000805 }, { 0x80000815 }, { 0x80000825 }, { 0x80000831 }, { 0x800007B1 }, { 0x800007B9 }, { 0x800007C7 }, { 0x800007D5 },
+    { 0x800007DF }, { 0x000007E7 }, { 0x800007ED }, { 0x800007F7 }, { 0x00000000 }, { 0x80000839 }, { 0x80000843 }, { 0x0000084D },
+    { 0x00000858 }, { 0x80000863 }, { 0x8000086D }, { 0x00000877 }, { 0x00000882 }, { 0x8000088D }, { 0x80000895 }, { 0x800008A3 },
+    { 0x800008B1 }, { 0x800008BD }, { 0x800008C5 }, { 0x800008CD }, { 0x800008D9 }, { 0x800008E5 }, { 0x800008EF }, { 0x000008F7 },
+    { 0x800008FD }, { 0x80000907 }, { 0x00000000 }, { 0x80000839 }, { 0x80000843 }, { 0x0000084D }, { 0x00000858 }, { 0x80000863 },
+    { 0x8000086D }, { 0x00000877 }, { 0x00000882 }, { 0x8000090D }, { 0x80000895 }, { 0x800008A3 }, { 0x80000915 }, { 0x80000921 },
+    { 0x800008C5 }, { 0x800008CD }, { 0x800008D9 }, { 0x800008E5 }, { 0x800008EF }, { 0x000008F7 }, { 0x800008FD }, { 0x80000907 },
+    { 0x00000000 }, { 0x00000929 }, { 0x80000933 }, { 0x8000093B }, { 0x80000945 }, { 0x0000094F }, { 0x0000095D }, { 0x0000096B },
+    { 0x00000977 }, { 0x00000983 }, { 0x00000991 }, { 0x0000099F }, { 0x000009AD }, { 0x000009BB }, { 0x000009C9 }, { 0x000009D7 },
+    { 0x800009E5 }, { 0x800009F1 }, { 0x000009FD }, { 0x80000A0B }, { 0x80000A17 }, { 0x00000A21 }, { 0x00000A2F }, { 0x00000A3D },
+    { 0x00000A4C }, { 0x00000A57 }, { 0x80000A63 }, { 0x80000A6F }, { 0x00000000 }, { 0x00000A7D }, { 0x80000A87 }, { 0x8000093B },
+    { 0x80000A8F }, { 0x00000A99 }, { 0x00000AA7 }, { 0x00000AB5 }, { 0x00000AC1 }, { 0x00000ACD }, { 0x00000ADB }, { 0x00000AE9 },
+    { 0x00000AF7 }, { 0x00000B05 }, { 0x00000B13 }, { 0x00000B21 }, { 0x80000B2F }, { 0x80000B3B }, { 0x00000B47 }, { 0x80000B55 },
+    { 0x80000B61 }, { 0x00000B6B }, { 0x00000B79 }, { 0x00000B86 }, { 0x00000B94 }, { 0x00000B9F }, { 0x80000BAB }, { 0x00000BB7 },
+    { 0x00000000 }, { 0x00000BC5 }, { 0x80000BCF }, { 0x8000093B }, { 0x80000BD7 }, { 0x00000BE1 }, { 0x00000BEF }, { 0x00000BFD },
+    { 0x00000C09 }, { 0x00000C15 }, { 0x00000C23 }, { 0x00000C31 }, { 0x00000AF7 }, { 0x00000C3F }, { 0x00000C4D }, { 0x00000C5B },
+    { 0x80000C69 }, { 0x80000C75 }, { 0x00000C81 }, { 0x80000C8F }, { 0x80000B61 }, { 0x00000C9B }, { 0x00000CA9 }, { 0x00000CB6 },
+    { 0x00000CC5 }, { 0x00000CD0 }, { 0x80000CDC }, { 0x00000CE8 }, { 0x00000000 }, { 0x00000A7D }, { 0x80000A87 }, { 0x80000CF6 },
+    { 0x80000A8F }, { 0x00000A99 }, { 0x00000AA7 }, { 0x00000AB5 }, { 0x00000AC1 }, { 0x00000D00 }, { 0x00000ADB }, { 0x00000AE9 },
+    { 0x00000D0E }, { 0x00000B05 }, { 0x00000B13 }, { 0x00000B21 }, { 0x80000B2F }, { 0x80000B3B }, { 0x00000D1C }, { 0x80000B55 },
+    { 0x80000D2A }, { 0x00000B6B }, { 0x00000D34 }, { 0x00000D41 }, { 0x00000B94 }, { 0x00000D4F }, { 0x80000BAB }, { 0x00000BB7 },
+};
+
+const font_hangul_t FontHangul_Hansoft = {
+    "FontHangul_Hansoft", FontHangul_Hansoft_meta, NULL, FontHangul_Hansoft_rows, NULL
+};
@@ -0,0 +1,303 @@
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+// Generated by tools/fontc. Do not edit. (make fonts)
+//[*]--------------------------------------------------------------------------------------------------------------[*]
+#include <stddef.h>
+#include "../../lib_fb.h"
+#include "../../lib_font.h"
+
+// FontHangul_Myeongjo : 360 glyphs, 11520 -> 3834 bytes (+ 1440 bytes meta)
+static const unsigned char FontHangul_Myeongjo_rows[3834] = {
+      0,  0,  0,  0,  0,250,170,  0, 63,128, 17,128,  3,  6, 12, 24,
+     48, 64,  0,254,170,  0, 63,128, 13,128, 13,128, 27, 27, 54, 76,
+     16,  0,170,186,  0, 96, 48, 48, 48, 48, 48,128, 63, 28,  2,170,
+    186,  0,  2,127, 48, 48, 48, 48, 48,128, 63, 28,  0,165,106,  0,
+    127,128, 54,  0, 54, 64, 63,128, 27,  0,  0,170,186,  0,127, 35,
+      2,126, 48, 48,128, 63, 28,  0,170,170,  0,127, 51, 51, 51, 51,
+     50, 63, 32,  2,170,170,  0,  6, 99, 51, 51, 63, 51, 51, 63, 34,
+      0,166,154,  0,219,  0,109,128,127,128,109,128,127,128, 73,  0,
+      2,170,190,  0,  4,  6,  6,  6,  6, 15, 25,128, 49,128, 64,  0,
+    170,190,  0, 18, 27, 27, 27, 63,109,128,141,128, 16,  0,170,168,
+      0, 28, 62, 99, 99, 99, 62, 28,  0,250,190,  0, 63,128, 17,128,
+      3,  6, 15, 25,128, 49,128, 64,  0,254,190,  0,127,128, 45,128,
+     13,128, 27, 63,109,128,217,128, 16, 10, 42,170,  0, 12,  6, 63,
+     19,  6, 12, 31, 51, 64,  0,234,170,  0, 63,128,  3,127, 38, 12,
+     24, 48, 64,  2,170,186,  0,  2,127, 48, 50, 63, 48, 48,128, 63,
+     28,  2,170,250,  0,  2,127,  4, 38, 54,  4, 64,  9,128,127, 32,
+     10,186,168,  0, 24, 12,  5,127,128, 44, 30, 51, 51, 30,  3,213,
+     80,  0, 31,240, 12, 48, 48, 48, 48, 32, 64,  2,150,128,  0, 62,
+    248,  6, 24,  4, 16,  8, 32,  2,175,  0,  0, 24, 12, 12, 12, 16,
+      7,248,  7,175,  0,  0, 32, 63,240, 24, 24, 24, 32, 15,240,  2,
+    154,  0,  0, 63,248, 24,192, 25,208, 14,120,  3,123,192,  0, 15,
+    240, 48, 31,224, 12, 12, 32,  7,240,  3,255,128,  0, 31,240, 12,
+    112, 12, 96, 12, 64, 15,224,  8,  7,255,192,  0, 96, 24, 48, 12,
+     48, 15,240, 12, 48, 15,240,  8, 32,  3,255,192,  0, 51, 48, 25,
+    152, 31,248, 25,152, 31,248, 17, 16, 11,239,128,  0,  1,  1,128,
+      1,128,  3,  7,240, 12, 56, 48, 10,106,128,  0,  2, 64,  3, 96,
+      6,192, 15,240, 27, 56, 36,  0,  2,150,  0,  0,  7,192, 12, 96,
+      7,192,  3,255,128,  0, 15,224,  1,192,  3,128,  6,240, 12, 56,
+     16,  3,255,128,  0, 31,240, 11, 96,  6,192, 15,224, 27, 56, 36,
+     11,255,224,  0,  3,  1,128, 31,240,  1,224,  3,128,  6,240, 24,
+     56, 32,  3,223, 80,  0, 31,240,  8, 48,112, 31,176, 12, 48, 32,
+     64,  7,187,192,  0, 32, 31,240, 12, 15,240, 12, 12, 32,  7,240,
+      7,255,128,  0, 32, 31,248, 12, 96,  6, 96,  6,192, 31,248,  8,
+     10,169,128,  0,  3,  0,  1,144, 31,248, 11,192,  6, 96,  3,192,
+     15, 84,  0,  0, 31,240,  8, 48, 48, 32, 64, 10,104,  0,  0, 31,
+    248,  3, 24,  2, 16,  4, 32, 10,240,  0,  0, 24, 12, 12, 32,  7,
+    240, 30,176,  0,  0, 32, 31,240, 12, 12,  7,240, 10, 96,  0,  0,
+     63,240, 25,128, 14,240, 13,236,  0,  0, 15,240, 48, 31,224, 12,
+      7,240, 15,248,  0,  0, 31,240, 12,112, 12, 96, 15,224,  8, 15,
+    252,  0,  0, 24,192, 12, 96, 15,224, 12, 96, 15,224, 15,252,  0,
+      0, 27, 96, 13,176, 15,240, 13,176, 15,240, 47,248,  0,  0,  1,
+      1,128,  1,128,  3,240,  6, 56, 24, 41,168,  0,  0,  4, 64,  6,
+     96, 15,248, 25,152, 34,  0, 10, 88,  0,  0,  3,192,  6, 96,  3,
+    192, 15,248,  0,  0, 15,224,  3,192,  7,112, 12, 56, 48, 15,248,
+      0,  0, 31,248,  6, 96, 15,248, 25,156, 34, 47,248,  0,  0,  3,
+      1,128, 31,240,  1,192, 15,120, 56, 15,125,  0,  0, 15,240,  4,
+     48,240, 15, 48,  4, 32, 64, 14,236,  0,  0, 31,240, 12, 15,240,
+     12,  7,240, 31,248,  0,  0, 16, 31,248,  6, 96,  6, 96, 31,248,
+      8, 47,252,  0,  0,  3,  1,160, 15,240,  3,192,  6, 96,  3,192,
+      0,255,160,  0, 63,128, 17,128,  1,128,  1,128,  1,  2,  0,254,
+    128,  0,127,128, 25,128, 25,128, 17, 34,  0,171,  0,  0, 96, 48,
+     49, 31,128,  2,235,  0,  0,  1,127,128, 48, 49, 31,128,  0,235,
+      0,  0,255,128,102,110,119,128,  0,250,192,  0, 63,128,  1,128,
+    127, 48, 31,128,  0,250,128,  0,127,128, 49,128, 49, 63, 32,  2,
+    254,128,  0, 99, 49,128, 63,128, 49,128, 63, 32,  2,254,128,  0,
+    219,109,128,127,128,109,128,127, 64, 10,175,128,  0,  4,  6,  6,
+     12, 31,128, 49,128, 64,  2,175,128,  0, 18, 27, 27, 63,128,109,
+    128,144,  0,190,  0,  0, 31, 49,128, 49,128, 31,  0,175,128,  0,
+     63, 12, 31,128, 49,128, 64,  0,239,128,  0, 63,128, 27, 63,128,
+     77,128, 16,  2,171,224,  0, 12,  4, 63, 14, 27,128, 49,128, 64,
+      0,255,160,  0, 63,128,  1,128, 63,128,  1,128,  1,  2,  2,238,
+    192,  0,  1,127,128, 48, 63,128, 48, 31,128,  2,170,128,  0,  2,
+    127, 36, 54, 20,127,  2,186,128,  0, 28, 12,127,128, 30, 51, 30,
+      3,250,  0,  0, 63,128,  1,128,  1,128,  1,  2,  3,250,  0,  0,
+    127,128, 25,128, 25,128, 17, 34,  2,172,  0,  0, 48, 24, 25, 15,
+    128, 11,172,  0,  0,  1, 63,128, 24, 25, 15,128,  3,172,  0,  0,
+    127,128, 54, 54, 27,128, 15,172,  0,  0, 31,128,  1,128, 63, 24,
+     15,128,  3,234,  0,  0, 63,128, 25,128, 25, 31, 16, 11,250,  0,
+      0, 51, 25,128, 31,128, 25,128, 31, 16, 11,250,  0,  0,219,109,
+    128,127,128,109,128,127, 72, 10,190,  0,  0, 12, 12, 12, 31,128,
+     49,128, 64, 10,190,  0,  0, 18, 27, 27, 31,128, 45,128, 72,  2,
+    168,  0,  0, 30, 51, 51, 30, 10,190,  0,  0, 31,  3,  6, 15,128,
+     25,128, 32, 15,188,  0,  0, 63,128, 13,128, 27, 63,192,108,192,
+     43,190,  0,  0, 12,  6, 63,128,  4, 15,128, 25,128, 96,  3,254,
+    128,  0, 31,128,  1,128, 31,128,  1,128,  1,  2,  3,187,  0,  0,
+     63,128, 24, 31,128, 24, 15,128, 14,174,  0,  0, 63,128, 18, 11,
+     10, 63,128, 16, 10,234,  0,  0, 12,  6, 63,128, 14, 27, 14,  2,
+    170,160,  0, 63,  3,  6, 12, 24, 48, 64,  3,234,128,  0, 63,128,
+     13,128, 27, 54,108,  8,  2,170,128,  0, 96, 48, 48, 49, 62, 24,
+     10,171,128,  0,  2,127, 48, 48, 48, 51,128, 30,  3,174,  0,  0,
+    127,128, 54, 54, 63,128, 27,  2,171,128,  0, 63,  3,126, 48, 49,
+    128, 30,  2,170,128,  0,127, 51, 51, 50, 62, 32, 10,170,128,  0,
+    102, 51, 63, 51, 51, 62, 32,  2,254,128,  0,219,109,128,127,128,
+    109,128,127, 68, 10,170,128,  0,  4,  6,  6, 12, 30, 51, 65, 10,
+    171,128,  0,  2, 19, 27, 27, 63, 77,128, 16,  2,170,  0,  0, 30,
+     51, 51, 51, 30,  2,170,128,  0, 63,  6, 12, 30, 51, 64,  3,235,
+    128,  0, 63,128,  9,128, 27, 63, 77,128, 16, 10,170,128,  0, 24,
+     12, 62, 12, 30, 51, 64,  2,170,160,  0, 63,  3,126, 12, 24, 48,
+     64,  2,171,128,  0,127, 48, 62, 48, 49,128, 30, 10,174,128,  0,
+      2,127, 36, 54, 21,128,126, 32, 10,170,128,  0, 24, 12,127, 28,
+     54, 54, 28, 15, 84,  0,  0, 15,240,  4, 48, 48, 32, 64, 15,240,
+      0,  0, 62,248,  6, 24,  4, 16,  8, 32, 10,240,  0,  0, 12,  6,
+      6, 32,  3,240, 14,176,  0,  0, 15,240,  6,  6,  3,240, 15,240,
+      0,  0, 31,240, 13,128, 13,160,  6,240, 13,236,  0,  0,  7,240,
+     48, 15,224,  6,  3,224, 15,248,  0,  0, 15,240,  6, 48,  6, 32,
+      7,224,  4, 15,254,  0,  0, 12, 96,  6, 48,  7,240,  6, 48,  7,
+    224,  4, 15,252,  0,  0, 27, 96, 13,176, 15,240, 13,176, 15,224,
+     47,248,  0,  0,  1,  1,128,  3,128,  7,240, 12, 56, 48, 41,168,
+      0,  0,  4, 64,  6, 96, 12,192, 31,248, 51, 24, 10, 96,  0,  0,
+      3,192,  6, 96,  3,192, 15,248,  0,  0, 15,224,  1,192,  3,240,
+     14, 56, 48, 15,252,  0,  0, 31,240,  6, 96, 12,192, 31,248, 35,
+     24, 47,252,  0,  0,  3,  1,128, 31,240,  3,192, 14,120, 56, 24,
+     13,213,  0,  0, 15,240, 48, 31,240, 48, 32, 64, 14,236,  0,  0,
+     15,224,  6,  7,224,  6,  3,224, 15,240,  0,  0, 15,240,  6, 96,
+      2,192, 15,240, 47,252,  0,  0,  3,  1,128, 15,240,  3,192,  6,
+     96,  3,192, 10,160,  0,  0, 63, 19,  3,  2, 15,232,  0,  0,127,
+    128, 25,128, 25,128, 17, 34, 10,176,  0,  0, 48, 24, 25, 15,128,
+     11,176,  0,  0,  1, 63,128, 24, 15,128, 14,176,  0,  0,127,128,
+     54, 54, 27,128, 10,184,  0,  0, 31,  3, 62, 24,128, 15, 10,168,
+      0,  0, 63, 27, 26, 30, 16, 10,170,  0,  0, 54, 27, 31, 27, 30,
+     16, 11,250,  0,  0,219,109,128,127,128,109,128,127, 64, 42,248,
+      0,  0,  4,  6,  6, 15,128, 25,128, 96, 42,248,  0,  0,  2, 19,
+     27, 31,128, 45,128, 80, 10,160,  0,  0, 14, 27, 27, 14, 10,248,
+      0,  0, 31,  6, 15,128, 25,128, 96, 14,248,  0,  0, 63,128, 27,
+     31,128, 45,128, 80, 43,188,  0,  0, 12,  6, 31,128,  7, 13,128,
+     48,128, 10,168,  0,  0, 63,  3, 63,  3,  2, 10,168,  0,  0, 63,
+     24, 31, 24, 15, 14,232,  0,  0, 63,128, 27, 10,128, 63, 24, 43,
+    168,  0,  0, 12,  6, 63,128, 14, 27, 14, 41, 90,149, 88,  0, 48,
+      0, 24,  0, 26,  0, 31,  0, 24,  0, 16, 21, 85, 85, 84, 12,102,
+     54, 54, 54, 62, 54, 54, 54, 54, 54, 54, 38,  4, 21, 85, 85, 84,
+     48, 24, 24, 24, 26, 31, 24, 26, 31, 24, 24, 24, 24, 16, 21, 85,
+     85, 84, 12,102, 54, 54, 62, 54, 54, 62, 54, 54, 54, 54, 38,  4,
+     41, 86,149, 88,  0, 24,  0, 12,  0,252,  0, 12,  0,  8, 42, 86,
+    149,104,  0, 12,  0,102,  0, 54,  1,246,  0, 54,  0, 38,  0,  4,
+     21, 85, 85, 84, 24, 12, 12, 12,252, 12, 12,252, 12, 12, 12, 12,
+     12,  8, 21,117,213, 84, 12,102, 54, 54,  1,246, 54, 54,  1,246,
+     54, 54, 54, 54, 38,  4,  0,  2,171,224,  2,  3,  3,  3,  3, 12,
+    127,254, 32, 21, 85,255,212, 48, 24, 24, 24, 24, 24, 26, 24, 31,
+     24, 56, 24,216,127, 24, 48, 24, 24, 16, 21, 87,255,212, 12,102,
+     54, 54, 54, 54, 16, 54, 24, 62, 24,118, 25,182,126, 54, 48, 54,
+     38,  4, 41, 85,170,168,  0, 24,  0, 12, 24, 12, 24, 44, 24,204,
+    127, 12, 48, 12,  0, 12,  0,  8,  0,  0,191,224,  9, 13,128, 13,
+    128, 13,140,127,254, 32,  0,  2,169, 88,  0, 12,127,254, 33,128,
+      1,128,  1,  0, 21, 85,127,244, 24, 12, 12, 12, 12, 12, 28,108,
+    127,140, 54,252,  6, 76,  6, 12,  4, 12,  8, 21, 85,255,244, 12,
+    102, 54, 54, 54, 54,118,  1,182,126, 54, 45,246, 12,182, 12, 54,
+      8, 38,  4, 41, 86,170,104,  0, 24,  0, 12,  0, 28,  0,108,127,
+    140, 54, 12,  6, 12,  4, 12,  0,  8,  0,  2,169, 88,  0, 12,127,
+    254, 38, 96,  6, 96,  4, 64,  0,  0,  1,224, 12,127,254, 32, 21,
+     85, 87,212, 24, 12, 12, 12, 12, 12, 12, 12, 44,204,127, 12, 48,
+     12, 12,  8, 41, 85, 85, 88,  0, 24,  0, 12,  0,  8,  0,  0,191,
+    224,  1,  1,128,  1,128,  1,140,127,254, 32, 21, 85,255,212, 48,
+     24, 24, 24, 24, 24, 26, 12, 31, 12, 56, 12,216,127, 24, 48, 24,
+     24, 16, 21, 85,255,212, 12,102, 54, 54, 54, 54, 54, 12, 62, 12,
+    118, 13,182,126, 54, 48, 54, 38,  4, 41, 85,170,168,  0, 24,  0,
+     12, 12, 12, 12, 44, 12,204,127, 12, 48, 12,  0, 12,  0,  8,  0,
+      0,166,160,  4,128,  6,192,  6,204,127,254, 32,  0, 21, 85, 64,
+      0, 48, 24, 24, 24, 31, 24, 24, 16, 21, 85, 64,  0, 12,102, 54,
+     62, 54, 54, 54, 36, 21, 85, 64,  0, 48, 24, 24, 31, 24, 31, 24,
+     16, 21, 85, 64,  0, 12,102, 54, 62, 54, 62, 54, 36, 21, 85, 64,
+      0, 24, 12, 12, 12,252, 12, 12,  8, 21,117, 64,  0, 12,102, 54,
+     54,  1,246, 54, 54, 36, 21, 85, 64,  0, 24, 12, 12,252, 12,252,
+     12,  8, 21, 85, 64,  0, 12,102, 54,246, 54,246, 54, 36,  0, 47,
+    128,  0,  3,  3, 12,127,254, 32, 21,127,240,  0, 48, 24, 24, 26,
+     16, 31, 24, 56, 24,216,127, 24, 48, 16, 21,127,244,  0, 12,102,
+     54, 54, 16, 62, 24,118, 25,182,126, 54, 48, 38,  4, 21,127,244,
+      0, 24, 12, 12, 12, 24, 12, 24,108, 25,140,126, 12, 48, 12,  8,
+      0, 63,128,  0, 13,128, 13,140,127,254, 32,  0,  7,248,  0, 12,
+    127,254, 33,128,  1,128,  1, 21, 95,240,  0, 24, 12, 12, 44,204,
+    127, 12, 44,124, 12, 12,  8,  8, 21, 95,240,  0, 12,102, 54, 54,
+    182,127, 54, 54,246,  6, 54,  4, 36, 21, 95,240,  0, 24, 12, 12,
+     44,204,127, 12, 54, 12,  6, 12,  4,  8,  0,  7,252,  0, 12,127,
+    254, 35, 96,  3, 96,  2, 64,  0,  7,128,  0, 12,127,254, 32, 21,
+     87,240,  0, 24, 12, 12, 12, 12,108,  1,140,126, 12, 48,  8, 41,
+     85,128,  0,  0, 24,  0, 12,  0,  8, 21, 85, 64,  0, 12,102, 54,
+     54, 62, 54, 54, 36,  0, 15,224,  0,  1,128,  1,140,127,254, 32,
+     21,127,240,  0, 48, 24, 24, 26, 12, 31, 12, 56, 12,216,127, 24,
+     48, 16, 21,127,240,  0, 12,102, 54, 54, 12, 62, 12,118, 13,182,
+    126, 38, 48,  4, 21,127,240,  0, 24, 12, 12, 12, 12, 12, 12,108,
+     13,140,126, 12, 48,  8,  0, 15,224,  0,  6,192,  6,204,127,254,
+     32, 21, 87,248,  0, 24, 12, 12, 12, 44,204,127,124, 54, 12,  6,
+      8,  4, 21, 87,248,  0, 12,102, 54, 54, 54,182,127, 54, 54,246,
+      6, 36,  4, 21, 87,248,  0, 24, 12, 12, 12, 44,204,127, 12, 54,
+     12,  6,  8,  4,  0,  1,224,  0, 12,127,254, 32,  0,  0, 15, 84,
+     15,248,  4, 24, 24, 24, 16,  0,  0, 10, 88, 31,248,  3, 24,  2,
+     16,  0,  0, 15,252, 31, 48,  3, 48,  3, 56,  3,108,  2,204,  0,
+      0, 10,188,  6,  3,  3,  3,  8,  1,252,  0,  0, 10,104, 24,124,
+     12, 24, 13,188,  7,102,  0,  0, 31,252, 48, 24, 24, 12,124, 12,
+     56, 13,108,  7, 56,  0,  0, 30,188, 16, 15,248,  6,  6,  6, 16,
+      3,248,  0,  0, 13,236,  7,248, 24,  7,240,  6,  3,248,  0,  0,
+     15,252, 15,252,  1,140, 15, 12, 12,204,  7,136,  0,  0, 15,252,
+     15,252,  1,236, 15,108, 12,108,  7,252,  0,  0, 15,252, 15,204,
+      1,236, 15,124, 12,108,  7,252,  0,  0, 15,252, 15,152,  1,152,
+     15, 24, 12,188,  7,102,  0,  0, 15,252, 15,252,  1,224, 15,120,
+     12, 96,  7,188,  0,  0, 15,252, 15,252,  1,168, 15, 40, 12,168,
+      7,124,  0,  0, 31,252, 48, 15,152,  1,252, 15, 56, 12,236,  7,
+     56,  0,  0, 10,104,  7,248,  3, 24,  3, 16,  3,248,  0,  0, 31,
+    252, 48,  6, 24,  3, 24,  3,248,  3, 24,  3,248,  0,  0, 15,252,
+      9,152, 13,152, 15,152, 13,190, 15,230,  0,  0, 21,254,128,192,
+    192,  1,224,  3, 56,  6, 24,  8,  0,  0, 41,168,  2, 32,  3, 48,
+      7,240, 12,220, 25,140,  0,  0, 10, 88,  1,240,  3, 24,  1,240,
+      0,  0, 13,254,  7,240,192,  1,224,  3, 56,  6, 24,  8,  0,  0,
+     55,254,  1,128,192,  7,240,  1,192,  3,120,  6, 24,  8,  0,  0,
+     13,244,  7,248, 24,  7,248,  2, 24, 16,  0,  0, 14,236,  7,248,
+      3,  3,248,  3,  1,248,  0,  0, 15,252,  7,248,  2, 32,  3, 48,
+      3, 96,  7,248,  0,  0, 55,252,  1,128,192,  7,248,  1,224,  3,
+     48,  1,224,  0,  0, 15, 84,  7,252,  2, 12, 12, 12,  8,  0,  0,
+     10, 88, 15,252,  1,140,  1,  8,  0,  0, 15,252, 15,152,  1,152,
+      1,156,  1,182,  1,102,  0,  0, 11,244,  3,  1,128,  1,128,  1,
+    132,254,  0,  0, 10,104, 12, 62,  6, 12,  6,222,  3,179,  0,  0,
+     31,252, 24, 12, 12,  6, 62,  6, 28,  6,182,  3,156,  0,  0, 30,
+    188,  8,  7,252,  3,  3,  3,  8,  1,252,  0,  0, 13,236,  7,248,
+     24,  7,248,  6,  3,248,  0,  0, 13,252,  7,254,198,  7,134,  6,
+    102,  3,196,  0,  0, 13,252,  7,254,246,  7,182,  6, 54,  3,254,
+      0,  0, 29,252, 24,  7,204,254,  7,156,  6,118,  3,156,  0,  0,
+     10,104,  3,252,  1,140,  1,136,  1,252,  0,  0, 21,126, 64, 96,
+     96,240,  1,156,  3, 12,  4,  0,  0, 41,168,  1, 16,  1,152,  3,
+    248,  6,110, 12,198,  0,  0, 10, 88,  0,248,  1,140,  0,248,  0,
+      0, 13,126,  3,248, 96,240,  1,156,  3, 12,  4,  0,  0, 23,126,
+    192, 96,  3,248,224,  1,188,  3, 12,  4,  0,  0, 13,244,  3,252,
+     12,  3,252,  1, 12,  8,  0,  0, 15,244,  3,252,  1,128,  1,252,
+      1,128,252,  0,  0, 15,252,  3,252,  1, 16,  1,152,  1,176,  3,
+    252,  0,  0, 23,116,192, 96,  3,252,240,  1,152,240,  0,  0, 13,
+     84,  7,254,198,198,198,132,  0,  0, 31,244,  4,  3,254,  1,128,
+      1,128,  1,132,254,  0,  0, 13,236,  3,252, 12,  3,252,  3,  1,
+    252,  0,  0, 13,252,  7,230,246,  7,190,  6, 54,  3,254,  0,  0,
+     13,252,  7,204,204,  7,140,  6, 94,  3,179,  0,  0, 13,252,  7,
+    254,240,  7,188,  6, 48,  3,222,  0,  0, 13,252,  7,254,212,  7,
+    148,  6, 84,  3,190,  0,  0, 31,252, 24,  3, 12,  1,140,  1,252,
+      1,140,  1,252,  0,  0, 15,252,  4,204,  6,204,  7,204,  6,223,
+      7,243,  0,  0, 15, 84, 15,240,  4, 48, 48, 48, 32,  0,  0, 10,
+     88, 15,240,  3, 48,  2, 32,  0,  0, 10,188, 12,  6,  6,  6, 16,
+      3,248,  0,  0, 10,104, 24,248, 12, 48, 13,120,  6,204,  0,  0,
+     31,252, 96, 24, 48, 12,248, 12,112, 12,216,  7,112,  0,  0,  7,
+    188, 32, 15,240,  6,  6, 32,  3,240,  0,  0, 13,236,  7,240, 48,
+      7,224,  6,  3,240,  0,  0, 15,252, 31,248,  3, 24, 30, 24, 25,
+    152, 15, 16,  0,  0, 15,252, 31,248,  3,216, 30,216, 24,216, 15,
+    248,  0,  0, 15,252, 31,152,  3,216, 30,248, 24,216, 15,248,  0,
+      0, 15,252, 31, 48,  3, 48, 30, 48, 25,120, 14,204,  0,  0, 15,
+    252, 31,248,  3,192, 30,240, 24,192, 15,120,  0,  0, 15,252, 31,
+    248,  3, 80, 30, 80, 25, 80, 14,248,  0,  0, 31,252, 96, 31, 48,
+      3,248, 30,112, 25,216, 14,112,  0,  0, 10,104, 15,240,  6, 48,
+      6, 32,  7,240,  0,  0, 31,252, 96, 12, 48,  6, 48,  7,240,  6,
+     48,  7,240,  0,  0, 15,252, 18, 48, 27, 48, 31, 48, 27,124, 30,
+    204,  0,  0,  9,168,  1,128,  3,192,  6,112, 28, 48,  0,  0, 41,
+    168,  4, 64,  6, 96, 15,224, 25,184, 51, 24,  0,  0, 10, 88,  3,
+    192,  6, 96,  3,192,  0,  0, 13,244, 15,240,112, 15,176,  6, 48,
+     32,  0,  0, 14,236, 15,240,  6,  7,240,  6,  3,240,  0,  0, 15,
+    252, 15,240,  4, 64,  6, 96,  6,192, 15,240,  0,  0, 47,252,  3,
+      1,128, 15,240,  3,192,  6, 96,  3,192,
+};
+
+// offset
+static const font_prow_t FontHangul_Myeongjo_meta[360] = {
+    { 0x00000000 }, { 0x00000004 }, { 0x00000012 }, { 0x00000021 }, { 0x0000002E }, { 0x8000003C }, { 0x0000004A }, { 0x00000057 },
+    { 0x00000063 }, { 0x80000070 }, { 0x00000080 }, { 0x0000008F }, { 0x0000009D }, { 0x000000A8 }, { 0x000000B8 }, { 0x000000C9 },
+    { 0x000000D6 }, { 0x000000E3 }, { 0x000000F1 }, { 0x00000100 }, { 0x00000000 }, { 0x0000010E }, { 0x8000011B }, { 0x00000127 },
+    { 0x00000132 }, { 0x8000013F }, { 0x0000014B }, { 0x00000159 }, { 0x00000168 }, { 0x00000179 }, { 0x00000189 }, { 0x80000198 },
+    { 0x800001A8 }, { 0x000001B2 }, { 0x000001C1 }, { 0x000001D0 }, { 0x000001E2 }, { 0x000001F1 }, { 0x00000200 }, { 0x80000210 },
+    { 0x00000000 }, { 0x00000220 }, { 0x8000022B }, { 0x00000237 }, { 0x00000241 }, { 0x8000024C }, { 0x00000256 }, { 0x00000262 },
+    { 0x0000026F }, { 0x0000027D }, { 0x0000028B }, { 0x80000299 }, { 0x800002A7 }, { 0x000002B1 }, { 0x000002BE }, { 0x000002CB },
+    { 0x000002D9 }, { 0x000002E7 }, { 0x000002F3 }, { 0x00000301 }, { 0x00000000 }, { 0x00000310 }, { 0x0000031E }, { 0x0000032A },
+    { 0x00000333 }, { 0x0000033E }, { 0x00000348 }, { 0x00000354 }, { 0x0000035F }, { 0x0000036C }, { 0x00000379 }, { 0x00000386 },
+    { 0x00000392 }, { 0x0000039C }, { 0x000003A7 }, { 0x000003B3 }, { 0x000003C0 }, { 0x000003CE }, { 0x000003DB }, { 0x000003E5 },
+    { 0x00000000 }, { 0x000003F0 }, { 0x000003FC }, { 0x00000408 }, { 0x00000411 }, { 0x0000041C }, { 0x00000426 }, { 0x00000432 },
+    { 0x0000043D }, { 0x0000044A }, { 0x00000457 }, { 0x00000463 }, { 0x0000046F }, { 0x00000477 }, { 0x00000483 }, { 0x00000490 },
+    { 0x0000049E }, { 0x000004AC }, { 0x000004B8 }, { 0x000004C4 }, { 0x00000000 }, { 0x000004CF }, { 0x000004DA }, { 0x000004E6 },
+    { 0x000004F0 }, { 0x000004FC }, { 0x00000507 }, { 0x00000512 }, { 0x0000051C }, { 0x00000527 }, { 0x00000534 }, { 0x0000053F },
+    { 0x0000054B }, { 0x00000554 }, { 0x0000055E }, { 0x0000056B }, { 0x00000576 }, { 0x00000581 }, { 0x0000058C }, { 0x00000598 },
+    { 0x00000000 }, { 0x000005A3 }, { 0x000005AE }, { 0x000005BA }, { 0x000005C4 }, { 0x000005CE }, { 0x000005DA }, { 0x000005E6 },
+    { 0x000005F3 }, { 0x00000602 }, { 0x00000610 }, { 0x8000061E }, { 0x8000062C }, { 0x00000636 }, { 0x00000643 }, { 0x00000651 },
+    { 0x00000660 }, { 0x0000066C }, { 0x00000678 }, { 0x00000684 }, { 0x00000000 }, { 0x00000693 }, { 0x0000069B }, { 0x000006A7 },
+    { 0x000006B0 }, { 0x000006BA }, { 0x000006C4 }, { 0x000006CE }, { 0x000006D7 }, { 0x000006E1 }, { 0x000006EE }, { 0x000006FA },
+    { 0x00000706 }, { 0x0000070E }, { 0x00000719 }, { 0x00000725 }, { 0x00000732 }, { 0x0000073B }, { 0x00000744 }, { 0x0000074F },
+    { 0x00000000 }, { 0x8000075A }, { 0x0000076A }, { 0x0000077C }, { 0x0000078E }, { 0x800007A0 }, { 0x800007AE }, { 0x000007C0 },
+    { 0x000007D2 }, { 0x000007E6 }, { 0x000007F3 }, { 0x0000080A }, { 0x80000822 }, { 0x00000838 }, { 0x80000846 }, { 0x00000854 },
+    { 0x0000086B }, { 0x80000883 }, { 0x80000899 }, { 0x000008A7 }, { 0x000008AF }, { 0x800008C3 }, { 0x00000000 }, { 0x8000075A },
+    { 0x0000076A }, { 0x0000077C }, { 0x0000078E }, { 0x800007A0 }, { 0x800007AE }, { 0x000007C0 }, { 0x000007D2 }, { 0x000008CD },
+    { 0x000008DB }, { 0x000008F2 }, { 0x80000909 }, { 0x8000091F }, { 0x80000846 }, { 0x00000854 }, { 0x0000086B }, { 0x80000883 },
+    { 0x80000899 }, { 0x000008A7 }, { 0x000008AF }, { 0x800008C3 }, { 0x00000000 }, { 0x0000092D }, { 0x00000939 }, { 0x00000945 },
+    { 0x00000951 }, { 0x0000095D }, { 0x00000969 }, { 0x00000976 }, { 0x00000982 }, { 0x0000098E }, { 0x00000998 }, { 0x000009AA },
+    { 0x000009BD }, { 0x000009D0 }, { 0x000009DB }, { 0x000009E7 }, { 0x000009F8 }, { 0x00000A09 }, { 0x00000A1A }, { 0x00000A27 },
+    { 0x00000A2F }, { 0x80000A3F }, { 0x00000000 }, { 0x0000092D }, { 0x00000A49 }, { 0x00000945 }, { 0x00000951 }, { 0x0000095D },
+    { 0x00000969 }, { 0x00000976 }, { 0x00000982 }, { 0x00000A55 }, { 0x00000A60 }, { 0x00000A72 }, { 0x00000A84 }, { 0x00000A96 },
+    { 0x000009DB }, { 0x00000AA1 }, { 0x00000AB2 }, { 0x00000AC3 }, { 0x00000A1A }, { 0x00000AD4 }, { 0x00000A2F }, { 0x80000A3F },
+    { 0x00000000 }, { 0x00000ADC }, { 0x80000AE7 }, { 0x00000AF1 }, { 0x00000AFF }, { 0x80000B0A }, { 0x00000B16 }, { 0x00000B25 },
+    { 0x00000B32 }, { 0x00000B3E }, { 0x00000B4C }, { 0x00000B5A }, { 0x00000B68 }, { 0x00000B76 }, { 0x00000B84 }, { 0x00000B92 },
+    { 0x80000BA1 }, { 0x00000BAD }, { 0x00000BBC }, { 0x00000BCA }, { 0x80000BD8 }, { 0x80000BE6 }, { 0x00000BF0 }, { 0x00000BFE },
+    { 0x00000C0E }, { 0x00000C1A }, { 0x00000C26 }, { 0x00000C34 }, { 0x00000000 }, { 0x00000C43 }, { 0x80000C4E }, { 0x00000C58 },
+    { 0x00000C66 }, { 0x80000C72 }, { 0x00000C7E }, { 0x00000C8D }, { 0x00000C9A }, { 0x00000CA6 }, { 0x00000CB3 }, { 0x00000B5A },
+    { 0x00000B68 }, { 0x00000B76 }, { 0x00000B84 }, { 0x00000CC0 }, { 0x80000CCE }, { 0x00000BAD }, { 0x00000BBC }, { 0x00000CDA },
+    { 0x80000CE7 }, { 0x80000CF5 }, { 0x00000CFF }, { 0x00000D0C }, { 0x00000D1A }, { 0x00000D26 }, { 0x00000D33 }, { 0x00000D41 },
+    { 0x00000000 }, { 0x00000C43 }, { 0x00000D4D }, { 0x00000C58 }, { 0x00000C66 }, { 0x80000C72 }, { 0x00000C7E }, { 0x00000D57 },
+    { 0x00000D65 }, { 0x00000CA6 }, { 0x00000CB3 }, { 0x00000D71 }, { 0x00000D7E }, { 0x00000D8B }, { 0x00000D98 }, { 0x00000CC0 },
+    { 0x80000CCE }, { 0x00000DA5 }, { 0x00000DB4 }, { 0x00000CDA }, { 0x80000CE7 }, { 0x80000CF5 }, { 0x00000CFF }, { 0x00000D0C },
+    { 0x00000D1A }, { 0x00000D26 }, { 0x00000D33 }, { 0x00000D41 }, { 0x00000000 }, { 0x00000DC2 }, { 0x80000DCD }, { 0x00000AF1 },
+    { 0x00000DD7 }, { 0x80000DE2 }, { 0x00000DEE }, { 0x00000DFD }, { 0x00000E09 }, { 0x00000E15 }, { 0x00000E23 }, { 0x00000E31 },
+    { 0x00000E3F }, { 0x00000E4D }, { 0x00000E5B }, { 0x00000E69 }, { 0x80000E78 }, { 0x00000E84 }, { 0x00000E93 }, { 0x80000EA1 },
+    { 0x80000EAD }, { 0x80000EBB }, { 0x00000BF0 }, { 0x00000BFE }, { 0x00000EC5 }, { 0x00000ED1 }, { 0x00000EDD }, { 0x00000EEB },
+};
+
+const font_hangul_t FontHangul_Myeongjo = {
+    "FontHangul_Myeongjo", FontHangul_Myeongjo_meta, NULL, FontHangul_Myeongjo_rows, NULL
+};
@@ -25,48 +25,123 @@
 #include <sys/mman.h>
 #include <linux/fb.h>
 #include <getopt.h>
+#include <pthread.h>
 
 #include "lib_fb.h"
+#include "lib_font.h"
+
 //-----------------------------------------------------------------------------
-// Fonts
+// Unicode glyph index
+// code point 범위별 glyph 위치와 화면상 크기(cells, ASCII 문자 단위).
+// 표에 없는 code는 ASCII face(font_glyph)에서 찾으며 1 cell을 차지한다.
 //-----------------------------------------------------------------------------
-#include "fonts/FontHangul.h"
-#include "fonts/FontHansoft.h"
-#include "fonts/FontHanboot.h"
-#include "fonts/FontHangodic.h"
-#include "fonts/FontHanpil.h"
-#include "fonts/FontHangodic.h"
-#include "fonts/FontAscii_8x16.h"
+enum eTEXT_SRC {
+    eTEXT_SRC_FACE = 0,     // font_face_t (font_glyph)
+    eTEXT_SRC_HANGUL,       // 조합형 한글 (get_hangul_image)
+    eTEXT_SRC_END
+};
+
+typedef struct text_range__t {
+    unsigned int    lo, hi;
+    unsigned char   src, cells;
+}   text_range_t;
+
+//-----------------------------------------------------------------------------
+// glyph 1 byte(8 bit) -> 8 pixel 변환 table (f_color, b_color, fb 형식 별)
+// 확대하지 않는 glyph는 row의 byte 단위로 table의 pixel을 그대로 복사한다.
+// ctx 별로 최근 사용한 TEXT_LUT_MAX개의 색 조합을 가진다.
+//-----------------------------------------------------------------------------
+#define TEXT_LUT_MAX    4
+
+typedef struct text_lut_entry__t {
+    int             valid, f_color, b_color, bpp, is_bgr;
+    unsigned char   pixel[256][8 * 4];
+}   text_lut_entry_t;
+
+struct text_lut__t {
+    int                 next;
+    text_lut_entry_t    e[TEXT_LUT_MAX];
+};
 
 //-----------------------------------------------------------------------------
 // Function prototype define.
 //-----------------------------------------------------------------------------
-static void make_image  (unsigned char is_first,
-                        unsigned char *dest,
-                        unsigned char *src);
-static unsigned char *get_hangul_image( unsigned char HAN1,
-                                        unsigned char HAN2,
-                                        unsigned char HAN3);
-static void draw_hangul_bitmap (fb_info_t *fb,
-                    int x, int y, unsigned char *p_img,
+static unsigned char *get_hangul_image( fb_text_t *ctx, unsigned int code, int rot90);
+static void _pixel_bytes   (fb_info_t *fb, int color, unsigned char *pixel);
+static void _fill_span     (fb_info_t *fb, int x, int y, int w, int color);
+static int  _copy_span_row (fb_info_t *fb, int x, int y_src, int y_dst, int w);
+static void _fill_phys     (fb_info_t *fb, int px, int py, int w, int color);
+static int  _copy_phys_row (fb_info_t *fb, int px, int py_src, int py_dst, int w);
+static int  _get_phys      (fb_info_t *fb, int px, int py);
+static const text_lut_entry_t *_text_lut (fb_info_t *fb, fb_text_t *ctx,
+                    int f_color, int b_color);
+static void draw_bitmap_lut (fb_info_t *fb, const text_lut_entry_t *lut,
+                    int px, int py, const unsigned char *p_img, int w, int h);
+static void draw_bitmap    (fb_info_t *fb, fb_text_t *ctx, int phys,
+                    int x, int y, const unsigned char *p_img, int w, int h,
+                    int f_color, int b_color, int scale);
+static void draw_smooth_bitmap (fb_info_t *fb, int phys,
+                    int x, int y, const unsigned short *runs, int h,
+                    int f_color, int b_color);
+static void _draw_glyph (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                    const void *font, unsigned int code,
+                    const unsigned char *p_img, int w, int h,
                     int f_color, int b_color, int scale);
-static void draw_ascii_bitmap (fb_info_t *fb,
-                    int x, int y, unsigned char *p_img,
+static void _draw_glyph_rot (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                    const void *font, unsigned int code,
+                    const unsigned char *p_rot, int w, int h,
                     int f_color, int b_color, int scale);
-static void _draw_text (fb_info_t *fb, int x, int y, char *p_str,
+static void _draw_text (fb_info_t *fb, fb_text_t *ctx, int x, int y, char *p_str,
                         int f_color, int b_color, int scale);
+static int  _draw_ntext (fb_info_t *fb, fb_text_t *ctx, int x, int y, const char *p_str,
+                        int len, int f_color, int b_color, int scale);
+static int  _utf8_decode    (const unsigned char *p, unsigned int *code);
+static const text_range_t *_text_range (unsigned int code);
+static int  _text_next      (const unsigned char *p, int *cells);
+static void _draw_box       (fb_info_t *fb, int x, int y, int w, int h,
+                            int f_color, int b_color, int unit);
+static void _phys_xy        (fb_info_t *fb, int x, int y, int *cal_x, int *cal_y);
+static int  _get_pixel      (fb_info_t *fb, int x, int y);
 static void _put_pixel      (fb_info_t *fb, int x, int y, int color);
 static void _put_pixel_1bpp (fb_info_t *fb, int x, int y, int color);   // ssd3306 OLED
 void         put_pixel      (fb_info_t *fb, int x, int y, int color);
 
+static char *_text_vformat  (char *buf, int size, char *fmt, va_list va, char **p_alloc);
 void         draw_text (fb_info_t *fb, int x, int y,
                      int f_color, int b_color, int scale, char *fmt, ...);
-void         make_draw_text (char *img_buf, int w, int h, int bpp,
+void         draw_vtext (fb_info_t *fb, int x, int y,
+                     int f_color, int b_color, int scale, char *fmt, va_list va);
+void         draw_text_r (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                     int f_color, int b_color, int scale, char *fmt, ...);
+void         draw_vtext_r (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                     int f_color, int b_color, int scale, char *fmt, va_list va);
+int          make_draw_text (char *img_buf, int w, int h, int bpp,
                      int f_color, int b_color, int scale, char *fmt, ...);
+int          make_draw_vtext (char *img_buf, int w, int h, int bpp,
+                     int f_color, int b_color, int scale, char *fmt, va_list va);
+static int  _sprite_render  (fb_info_t *fb, fb_text_t *ctx, text_sprite_t *sp);
+text_sprite_t *sprite_text (fb_info_t *fb, fb_text_t *ctx, text_sprite_t *sp,
+                     int f_color, int b_color, int scale, const char *str);
+void         sprite_blit (fb_info_t *fb, fb_text_t *ctx, text_sprite_t *sp, int x, int y);
+void         sprite_free (text_sprite_t *sp);
+int          text_next (const char *p, int *cells);
+int          text_decode (const char *p, unsigned int *code);
+int          text_cells (const char *str);
+int          text_measure (const char *str, int scale, int *w, int *h);
+int          text_fit_scale (int w, int h, int lw, int cells);
+static int  _text_line_cut  (const char *p, int len, int max_cells, int *cells);
+int          text_layout (const char *str, int scale, int w, int h, int flags,
+                            text_layout_t *lay);
+void         draw_layout_r (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                            int f_color, int b_color, const char *str,
+                            const text_layout_t *lay);
 void         draw_line (fb_info_t *fb, int x, int y, int w, int color);
 void         draw_rect (fb_info_t *fb, int x, int y, int w, int h, int lw, int color);
 void         draw_fill_rect (fb_info_t *fb, int x, int y, int w, int h, int color);
 void         set_font(enum eFONTS_HANGUL s_font);
+void         set_font_smooth (char enable);
+void         text_ctx_init (fb_text_t *ctx, int f_type, int smooth);
+void         text_ctx_free (fb_text_t *ctx);
 void         fb_clear (fb_info_t *fb);
 void         fb_close (fb_info_t *fb);
 int          fb_get_rotate (fb_info_t *fb);
@@ -76,15 +151,63 @@ fb_info_t    *fb_init (const char *DEVICE_NAME);
 //-----------------------------------------------------------------------------
 // hangul image base 16x16
 //-----------------------------------------------------------------------------
-static unsigned char HANFontImage[32] = {0,};
-
 const char D_ML[22] = { 0, 0, 2, 0, 2, 1, 2, 1, 2, 3, 0, 2, 1, 3, 3, 1, 2, 1, 3, 3, 1, 1 																	};
 const char D_FM[40] = { 1, 3, 0, 2, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 0, 2, 1, 3, 1, 3, 1, 3 			};
 const char D_MF[44] = { 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 1, 6, 3, 7, 3, 7, 3, 7, 1, 6, 2, 6, 4, 7, 4, 7, 4, 7, 2, 6, 1, 6, 3, 7, 0, 5 };
 
-static unsigned char *HANFONT1 = (unsigned char *)FONT_HANGUL1;
-static unsigned char *HANFONT2 = (unsigned char *)FONT_HANGUL2;
-static unsigned char *HANFONT3 = (unsigned char *)FONT_HANGUL3;
+// 초성, 중성, 종성 font table (enum eFONTS_HANGUL 순서, fonts/gen/*.c)
+static const font_hangul_t *HANFONT[eFONT_END] = {
+    &FontHangul_Myeongjo,
+    &FontHangul_Hanboot,
+    &FontHangul_Hangodic,
+    &FontHangul_Hanpil,
+    &FontHangul_Hansoft,
+};
+
+// context에서 -1로 설정된 경우 사용하는 기본값 (set_font, set_font_smooth)
+static volatile int DefaultFont   = eFONT_HAN_DEFAULT;
+static volatile int DefaultSmooth = 0;
+
+// 내장 Hangul font(eFONTS_HANGUL) 또는 font_load로 추가된 font(eFONT_END + n)
+static const font_hangul_t *_han_font (int f_type)
+{
+    if (f_type >= eFONT_END)
+        return font_hangul (f_type);
+    return (f_type >= 0) ? HANFONT[f_type] : NULL;
+}
+
+#define CTX_FONT(ctx)   (((ctx)->f_type < 0) || (_han_font ((ctx)->f_type) == NULL) ? \
+                            DefaultFont : (ctx)->f_type)
+#define CTX_SMOOTH(ctx) (((ctx)->smooth < 0) ? DefaultSmooth : (ctx)->smooth)
+
+// 90/270도 회전 화면 (화면 좌표의 가로줄이 실제 메모리에서는 세로줄이 된다)
+#define FB_ROT_SIDE(fb) (((fb)->rotate == eFB_ROTATE_90) || ((fb)->rotate == eFB_ROTATE_270))
+// 실제 메모리(panel)의 가로/세로 크기
+#define FB_PHYS_W(fb)   (FB_ROT_SIDE(fb) ? (fb)->h : (fb)->w)
+#define FB_PHYS_H(fb)   (FB_ROT_SIDE(fb) ? (fb)->w : (fb)->h)
+
+// lo 오름차순 정렬 (겹치는 범위 없음), East Asian Wide 문자는 2 cells
+static const text_range_t TextRange[] = {
+    { 0x01100, 0x0115F, eTEXT_SRC_FACE,   2 },  // Hangul Jamo (초성)
+    { 0x02E80, 0x0303E, eTEXT_SRC_FACE,   2 },  // CJK Radicals ~ CJK Symbols
+    { 0x03041, 0x033FF, eTEXT_SRC_FACE,   2 },  // Hiragana ~ CJK Compatibility
+    { 0x03400, 0x04DBF, eTEXT_SRC_FACE,   2 },  // CJK Extension A
+    { 0x04E00, 0x09FFF, eTEXT_SRC_FACE,   2 },  // CJK Unified Ideographs
+    { 0x0A000, 0x0A4CF, eTEXT_SRC_FACE,   2 },  // Yi
+    { 0x0AC00, 0x0D7A3, eTEXT_SRC_HANGUL, 2 },  // Hangul Syllables (가 ~ 힣)
+    { 0x0F900, 0x0FAFF, eTEXT_SRC_FACE,   2 },  // CJK Compatibility Ideographs
+    { 0x0FE30, 0x0FE4F, eTEXT_SRC_FACE,   2 },  // CJK Compatibility Forms
+    { 0x0FF00, 0x0FF60, eTEXT_SRC_FACE,   2 },  // Fullwidth Forms
+    { 0x0FFE0, 0x0FFE6, eTEXT_SRC_FACE,   2 },
+    { 0x20000, 0x3FFFD, eTEXT_SRC_FACE,   2 },  // CJK Extension B ~
+};
+
+// TextRange에 없는 문자
+static const text_range_t TextRangeNarrow = { 0, 0, eTEXT_SRC_FACE, 1 };
+
+#define TEXT_RANGE_CNT  (int)(sizeof(TextRange) / sizeof(TextRange[0]))
+// 잘못된 UTF-8 sequence (U+FFFD REPLACEMENT CHARACTER)
+#define TEXT_BAD_CODE   0xFFFD
 
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -93,35 +216,30 @@ static unsigned char *HANFONT3 = (unsigned char *)FONT_HANGUL3;
 volatile int NumberOfVFB = 0;   // VFB cnt
 
 //-----------------------------------------------------------------------------
+// code = Unicode 한글 음절 (U+AC00 ~ U+D7A3)
+// rot90 설정시 font의 90도 회전 table(fontc -r)로 조합한다. (회전된 glyph를 조합한 것과 같음)
 //-----------------------------------------------------------------------------
-static void make_image  (unsigned char is_first,
-                        unsigned char *dest,
-                        unsigned char *src)
+static unsigned char *get_hangul_image( fb_text_t *ctx, unsigned int code, int rot90)
 {
-    int i;
-    if (is_first)   for (i = 0; i < 32; i++)    dest[i]  = src[i];
-    else            for (i = 0; i < 32; i++)    dest[i] |= src[i];
-}
+    const font_hangul_t *font = _han_font (CTX_FONT(ctx));
 
-//-----------------------------------------------------------------------------
-static unsigned char *get_hangul_image( unsigned char HAN1,
-                                        unsigned char HAN2,
-                                        unsigned char HAN3)
-{
+    if (rot90 && font->rot90)
+        font = font->rot90;
     unsigned char f, m, l;
     unsigned char f1, f2, f3;
-    unsigned char first_flag = 1;
-    unsigned short utf16 = 0;
+    unsigned int utf16 = code - 0xAC00;
 
-    /*------------------------------
-    UTF-8 을 UTF-16으로 변환한다.
+    memset(ctx->img, 0, sizeof(ctx->img));
 
-    UTF-8 1110xxxx 10xxxxxx 10xxxxxx
-    ------------------------------*/
-    utf16 = ((unsigned short)HAN1 & 0x000f) << 12 |
-            ((unsigned short)HAN2 & 0x003f) << 6  |
-            ((unsigned short)HAN3 & 0x003f);
-    utf16 -= 0xAC00;
+    /* 한글 음절(가 ~ 힣) 이외의 문자는 빈칸 */
+    if (utf16 >= FONT_HANGUL_SYLLABLES)
+        return ctx->img;
+
+    /* 완성형 glyph가 있는 font (fontc -c) */
+    if (font->syllable) {
+        font_hangul_or (font, font->syllable, utf16, ctx->img);
+        return ctx->img;
+    }
 
     /* 초성 / 중성 / 종성 분리 */
     l = (utf16 % 28);
@@ -134,12 +252,12 @@ static unsigned char *get_hangul_image( unsigned char HAN1,
     f2 = D_FM[(f * 2) + (l != 0)];
     f1 = D_MF[(m * 2) + (l != 0)];
 
-    memset(HANFontImage, 0, sizeof(HANFontImage));
-    if (f)  {   make_image(         1, HANFontImage, HANFONT1 + (f1*16 + f1 *4 + f) * 32);    first_flag = 0; }
-    if (m)  {   make_image(first_flag, HANFontImage, HANFONT2 + (        f2*22 + m) * 32);    first_flag = 0; }
-    if (l)  {   make_image(first_flag, HANFontImage, HANFONT3 + (f3*32 - f3 *4 + l) * 32);    first_flag = 0; }
+    if (f)  font_hangul_or (font, font->jamo, (f1*20 + f), ctx->img);
+    if (m)  font_hangul_or (font, font->jamo, (f2*22 + m) + FONT_HANGUL_F_CNT, ctx->img);
+    if (l)  font_hangul_or (font, font->jamo, (f3*28 + l) + FONT_HANGUL_F_CNT + FONT_HANGUL_M_CNT,
+                            ctx->img);
 
-    return HANFontImage;
+    return ctx->img;
 }
 
 //-----------------------------------------------------------------------------
@@ -177,31 +295,65 @@ static void _put_pixel_1bpp (fb_info_t *fb, int x, int y, int color)
     *(fb->data + offset) = data;
 }
 
+//-----------------------------------------------------------------------------
+static void _phys_xy (fb_info_t *fb, int x, int y, int *cal_x, int *cal_y)
+{
+    switch (fb->rotate) {
+        default:
+        case eFB_ROTATE_0:
+            *cal_x = x;
+            *cal_y = y;
+            break;
+        case eFB_ROTATE_90:
+            *cal_x = fb->h -y -1;
+            *cal_y = x;
+            break;
+        case eFB_ROTATE_180:
+            *cal_x = fb->w -x -1;
+            *cal_y = fb->h -y -1;
+            break;
+        case eFB_ROTATE_270:
+            *cal_x = y;
+            *cal_y = fb->w -x -1;
+            break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// 화면 좌표(x, y)의 color 값을 읽는다. (smooth glyph의 투명 배경 합성용)
+//-----------------------------------------------------------------------------
+static int _get_pixel (fb_info_t *fb, int x, int y)
+{
+    int cal_x, cal_y;
+
+    _phys_xy (fb, x, y, &cal_x, &cal_y);
+    return _get_phys (fb, cal_x, cal_y);
+}
+
+//-----------------------------------------------------------------------------
+// 실제 메모리 좌표(px, py)의 color 값
+//-----------------------------------------------------------------------------
+static int _get_phys (fb_info_t *fb, int px, int py)
+{
+    fb_color_u c;
+    unsigned char *p;
+
+    p = (unsigned char *)fb->data + (py * fb->stride) + (px * (fb->bpp >> 3));
+
+    c.uint = 0;
+    c.bits.r = fb->is_bgr ? p[2] : p[0];
+    c.bits.g = p[1];
+    c.bits.b = fb->is_bgr ? p[0] : p[2];
+    return c.uint;
+}
+
 //-----------------------------------------------------------------------------
 void put_pixel (fb_info_t *fb, int x, int y, int color)
 {
     if ((x < fb->w) && (y < fb->h)) {
         int cal_x, cal_y;
 
-        switch (fb->rotate) {
-            default:
-            case eFB_ROTATE_0:
-                cal_x = x;
-                cal_y = y;
-                break;
-            case eFB_ROTATE_90:
-                cal_x = fb->h -y -1;
-                cal_y = x;
-                break;
-            case eFB_ROTATE_180:
-                cal_x = fb->w -x -1;
-                cal_y = fb->h -y -1;
-                break;
-            case eFB_ROTATE_270:
-                cal_x = y;
-                cal_y = fb->w -x -1;
-                break;
-        }
+        _phys_xy (fb, x, y, &cal_x, &cal_y);
         if (fb->bpp != 1)
             _put_pixel (fb, cal_x, cal_y, color);
         else
@@ -213,143 +365,994 @@ void put_pixel (fb_info_t *fb, int x, int y, int color)
 }
 
 //-----------------------------------------------------------------------------
-static void draw_hangul_bitmap (fb_info_t *fb,
-                    int x, int y, unsigned char *p_img,
+// color -> framebuffer pixel (bpp / 8 bytes)
+//-----------------------------------------------------------------------------
+static void _pixel_bytes (fb_info_t *fb, int color, unsigned char *pixel)
+{
+    fb_color_u c;
+
+    c.uint = color;
+    pixel[0] = fb->is_bgr ? c.bits.b : c.bits.r;
+    pixel[1] = c.bits.g;
+    pixel[2] = fb->is_bgr ? c.bits.r : c.bits.b;
+    pixel[3] = 0xFF;
+}
+
+//-----------------------------------------------------------------------------
+// 화면 좌표(x, y)에서 시작하는 가로 w 픽셀을 color로 채운다. (화면 밖은 잘라냄)
+// 회전 상태에 따라 실제 메모리에서는 가로(0/180) 또는 세로(90/270) 방향이 된다.
+//-----------------------------------------------------------------------------
+static void _fill_span (fb_info_t *fb, int x, int y, int w, int color)
+{
+    unsigned char pixel[4];
+    char *p;
+    int bpp = fb->bpp >> 3, step, i;
+
+    if ((y < 0) || (y >= fb->h))   return;
+    if (x < 0)  {   w += x;    x = 0;  }
+    if (x + w > fb->w)  w = fb->w - x;
+    if (w <= 0)     return;
+
+    if (fb->bpp == 1) {
+        for (i = 0; i < w; i++)
+            put_pixel (fb, x + i, y, color);
+        return;
+    }
+
+    _pixel_bytes (fb, color, pixel);
+
+    /* span의 시작 픽셀 위치와 메모리 진행 방향 */
+    switch (fb->rotate) {
+        default:
+        case eFB_ROTATE_0:
+            p = fb->data + (y * fb->stride) + (x * bpp);
+            step = bpp;
+            break;
+        case eFB_ROTATE_90:
+            p = fb->data + (x * fb->stride) + ((fb->h - y - 1) * bpp);
+            step = fb->stride;
+            break;
+        case eFB_ROTATE_180:
+            p = fb->data + ((fb->h - y - 1) * fb->stride) + ((fb->w - x - w) * bpp);
+            step = bpp;
+            break;
+        case eFB_ROTATE_270:
+            p = fb->data + ((fb->w - x - w) * fb->stride) + (y * bpp);
+            step = fb->stride;
+            break;
+    }
+
+    if (fb->bpp == 32) {
+        for (i = 0; i < w; i++, p += step)
+            memcpy (p, pixel, 4);
+    } else {
+        for (i = 0; i < w; i++, p += step)
+            memcpy (p, pixel, 3);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// 이미 그려진 y_src 라인의 span을 y_dst 라인으로 복사한다.
+// 메모리상 연속된 라인(0/180)에서만 가능하며 복사하지 못한 경우 0을 반환한다.
+//-----------------------------------------------------------------------------
+static int _copy_span_row (fb_info_t *fb, int x, int y_src, int y_dst, int w)
+{
+    int bpp = fb->bpp >> 3, px;
+
+    if ((fb->bpp == 1) || (fb->rotate == eFB_ROTATE_90) || (fb->rotate == eFB_ROTATE_270))
+        return 0;
+
+    if ((y_dst < 0) || (y_dst >= fb->h))    return 1;
+    if ((y_src < 0) || (y_src >= fb->h))    return 0;
+    if (x < 0)  {   w += x;    x = 0;  }
+    if (x + w > fb->w)  w = fb->w - x;
+    if (w <= 0)     return 1;
+
+    if (fb->rotate == eFB_ROTATE_180) {
+        px    = fb->w - x - w;
+        y_src = fb->h - y_src - 1;
+        y_dst = fb->h - y_dst - 1;
+    } else
+        px    = x;
+
+    memcpy (fb->data + (y_dst * fb->stride) + (px * bpp),
+            fb->data + (y_src * fb->stride) + (px * bpp), w * bpp);
+    return 1;
+}
+
+//-----------------------------------------------------------------------------
+// 실제 메모리 좌표(px, py)에서 시작하는 가로 w 픽셀을 color로 채운다.
+// 회전과 관계없이 항상 연속된 메모리이며 panel 밖은 잘라낸다. (1bpp 제외)
+//-----------------------------------------------------------------------------
+static void _fill_phys (fb_info_t *fb, int px, int py, int w, int color)
+{
+    unsigned char pixel[4];
+    char *p;
+    int bpp = fb->bpp >> 3, i;
+
+    if ((py < 0) || (py >= FB_PHYS_H(fb)))  return;
+    if (px < 0) {   w += px;    px = 0; }
+    if (px + w > FB_PHYS_W(fb)) w = FB_PHYS_W(fb) - px;
+    if (w <= 0)     return;
+
+    _pixel_bytes (fb, color, pixel);
+    p = fb->data + (py * fb->stride) + (px * bpp);
+
+    if (fb->bpp == 32) {
+        for (i = 0; i < w; i++, p += 4)
+            memcpy (p, pixel, 4);
+    } else {
+        for (i = 0; i < w; i++, p += 3)
+            memcpy (p, pixel, 3);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// 실제 메모리의 py_src 라인의 span을 py_dst 라인으로 복사한다. (1bpp 제외)
+//-----------------------------------------------------------------------------
+static int _copy_phys_row (fb_info_t *fb, int px, int py_src, int py_dst, int w)
+{
+    int bpp = fb->bpp >> 3;
+
+    if ((py_dst < 0) || (py_dst >= FB_PHYS_H(fb)))  return 1;
+    if ((py_src < 0) || (py_src >= FB_PHYS_H(fb)))  return 0;
+    if (px < 0) {   w += px;    px = 0; }
+    if (px + w > FB_PHYS_W(fb)) w = FB_PHYS_W(fb) - px;
+    if (w <= 0)     return 1;
+
+    memcpy (fb->data + (py_dst * fb->stride) + (px * bpp),
+            fb->data + (py_src * fb->stride) + (px * bpp), w * bpp);
+    return 1;
+}
+
+//-----------------------------------------------------------------------------
+// ctx의 변환 table 중 (f_color, b_color, fb 형식)에 맞는 table을 찾고,
+// 없으면 가장 오래된 table을 다시 만든다.
+//-----------------------------------------------------------------------------
+static const text_lut_entry_t *_text_lut (fb_info_t *fb, fb_text_t *ctx,
+                    int f_color, int b_color)
+{
+    text_lut_entry_t *e;
+    unsigned char f_pixel[4], b_pixel[4];
+    int i, v, bit, bpp = fb->bpp >> 3;
+
+    if (ctx->lut == NULL) {
+        if ((ctx->lut = (struct text_lut__t *)calloc (1, sizeof(struct text_lut__t))) == NULL)
+            return NULL;
+    }
+    for (i = 0; i < TEXT_LUT_MAX; i++) {
+        e = &ctx->lut->e[i];
+        if (e->valid && (e->f_color == f_color) && (e->b_color == b_color) &&
+            (e->bpp == fb->bpp) && (e->is_bgr == fb->is_bgr))
+            return e;
+    }
+    e = &ctx->lut->e[ctx->lut->next];
+    ctx->lut->next = (ctx->lut->next + 1) % TEXT_LUT_MAX;
+
+    _pixel_bytes (fb, f_color, f_pixel);
+    _pixel_bytes (fb, b_color, b_pixel);
+    for (v = 0; v < 256; v++)
+        for (bit = 0; bit < 8; bit++)
+            memcpy (&e->pixel[v][bit * bpp], (v & (0x80 >> bit)) ? f_pixel : b_pixel, bpp);
+
+    e->valid  = 1;
+    e->f_color = f_color;   e->b_color = b_color;
+    e->bpp     = fb->bpp;   e->is_bgr  = fb->is_bgr;
+    return e;
+}
+
+//-----------------------------------------------------------------------------
+// 확대하지 않는 w x h bitmap을 실제 메모리 좌표(px, py)에 변환 table로 그린다.
+// glyph 영역이 panel 안에 있어야 한다. (호출하는 곳에서 확인)
+//-----------------------------------------------------------------------------
+static void draw_bitmap_lut (fb_info_t *fb, const text_lut_entry_t *lut,
+                    int px, int py, const unsigned char *p_img, int w, int h)
+{
+    int bpp = fb->bpp >> 3, pitch = (w + 7) / 8, row, i, n = w >> 3;
+    char *p = fb->data + (py * fb->stride) + (px * bpp);
+
+    for (row = 0; row < h; row++, p += fb->stride, p_img += pitch) {
+        for (i = 0; i < n; i++)
+            memcpy (p + i * 8 * bpp, lut->pixel[p_img[i]], 8 * bpp);
+        if (w & 7)
+            memcpy (p + n * 8 * bpp, lut->pixel[p_img[n]], (w & 7) * bpp);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// w x h bitmap(row당 (w+7)/8 bytes)을 scale배 확대하여 그린다.
+// 각 row를 전경/배경 run으로 한번만 분리한 후 run 단위로 채우고,
+// 확대로 인하여 반복되는 나머지 (scale - 1)개의 row는 첫번째 row를 복사한다.
+// b_color가 COLOR_TRANSPARENT인 경우 전경 run만 그린다.
+// phys 설정시 (x, y)는 실제 메모리 좌표이며 p_img는 font_rot_glyph()로 회전된 bitmap이다.
+// 배경이 있고 확대하지 않는 glyph가 메모리상 연속된 row에 있으면 변환 table로 그린다.
+//-----------------------------------------------------------------------------
+static void draw_bitmap (fb_info_t *fb, fb_text_t *ctx, int phys,
+                    int x, int y, const unsigned char *p_img, int w, int h,
                     int f_color, int b_color, int scale)
 {
-    int pos, i, j, mask, x_off, y_off, scale_y, scale_x;
-
-    for (i = 0, y_off = 0, pos = 0; i < 16; i++) {
-        for (scale_y = 0; scale_y < scale; scale_y++) {
-            if (scale_y)
-                pos -= 2;
-            for (x_off = 0, j = 0; j < 2; j++) {
-                for (mask = 0x80; mask > 0; mask >>= 1) {
-                    for (scale_x = 0; scale_x < scale; scale_x++) {
-                        int c;
-                        c = (p_img[pos] & mask) ? f_color : b_color;
-
-                        put_pixel(fb, x + x_off, y + y_off, c);
-                        x_off++;
-                    }
+    int pitch = (w + 7) / 8, row, run_cnt, pos, end, on, i, scale_y, y_off;
+    int run_pos[64], run_len[64], run_color[64];
+    int is_trans = (b_color == COLOR_TRANSPARENT);
+    void (*fill)(fb_info_t *, int, int, int, int) = phys ? _fill_phys : _fill_span;
+    int  (*copy)(fb_info_t *, int, int, int, int) = phys ? _copy_phys_row : _copy_span_row;
+    const text_lut_entry_t *lut;
+
+    if ((scale == 1) && !is_trans && (ctx != NULL) && (fb->bpp != 1) &&
+        (phys || (fb->rotate == eFB_ROTATE_0)) &&
+        (x >= 0) && (y >= 0) && (x + w <= FB_PHYS_W(fb)) && (y + h <= FB_PHYS_H(fb)) &&
+        ((lut = _text_lut (fb, ctx, f_color, b_color)) != NULL)) {
+        draw_bitmap_lut (fb, lut, x, y, p_img, w, h);
+        return;
+    }
+
+    for (row = 0, y_off = y; row < h; row++, p_img += pitch) {
+        /* row -> run 변환 */
+        for (run_cnt = 0, pos = 0; pos < w; pos = end) {
+            on = p_img[pos >> 3] & (0x80 >> (pos & 7));
+            for (end = pos + 1; end < w; end++)
+                if (!(p_img[end >> 3] & (0x80 >> (end & 7))) != !on)
+                    break;
+            if (!on && is_trans)
+                continue;
+            /* run buffer가 가득 차면 (폭이 넓은 font) 확대된 row 전체에 먼저 그린다. */
+            if (run_cnt == (int)(sizeof(run_pos) / sizeof(run_pos[0]))) {
+                for (scale_y = 0; scale_y < scale; scale_y++)
+                    for (i = 0; i < run_cnt; i++)
+                        fill (fb, run_pos[i], y_off + scale_y, run_len[i], run_color[i]);
+                run_cnt = 0;
+            }
+            run_pos  [run_cnt] = x + pos * scale;
+            run_len  [run_cnt] = (end - pos) * scale;
+            run_color[run_cnt] = on ? f_color : b_color;
+            run_cnt++;
+        }
+        for (i = 0; i < run_cnt; i++)
+            fill (fb, run_pos[i], y_off, run_len[i], run_color[i]);
+
+        /* 투명 배경인 경우 아래 라인의 배경 픽셀까지 복사되므로 run을 다시 그린다. */
+        for (scale_y = 1; run_cnt && (scale_y < scale); scale_y++) {
+            if (is_trans || !copy (fb, x, y_off, y_off + scale_y, w * scale)) {
+                for (i = 0; i < run_cnt; i++)
+                    fill (fb, run_pos[i], y_off + scale_y, run_len[i], run_color[i]);
+            }
+        }
+        y_off += scale;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// font_smooth_glyph()의 run data를 그린다. (h = 확대된 glyph 높이)
+// 전경/배경 run은 span으로 채우고 경계의 반투명 pixel만 배경색과 합성한다.
+// phys 설정시 (x, y)는 실제 메모리 좌표이다. (회전된 bitmap의 run data)
+//-----------------------------------------------------------------------------
+static void draw_smooth_bitmap (fb_info_t *fb, int phys,
+                    int x, int y, const unsigned short *runs, int h,
+                    int f_color, int b_color)
+{
+    int row, n, len, alpha, x_off, i, bc;
+    int max_w = phys ? FB_PHYS_W(fb) : fb->w, max_h = phys ? FB_PHYS_H(fb) : fb->h;
+    void (*fill)(fb_info_t *, int, int, int, int) = phys ? _fill_phys : _fill_span;
+    int  (*get) (fb_info_t *, int, int)           = phys ? _get_phys  : _get_pixel;
+    fb_color_u f, b, c;
+
+    f.uint = f_color;
+    for (row = 0; row < h; row++) {
+        for (n = *runs++, x_off = x; n > 0; n--, x_off += len) {
+            len = *runs++;  alpha = *runs++;
+
+            if (alpha == 255)
+                fill (fb, x_off, y + row, len, f_color);
+            else if (alpha == 0) {
+                if (b_color != COLOR_TRANSPARENT)
+                    fill (fb, x_off, y + row, len, b_color);
+            } else {
+                for (i = 0; i < len; i++) {
+                    if ((x_off + i < 0) || (x_off + i >= max_w) || (y + row < 0) || (y + row >= max_h))
+                        continue;
+                    bc = (b_color == COLOR_TRANSPARENT) ?
+                            get (fb, x_off + i, y + row) : b_color;
+                    b.uint = bc;    c.uint = 0;
+                    c.bits.r = (f.bits.r * alpha + b.bits.r * (255 - alpha)) / 255;
+                    c.bits.g = (f.bits.g * alpha + b.bits.g * (255 - alpha)) / 255;
+                    c.bits.b = (f.bits.b * alpha + b.bits.b * (255 - alpha)) / 255;
+                    fill (fb, x_off + i, y + row, 1, c.uint);
                 }
-                pos++;
             }
-            y_off++;
         }
     }
 }
 
 //-----------------------------------------------------------------------------
-static void draw_ascii_bitmap (fb_info_t *fb,
-                    int x, int y, unsigned char *p_img,
+// glyph 1개를 그린다. smooth 설정시 확대된 glyph는 cache된 smooth glyph를 사용한다.
+// (font, code)는 smooth glyph cache의 key로 사용된다.
+//-----------------------------------------------------------------------------
+static void _draw_glyph (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                    const void *font, unsigned int code,
+                    const unsigned char *p_img, int w, int h,
                     int f_color, int b_color, int scale)
 {
-    int pos, mask, x_off, y_off, scale_y, scale_x;
+    const unsigned short *runs;
+    const unsigned char *p_rot;
 
-    for (pos = 0, y_off = 0; pos < 16; pos++) {
-        for (scale_y = 0; scale_y < scale; scale_y++) {
-            for (x_off = 0, mask = 0x80; mask > 0; mask >>= 1) {
-                for (scale_x = 0; scale_x < scale; scale_x++) {
-                    int c;
-                    c = (p_img[pos] & mask) ? f_color : b_color;
+    if (((CTX_SMOOTH(ctx) && (scale > 1)) || FB_ROT_SIDE(fb)) && (fb->bpp != 1)) {
+        if (ctx->cache == NULL)
+            ctx->cache = font_cache_alloc ();
+    }
+    /* 90/270도 회전 화면은 회전된 glyph로 실제 메모리의 가로줄 단위로 그린다. */
+    if (FB_ROT_SIDE(fb) && (fb->bpp != 1) && (ctx->cache != NULL) &&
+        (p_rot = font_rot_glyph (ctx->cache, font, code, p_img, w, h, fb->rotate)) != NULL) {
+        _draw_glyph_rot (fb, ctx, x, y, font, code, p_rot, w, h, f_color, b_color, scale);
+        return;
+    }
+    if (CTX_SMOOTH(ctx) && (scale > 1) && (fb->bpp != 1) && (ctx->cache != NULL) &&
+        (runs = font_smooth_glyph (ctx->cache, font, code, p_img, w, h, scale, 0)) != NULL) {
+        draw_smooth_bitmap (fb, 0, x, y, runs, h * scale, f_color, b_color);
+        return;
+    }
+    draw_bitmap (fb, ctx, 0, x, y, p_img, w, h, f_color, b_color, scale);
+}
 
-                    put_pixel(fb, x + x_off, y + y_off, c);
-                    x_off++;
-                }
-            }
-            y_off++;
+//-----------------------------------------------------------------------------
+// 화면 좌표(x, y)에 회전된 glyph(p_rot, 원본 glyph 크기 w x h)를 그린다.
+// 화면 좌표의 glyph 영역을 실제 메모리 좌표로 바꾼 후 회전된 bitmap의 row를 그대로 그린다.
+//-----------------------------------------------------------------------------
+static void _draw_glyph_rot (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                    const void *font, unsigned int code,
+                    const unsigned char *p_rot, int w, int h,
+                    int f_color, int b_color, int scale)
+{
+    const unsigned short *runs;
+    int px, py;
+
+    /* glyph 영역의 좌상단 (실제 메모리 좌표) */
+    if (fb->rotate == eFB_ROTATE_90) {
+        px = fb->h - y - h * scale;
+        py = x;
+    } else {
+        px = y;
+        py = fb->w - x - w * scale;
+    }
+    if (CTX_SMOOTH(ctx) && (scale > 1) && (ctx->cache != NULL) &&
+        (runs = font_smooth_glyph (ctx->cache, font, code, p_rot, h, w, scale, fb->rotate)) != NULL) {
+        draw_smooth_bitmap (fb, 1, px, py, runs, w * scale, f_color, b_color);
+        return;
+    }
+    draw_bitmap (fb, ctx, 1, px, py, p_rot, h, w, f_color, b_color, scale);
+}
+
+//-----------------------------------------------------------------------------
+// UTF-8 문자 1개를 code point로 변환하고 byte 길이를 반환한다.
+// 잘못된 sequence(연속 byte 없음, overlong, surrogate, 잘린 문자)는 TEXT_BAD_CODE로
+// 변환하며, 다음 문자와 다시 동기가 맞도록 유효한 byte까지만 사용한다.
+//-----------------------------------------------------------------------------
+static int _utf8_decode (const unsigned char *p, unsigned int *code)
+{
+    unsigned int c = p[0], min;
+    int len, i;
+
+    if (c < 0x80)   {   *code = c;  return 1;   }
+
+    if      ((c & 0xE0) == 0xC0)    {   len = 2;    c &= 0x1F;  min = 0x80;     }
+    else if ((c & 0xF0) == 0xE0)    {   len = 3;    c &= 0x0F;  min = 0x800;    }
+    else if ((c & 0xF8) == 0xF0)    {   len = 4;    c &= 0x07;  min = 0x10000;  }
+    else                            {   *code = TEXT_BAD_CODE;  return 1;       }
+
+    for (i = 1; i < len; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            *code = TEXT_BAD_CODE;
+            return i;
         }
+        c = (c << 6) | (p[i] & 0x3F);
+    }
+    if ((c < min) || (c > 0x10FFFF) || ((c >= 0xD800) && (c <= 0xDFFF)))
+        c = TEXT_BAD_CODE;
+
+    *code = c;
+    return len;
+}
+
+//-----------------------------------------------------------------------------
+// code가 속한 TextRange 항목 (binary search)
+//-----------------------------------------------------------------------------
+static const text_range_t *_text_range (unsigned int code)
+{
+    int lo = 0, hi = TEXT_RANGE_CNT - 1, mid;
+
+    if (code < TextRange[0].lo)
+        return &TextRangeNarrow;
+
+    while (lo <= hi) {
+        mid = (lo + hi) / 2;
+        if      (TextRange[mid].hi < code)  lo = mid + 1;
+        else if (TextRange[mid].lo > code)  hi = mid - 1;
+        else
+            return &TextRange[mid];
+    }
+    return &TextRangeNarrow;
+}
+
+//-----------------------------------------------------------------------------
+// 문자 1개의 byte 길이와 화면상 크기(cells, ASCII 문자 단위)를 반환한다.
+// 모든 문자는 UTF-8이며 한글 등 East Asian Wide 문자는 ASCII 2문자 크기를 가진다.
+//-----------------------------------------------------------------------------
+static int _text_next (const unsigned char *p, int *cells)
+{
+    unsigned int code;
+    int len;
+
+    if (*p < 0x80) {
+        *cells = 1;
+        return 1;
     }
+    len    = _utf8_decode (p, &code);
+    *cells = _text_range (code)->cells;
+    return len;
 }
 
 //-----------------------------------------------------------------------------
-static void _draw_text (fb_info_t *fb, int x, int y, char *p_str,
+// font에 없는 문자를 표시하는 사각형 (w x h 크기의 cell, unit = 선 두께)
+//-----------------------------------------------------------------------------
+static void _draw_box (fb_info_t *fb, int x, int y, int w, int h,
+                        int f_color, int b_color, int unit)
+{
+    if (b_color != COLOR_TRANSPARENT)
+        draw_fill_rect (fb, x, y, w, h, b_color);
+    draw_rect (fb, x + unit, y + unit * 2, w - unit * 2, h - unit * 4, unit, f_color);
+}
+
+//-----------------------------------------------------------------------------
+static void _draw_text (fb_info_t *fb, fb_text_t *ctx, int x, int y, char *p_str,
                         int f_color, int b_color, int scale)
 {
-    unsigned char *p_img;
-    unsigned char c1, c2, c3;
+    _draw_ntext (fb, ctx, x, y, p_str, strlen (p_str), f_color, b_color, scale);
+}
 
-    while(*p_str) {
-        c1 = *(unsigned char *)p_str++;
+//-----------------------------------------------------------------------------
+// p_str 부터 len byte (문자 단위 길이)를 그리고 다음 문자의 x 위치를 반환한다.
+//-----------------------------------------------------------------------------
+static int _draw_ntext (fb_info_t *fb, fb_text_t *ctx, int x, int y, const char *p_str,
+                        int len, int f_color, int b_color, int scale)
+{
+    const unsigned char *p = (const unsigned char *)p_str, *p_end = p + len, *p_img;
+    const text_range_t *range;
+    const font_face_t *face;
+    unsigned int code;
+    int f_scale, cell_w;
 
-        //---------- 한글 ---------
-        /* 모든 문자는 기본적으로 UTF-8형태로 저장되며 한글은 3바이트를 가진다. */
-        /* 한글은 3바이트를 일어 UTF8 to UTF16으로 변환후 초/중/종성을 분리하여 조합형으로 표시한다. */
-        if (c1 >= 0x80){
-            c2 = *(unsigned char *)p_str++;
-            c3 = *(unsigned char *)p_str++;
-
-            p_img = get_hangul_image(c1, c2, c3);
-            draw_hangul_bitmap(fb, x, y, p_img, f_color, b_color, scale);
-            x = x + FONT_HANGUL_WIDTH * scale;
-        }
+    /* ASCII는 요청 크기에 가장 가까운 native face를 사용 (16x32 등) */
+    face   = font_select (FONT_HEIGHT * scale, &f_scale);
+    cell_w = face->w * f_scale;
+
+    while((p < p_end) && *p) {
         //---------- ASCII ---------
-        else {
-            p_img = (unsigned char *)FONT_ASCII[c1];
-            draw_ascii_bitmap(fb, x, y, p_img, f_color, b_color, scale);
-            x = x + FONT_ASCII_WIDTH * scale;
+        if (*p < 0x80) {
+            code = *p++;
+            if ((p_img = font_glyph (face, code)) != NULL)
+                _draw_glyph (fb, ctx, x, y, face, code, p_img, face->w, face->h,
+                                f_color, b_color, f_scale);
+            else
+                _draw_box (fb, x, y, cell_w, face->h * f_scale, f_color, b_color, f_scale);
+            x += cell_w;
+            continue;
         }
+
+        /* 모든 문자는 UTF-8형태로 저장되며 code point 범위에 따라 glyph를 찾는다. */
+        p    += _utf8_decode (p, &code);
+        range = _text_range (code);
+
+        //---------- 한글 ---------
+        /* 한글은 초/중/종성을 분리하여 조합형으로 표시한다. */
+        if (range->src == eTEXT_SRC_HANGUL) {
+            const font_hangul_t *font = _han_font (CTX_FONT(ctx));
+
+            /* 90도 회전 table이 있는 font는 회전된 glyph를 바로 조합 (16x16) */
+            if ((fb->rotate == eFB_ROTATE_90) && font->rot90 && (fb->bpp != 1)) {
+                p_img = get_hangul_image(ctx, code, 1);
+                _draw_glyph_rot (fb, ctx, x, y, font, code,
+                                p_img, FONT_HANGUL_WIDTH, FONT_HEIGHT,
+                                f_color, b_color, scale);
+            } else {
+                p_img = get_hangul_image(ctx, code, 0);
+                _draw_glyph (fb, ctx, x, y, font, code,
+                                p_img, FONT_HANGUL_WIDTH, FONT_HEIGHT,
+                                f_color, b_color, scale);
+            }
+        }
+        //---------- 기타 (font file) ---------
+        /* index가 없는 face(내장 font)는 0x80 이상이 Unicode가 아니므로 사용하지 않음 */
+        else if (face->index && ((p_img = font_glyph (face, code)) != NULL))
+            _draw_glyph (fb, ctx, x, y, face, code, p_img, face->w, face->h,
+                            f_color, b_color, f_scale);
+        /* font에 없는 문자 */
+        else
+            _draw_box (fb, x, y, cell_w * range->cells, face->h * f_scale,
+                        f_color, b_color, f_scale);
+        x += cell_w * range->cells;
+    }
+    return x;
+}
+
+//-----------------------------------------------------------------------------
+// fmt를 한번만 format 하여 그릴 문자열을 반환한다.
+// '%'가 없는 문자열과 "%s"는 복사없이 그대로 사용하며, buf 보다 긴 결과는
+// 새로 할당하여 *p_alloc에 저장한다. (호출측에서 free)
+//-----------------------------------------------------------------------------
+static char *_text_vformat (char *buf, int size, char *fmt, va_list va, char **p_alloc)
+{
+    va_list vc;
+    char *p_str;
+    int len;
+
+    *p_alloc = NULL;
+    if (strchr (fmt, '%') == NULL)
+        return fmt;
+
+    va_copy (vc, va);
+    if (!strcmp (fmt, "%s")) {
+        p_str = va_arg (vc, char *);
+        va_end (vc);
+        return p_str ? p_str : "";
     }
+    len = vsnprintf (buf, size, fmt, vc);
+    va_end (vc);
+
+    if (len < 0)
+        return "";
+
+    if ((len >= size) && ((*p_alloc = malloc (len + 1)) != NULL)) {
+        vsnprintf (*p_alloc, len + 1, fmt, va);
+        return *p_alloc;
+    }
+    return buf;
 }
 
 //-----------------------------------------------------------------------------
 void draw_text (fb_info_t *fb, int x, int y,
                 int f_color, int b_color, int scale, char *fmt, ...)
 {
-    char buf[256];
     va_list va;
 
-    memset(buf, 0x00, sizeof(buf));
+    va_start(va, fmt);
+    draw_vtext_r (fb, &fb->text, x, y, f_color, b_color, scale, fmt, va);
+    va_end(va);
+}
+
+//-----------------------------------------------------------------------------
+void draw_vtext (fb_info_t *fb, int x, int y,
+                int f_color, int b_color, int scale, char *fmt, va_list va)
+{
+    draw_vtext_r (fb, &fb->text, x, y, f_color, b_color, scale, fmt, va);
+}
+
+//-----------------------------------------------------------------------------
+// 지정된 text context를 사용하여 문자열을 그린다. (thread 별 context 사용시 reentrant)
+//-----------------------------------------------------------------------------
+void draw_text_r (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                int f_color, int b_color, int scale, char *fmt, ...)
+{
+    va_list va;
 
     va_start(va, fmt);
-    vsprintf(buf, fmt, va);
+    draw_vtext_r (fb, ctx, x, y, f_color, b_color, scale, fmt, va);
     va_end(va);
+}
 
-    _draw_text(fb, x, y, buf, f_color, b_color, scale);
+//-----------------------------------------------------------------------------
+void draw_vtext_r (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                int f_color, int b_color, int scale, char *fmt, va_list va)
+{
+    char buf[256], *p_alloc;
+
+    _draw_text(fb, ctx, x, y, _text_vformat (buf, sizeof(buf), fmt, va, &p_alloc),
+                f_color, b_color, scale);
+
+    if (p_alloc)
+        free (p_alloc);
 }
 
 //-----------------------------------------------------------------------------
 // img_buf_size = w * h * bpp / 8
 //-----------------------------------------------------------------------------
-void make_draw_text (char *img_buf, int w, int h, int bpp,
+int make_draw_text (char *img_buf, int w, int h, int bpp,
                     int f_color, int b_color, int scale, char *fmt, ...)
+{
+    va_list va;
+    int size;
+
+    va_start(va, fmt);
+    size = make_draw_vtext (img_buf, w, h, bpp, f_color, b_color, scale, fmt, va);
+    va_end(va);
+
+    return size;
+}
+
+//-----------------------------------------------------------------------------
+int make_draw_vtext (char *img_buf, int w, int h, int bpp,
+                    int f_color, int b_color, int scale, char *fmt, va_list va)
+{
+    fb_info_t img_fb;
+    char buf[256], *p_alloc = NULL, *str;
+    int t_w, t_h;
+
+    str = _text_vformat (buf, sizeof(buf), fmt, va, &p_alloc);
+    text_measure (str, scale, &t_w, &t_h);
+
+    if (img_buf != NULL) {
+        /* rotate = 0, RGB 순서의 image */
+        memset (&img_fb, 0, sizeof(img_fb));
+        text_ctx_init (&img_fb.text, -1, -1);
+        img_fb.rotate = eFB_ROTATE_0;
+        img_fb.is_bgr = 0;
+        img_fb.w      = w;
+        img_fb.h      = h;
+        img_fb.bpp    = bpp;
+        img_fb.stride = (w * bpp) / 8;
+
+        memset (img_buf, 0, (w * h * bpp / 8));
+        img_fb.base = img_fb.data = (char *)img_buf;
+
+        _draw_text (&img_fb, &img_fb.text, 0, 0, str, f_color, b_color, scale);
+        text_ctx_free (&img_fb.text);
+    }
+    if (p_alloc)
+        free (p_alloc);
+
+    return (t_w * t_h * bpp) / 8;
+}
+
+//-----------------------------------------------------------------------------
+// Text sprite pool
+// image buffer는 sprite를 pool에 반환할 때 해제한다. (사용중인 sprite만 메모리를 가짐)
+//-----------------------------------------------------------------------------
+static text_sprite_t    SpritePool[SPRITE_POOL_MAX];
+static pthread_mutex_t  SpriteMutex = PTHREAD_MUTEX_INITIALIZER;
+
+//-----------------------------------------------------------------------------
+// fb의 형식과 회전 방향으로 sprite image를 다시 그린다.
+//-----------------------------------------------------------------------------
+static int _sprite_render (fb_info_t *fb, fb_text_t *ctx, text_sprite_t *sp)
 {
     fb_info_t img_fb;
+    fb_text_t img_ctx;
+    int size;
+
+    memset (&img_fb, 0, sizeof(img_fb));
+    img_fb.rotate = fb->rotate;
+    img_fb.is_bgr = fb->is_bgr;
+    img_fb.bpp    = fb->bpp;
+    img_fb.w      = sp->w;
+    img_fb.h      = sp->h;
+    img_fb.stride = FB_PHYS_W(&img_fb) * (fb->bpp >> 3);
+    size = img_fb.stride * FB_PHYS_H(&img_fb);
+
+    if (sp->size < size) {
+        char *data = (char *)realloc (sp->data, size);
+
+        if (data == NULL) {
+            fprintf(stdout, "%s : sprite malloc error! (size = %d)\n", __func__, size);
+            return -1;
+        }
+        sp->data = data;    sp->size = size;
+    }
+    img_fb.base = img_fb.data = sp->data;
 
-    img_fb.w      = w;
-    img_fb.h      = h;
-    img_fb.bpp    = bpp;
-    img_fb.stride = (w * bpp) / 8;
+    /* sprite를 만들때의 font 설정으로 그린다. (ctx의 glyph cache는 같이 사용) */
+    img_ctx = *ctx;
+    img_ctx.f_type = sp->f_type;    img_ctx.smooth = sp->smooth;
 
-    memset (img_buf, 0, (w * h * bpp / 8));
-    img_fb.base = img_fb.data = (char *)img_buf;
+    _draw_text (&img_fb, &img_ctx, 0, 0, sp->str, sp->f_color, sp->b_color, sp->scale);
+    ctx->cache = img_ctx.cache;     ctx->lut = img_ctx.lut;
 
-    draw_text (&img_fb, 0, 0, f_color, b_color, scale, fmt);
+    sp->bpp    = fb->bpp;       sp->is_bgr = fb->is_bgr;
+    sp->rotate = fb->rotate;    sp->stride = img_fb.stride;
+    return 0;
 }
 
 //-----------------------------------------------------------------------------
-void draw_line (fb_info_t *fb, int x, int y, int w, int color)
+// 문자열을 sprite image로 그린다. sp = NULL 이면 pool에서 새로 할당하며,
+// 기존 sprite(sp)와 문자열 및 조건이 같으면 다시 그리지 않는다.
+// 배경이 투명(COLOR_TRANSPARENT)이거나 1bpp fb인 경우 NULL을 반환한다.
+// NULL을 반환하는 경우 기존 sprite(sp)는 pool에 반환된다. (sp = sprite_text(.., sp, ..))
+//-----------------------------------------------------------------------------
+text_sprite_t *sprite_text (fb_info_t *fb, fb_text_t *ctx, text_sprite_t *sp,
+                    int f_color, int b_color, int scale, const char *str)
 {
-    int dx;
+    int i, f_type = CTX_FONT(ctx), smooth = CTX_SMOOTH(ctx);
 
-    for (dx = 0; dx < w; dx++)
-        put_pixel(fb, x + dx, y, color);
+    if ((b_color == COLOR_TRANSPARENT) || (fb->bpp == 1) || (scale < 1) ||
+        (strlen (str) >= SPRITE_STR_MAX)) {
+        sprite_free (sp);
+        return NULL;
+    }
+
+    if (sp == NULL) {
+        pthread_mutex_lock (&SpriteMutex);
+        for (i = 0; i < SPRITE_POOL_MAX; i++) {
+            if (!SpritePool[i].used) {
+                sp = &SpritePool[i];
+                sp->used = 1;
+                break;
+            }
+        }
+        pthread_mutex_unlock (&SpriteMutex);
+        if (sp == NULL)
+            return NULL;
+    }
+    else if ((sp->f_color == f_color) && (sp->b_color == b_color) && (sp->scale == scale) &&
+             (sp->f_type == f_type) && (sp->smooth == smooth) && !strcmp (sp->str, str) &&
+             (sp->rotate == fb->rotate) && (sp->bpp == fb->bpp) && (sp->is_bgr == fb->is_bgr))
+        return sp;
+
+    strcpy (sp->str, str);
+    sp->f_color = f_color;  sp->b_color = b_color;  sp->scale = scale;
+    sp->f_type  = f_type;   sp->smooth  = smooth;
+    text_measure (str, scale, &sp->w, &sp->h);
+
+    if (_sprite_render (fb, ctx, sp)) {
+        sprite_free (sp);
+        return NULL;
+    }
+    return sp;
+}
+
+//-----------------------------------------------------------------------------
+// sprite를 화면 좌표(x, y)에 복사한다. 실제 메모리의 가로줄 단위로 복사하며,
+// fb의 회전이나 형식이 바뀐 경우 image를 다시 그린 후 복사한다.
+//-----------------------------------------------------------------------------
+void sprite_blit (fb_info_t *fb, fb_text_t *ctx, text_sprite_t *sp, int x, int y)
+{
+    int bpp = fb->bpp >> 3, px, py, pw, ph, row, sx, w;
+
+    if ((sp == NULL) || !sp->used || (fb->bpp == 1))
+        return;
+
+    if ((sp->rotate != fb->rotate) || (sp->bpp != fb->bpp) || (sp->is_bgr != fb->is_bgr))
+        if (_sprite_render (fb, ctx, sp))
+            return;
+
+    /* sprite 영역의 좌상단 (실제 메모리 좌표) */
+    switch (fb->rotate) {
+        default:
+        case eFB_ROTATE_0:      px = x;                     py = y;                     break;
+        case eFB_ROTATE_90:     px = fb->h - y - sp->h;     py = x;                     break;
+        case eFB_ROTATE_180:    px = fb->w - x - sp->w;     py = fb->h - y - sp->h;     break;
+        case eFB_ROTATE_270:    px = y;                     py = fb->w - x - sp->w;     break;
+    }
+    pw = FB_ROT_SIDE(fb) ? sp->h : sp->w;
+    ph = FB_ROT_SIDE(fb) ? sp->w : sp->h;
+
+    /* panel 밖은 잘라냄 */
+    sx = (px < 0) ? -px : 0;
+    w  = ((px + pw) > FB_PHYS_W(fb)) ? (FB_PHYS_W(fb) - px - sx) : (pw - sx);
+    if (w <= 0)
+        return;
+
+    for (row = 0; row < ph; row++) {
+        if ((py + row < 0) || (py + row >= FB_PHYS_H(fb)))
+            continue;
+        memcpy (fb->data + ((py + row) * fb->stride) + ((px + sx) * bpp),
+                sp->data + (row * sp->stride) + (sx * bpp), w * bpp);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// sprite를 pool에 반환하고 image buffer를 해제한다.
+//-----------------------------------------------------------------------------
+void sprite_free (text_sprite_t *sp)
+{
+    if (sp == NULL)
+        return;
+
+    free (sp->data);
+    sp->data = NULL;    sp->size = 0;
+
+    pthread_mutex_lock (&SpriteMutex);
+    sp->used = 0;
+    pthread_mutex_unlock (&SpriteMutex);
+}
+
+//-----------------------------------------------------------------------------
+// 문자 1개의 byte 길이, cells = 화면상 크기 (ASCII 문자 단위)
+//-----------------------------------------------------------------------------
+int text_next (const char *p, int *cells)
+{
+    return _text_next ((const unsigned char *)p, cells);
+}
+
+//-----------------------------------------------------------------------------
+// UTF-8 문자 1개의 code point(잘못된 sequence는 U+FFFD), 반환값은 byte 길이
+//-----------------------------------------------------------------------------
+int text_decode (const char *p, unsigned int *code)
+{
+    return _utf8_decode ((const unsigned char *)p, code);
+}
+
+//-----------------------------------------------------------------------------
+// 문자열의 화면상 크기(ASCII 문자 단위). 한글 등 wide 문자는 2를 차지한다.
+//-----------------------------------------------------------------------------
+int text_cells (const char *str)
+{
+    int cells = 0, c;
+
+    while (*str) {
+        str   += _text_next ((const unsigned char *)str, &c);
+        cells += c;
+    }
+    return cells;
+}
+
+//-----------------------------------------------------------------------------
+// scale 배율로 그려질 문자열의 pixel 크기. 반환값은 넓이(w)
+//-----------------------------------------------------------------------------
+int text_measure (const char *str, int scale, int *w, int *h)
+{
+    int width = text_cells (str) * font_cell_w (scale);
+
+    if (w)  *w = width;
+    if (h)  *h = font_cell_h (scale);
+    return width;
+}
+
+//-----------------------------------------------------------------------------
+// w x h 박스(외곽두께 lw) 안에 cells 크기의 문자열을 표시할 수 있는 최대 scale.
+// 모든 폰트의 크기는 scale에 비례하므로 반복없이 바로 계산한다.
+// (cells = text_cells(str), 표시할 수 없는 경우 0)
+//-----------------------------------------------------------------------------
+int text_fit_scale (int w, int h, int lw, int cells)
+{
+    int w_scale, h_scale;
+
+    w -= lw * 2;    h -= lw * 2;
+    if ((w <= 0) || (h <= 0))
+        return 0;
+
+    h_scale = h / font_cell_h (1);
+    w_scale = cells ? (w / (font_cell_w (1) * cells)) : h_scale;
+
+    return (w_scale < h_scale) ? w_scale : h_scale;
+}
+
+//-----------------------------------------------------------------------------
+// p 부터 len byte 중 max_cells 안에 들어가는 byte 길이 (cells = 들어간 크기)
+//-----------------------------------------------------------------------------
+static int _text_line_cut (const char *p, int len, int max_cells, int *cells)
+{
+    int pos = 0, n, c;
+
+    for (*cells = 0; pos < len; pos += n) {
+        n = _text_next ((const unsigned char *)p + pos, &c);
+        if (*cells + c > max_cells)
+            break;
+        *cells += c;
+    }
+    return pos;
+}
+
+//-----------------------------------------------------------------------------
+// w x h 박스 안에 scale 크기로 표시할 문자열의 줄 나눔과 각 줄의 위치를 계산한다.
+// flags = TEXT_ALIGN_x | TEXT_WRAP_x | TEXT_ELLIPSIS, 결과는 lay에 저장하며
+// 모든 문자열이 박스 안에 표시되는 경우 1을 반환한다. (줄 묶음은 박스의 세로 중앙)
+//-----------------------------------------------------------------------------
+int text_layout (const char *str, int scale, int w, int h, int flags, text_layout_t *lay)
+{
+    int cell_w = font_cell_w (scale), cell_h = font_cell_h (scale);
+    int max_cells, max_lines, cells, brk_cells, n, c, i, y;
+    const char *p = str, *start, *end, *brk;
+    int wrap = flags & (TEXT_WRAP_WORD | TEXT_WRAP_CHAR);
+    text_line_t *l;
+
+    max_cells = (cell_w > 0) ? (w / cell_w) : 0;
+    max_lines = (cell_h > 0) ? (h / cell_h) : 0;
+    if (max_cells < 1)  max_cells = 1;
+    if (max_lines < 1)  max_lines = 1;
+    if (max_lines > TEXT_LINE_MAX)  max_lines = TEXT_LINE_MAX;
+
+    lay->scale = scale;     lay->w = w;     lay->h = h;     lay->flags = flags;
+    lay->lines = 0;         lay->fit = 1;
+
+    while (lay->lines < max_lines) {
+        start = p;  end = NULL;     brk = NULL;
+        cells = 0;  brk_cells = 0;
+
+        while (*p && (*p != '\n')) {
+            n = _text_next ((const unsigned char *)p, &c);
+            if (wrap && cells && (cells + c > max_cells)) {
+                /* 단어 단위 : 마지막 공백에서 자르고 다음 줄 앞의 공백은 생략 */
+                if ((flags & TEXT_WRAP_WORD) && (brk_cells > 0)) {
+                    end = brk;  cells = brk_cells;  p = brk;
+                } else
+                    end = p;
+                while (*p == ' ')
+                    p++;
+                break;
+            }
+            if (*p == ' ') {
+                brk = p;    brk_cells = cells;
+            }
+            cells += c;     p += n;
+        }
+        if (end == NULL) {
+            end = p;
+            if (*p == '\n')
+                p++;
+        }
+        l = &lay->line[lay->lines++];
+        l->off = start - str;   l->len = end - start;
+        l->cells = cells;       l->ellipsis = 0;
+
+        /* 줄바꿈을 하지 않는 경우 넘치는 줄 */
+        if (cells > max_cells) {
+            lay->fit = 0;
+            if (flags & TEXT_ELLIPSIS)
+                l->ellipsis = 1;
+        }
+        if (*p == 0)
+            break;
+    }
+    /* 박스에 표시하지 못한 줄이 남은 경우 */
+    if (*p) {
+        lay->fit = 0;
+        if (flags & TEXT_ELLIPSIS)
+            lay->line[lay->lines - 1].ellipsis = 1;
+    }
+
+    y = (h - lay->lines * cell_h) / 2;
+    for (i = 0, l = lay->line; i < lay->lines; i++, l++) {
+        /* "..."가 들어갈 수 있도록 줄을 자름 (박스가 3 cells 보다 작은 경우는 자르기만 함) */
+        if (l->ellipsis) {
+            c = (max_cells > 3) ? (max_cells - 3) : max_cells;
+            l->len   = _text_line_cut (str + l->off, l->len, c, &cells);
+            l->cells = cells + ((max_cells > 3) ? 3 : 0);
+            if (max_cells <= 3)
+                l->ellipsis = 0;
+        }
+        switch (flags & TEXT_ALIGN_MASK) {
+            case TEXT_ALIGN_L:  l->x = 0;                                   break;
+            case TEXT_ALIGN_R:  l->x = w - l->cells * cell_w;               break;
+            default:            l->x = (w - l->cells * cell_w) / 2;         break;
+        }
+        l->y = (y > 0 ? y : 0) + i * cell_h;
+    }
+    return lay->fit;
+}
+
+//-----------------------------------------------------------------------------
+// text_layout()의 결과를 (x, y) 박스 위치에 그린다.
+//-----------------------------------------------------------------------------
+void draw_layout_r (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                    int f_color, int b_color, const char *str,
+                    const text_layout_t *lay)
+{
+    const text_line_t *l;
+    int i, l_x;
+
+    /* 각 줄은 문자열에서 바로 그린다. (줄 길이 제한 없음) */
+    for (i = 0, l = lay->line; i < lay->lines; i++, l++) {
+        l_x = _draw_ntext (fb, ctx, x + l->x, y + l->y, str + l->off, l->len,
+                            f_color, b_color, lay->scale);
+        if (l->ellipsis)
+            _draw_ntext (fb, ctx, l_x, y + l->y, "...", 3, f_color, b_color, lay->scale);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void draw_line (fb_info_t *fb, int x, int y, int w, int color)
+{
+    _fill_span (fb, x, y, w, color);
 }
 
 //-----------------------------------------------------------------------------
 void draw_rect (fb_info_t *fb, int x, int y, int w, int h, int lw, int color)
 {
-    int dy, i;
+    int dy;
 
     for (dy = 0; dy < h; dy++) {
         if (dy < lw || (dy > (h - lw -1)))
             draw_line (fb, x, y + dy, w, color);
         else {
-            for (i = 0; i < lw; i++) {
-                put_pixel (fb, x + 0    +i, y + dy, color);
-                put_pixel (fb, x + w -1 -i, y + dy, color);
-            }
+            _fill_span (fb, x,          y + dy, lw, color);
+            _fill_span (fb, x + w - lw, y + dy, lw, color);
         }
     }
 }
@@ -359,42 +1362,47 @@ void draw_fill_rect (fb_info_t *fb, int x, int y, int w, int h, int color)
 {
     int dy;
 
-    for (dy = 0; dy < h; dy++)
-        draw_line(fb, x, y + dy, w, color);
+    /* 첫 라인을 그린 후 나머지 라인은 복사 (복사 불가능한 경우 다시 그림) */
+    for (dy = 0; dy < h; dy++) {
+        if (!dy || !_copy_span_row (fb, x, y, y + dy, w))
+            _fill_span (fb, x, y + dy, w, color);
+    }
 }
 
 //-----------------------------------------------------------------------------
 void set_font(enum eFONTS_HANGUL s_font)
 {
-    switch(s_font)
-    {
-        case    eFONT_HANBOOT:
-            HANFONT1 = (unsigned char *)FONT_HANBOOT1;
-            HANFONT2 = (unsigned char *)FONT_HANBOOT2;
-            HANFONT3 = (unsigned char *)FONT_HANBOOT3;
-        break;
-        case    eFONT_HANGODIC:
-            HANFONT1 = (unsigned char *)FONT_HANGODIC1;
-            HANFONT2 = (unsigned char *)FONT_HANGODIC2;
-            HANFONT3 = (unsigned char *)FONT_HANGODIC3;
-        break;
-        case    eFONT_HANPIL:
-            HANFONT1 = (unsigned char *)FONT_HANPIL1;
-            HANFONT2 = (unsigned char *)FONT_HANPIL2;
-            HANFONT3 = (unsigned char *)FONT_HANPIL3;
-        break;
-        case    eFONT_HANSOFT:
-            HANFONT1 = (unsigned char *)FONT_HANSOFT1;
-            HANFONT2 = (unsigned char *)FONT_HANSOFT2;
-            HANFONT3 = (unsigned char *)FONT_HANSOFT3;
-        break;
-        case    eFONT_HAN_DEFAULT:
-        default :
-            HANFONT1 = (unsigned char *)FONT_HANGUL1;
-            HANFONT2 = (unsigned char *)FONT_HANGUL2;
-            HANFONT3 = (unsigned char *)FONT_HANGUL3;
-        break;
-    }
+    /* text context의 f_type이 -1인 경우 사용되는 기본 폰트 */
+    DefaultFont = (_han_font (s_font) == NULL) ? eFONT_HAN_DEFAULT : s_font;
+}
+
+//-----------------------------------------------------------------------------
+// 확대된 문자의 계단 현상을 줄이기 위한 smooth glyph 사용 설정 (0 = disable)
+//-----------------------------------------------------------------------------
+void set_font_smooth (char enable)
+{
+    DefaultSmooth = enable;
+}
+
+//-----------------------------------------------------------------------------
+// f_type, smooth = -1 이면 set_font(), set_font_smooth()의 설정값을 따른다.
+//-----------------------------------------------------------------------------
+void text_ctx_init (fb_text_t *ctx, int f_type, int smooth)
+{
+    memset (ctx, 0, sizeof(fb_text_t));
+    ctx->f_type = f_type;
+    ctx->smooth = smooth;
+}
+
+//-----------------------------------------------------------------------------
+void text_ctx_free (fb_text_t *ctx)
+{
+    if (ctx->cache)
+        font_cache_free (ctx->cache);
+    if (ctx->lut)
+        free (ctx->lut);
+    ctx->cache = NULL;
+    ctx->lut   = NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -412,6 +1420,7 @@ void fb_close (fb_info_t *fb)
             close (fb->fd);
         else
             free (fb->base);
+        text_ctx_free (&fb->text);
         free (fb);
     }
 }
@@ -448,6 +1457,7 @@ void fb_set_rotate (fb_info_t *fb, int rotate)
             fb->rotate = eFB_ROTATE_0;
             break;
     }
+    /* 회전된 glyph cache(font_rot_glyph)는 다음 사용시 새 회전값으로 다시 만들어진다. */
     fprintf(stdout, "%s : rotate = %d\n", __func__, fb->rotate);
 }
 
@@ -470,6 +1480,7 @@ fb_info_t *fb_init (const char *DEVICE_NAME)
         return NULL;
     }
     memset(fb, 0, sizeof(fb_info_t));
+    text_ctx_init (&fb->text, -1, -1);
 
     if (!strncmp ("/dev/", DEVICE_NAME, strlen("/dev/"))) {
         // framebuffer
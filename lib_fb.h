@@ -14,6 +14,9 @@
 #ifndef __LIB_FB_H__
 #define __LIB_FB_H__
 
+//-----------------------------------------------------------------------------
+#include <stdarg.h>
+
 //-----------------------------------------------------------------------------
 // Color table & convert macro
 //-----------------------------------------------------------------------------
@@ -46,6 +49,24 @@ typedef union fb_color__u {
     unsigned int uint;
 }	fb_color_u;
 
+//-----------------------------------------------------------------------------
+// Text render context
+// 폰트 선택 상태와 glyph 작업 버퍼를 가지며, thread 별로 context를 따로 사용하면
+// 여러 thread에서 lock 없이 동시에 문자열을 그릴 수 있다.
+//-----------------------------------------------------------------------------
+typedef struct fb_text__t {
+    // Hangul font(eFONTS_HANGUL), -1 = set_font()로 설정된 기본값 사용
+    int                     f_type;
+    // smooth glyph(0 = disable, 1 = enable), -1 = set_font_smooth() 설정값 사용
+    int                     smooth;
+    // hangul glyph 조합 버퍼 (16x16)
+    unsigned char           img[32];
+    // smooth glyph cache (처음 사용시 할당)
+    struct glyph_cache__t   *cache;
+    // glyph byte -> pixel 변환 table cache (처음 사용시 할당)
+    struct text_lut__t      *lut;
+}   fb_text_t;
+
 typedef struct fb_info__t {
     int     fd;
     int     rotate;
@@ -56,6 +77,8 @@ typedef struct fb_info__t {
     char    is_bgr;
     char    *base;
     char    *data;
+    // draw_text()에서 사용하는 기본 text context
+    fb_text_t   text;
 }	fb_info_t;
 
 //-----------------------------------------------------------------------------
@@ -63,6 +86,7 @@ typedef struct fb_info__t {
 #define FONT_ASCII_WIDTH    8
 #define FONT_HEIGHT         16
 
+// font_load()로 추가된 Hangul font는 eFONT_END 이후의 번호를 사용한다.
 enum eFONTS_HANGUL {
     eFONT_HAN_DEFAULT = 0,
     eFONT_HANBOOT,
@@ -72,20 +96,101 @@ enum eFONTS_HANGUL {
     eFONT_END
 };
 
+//-----------------------------------------------------------------------------
+// Text layout (text_layout)
+// 박스 안에서의 정렬(하위 4bit)과 줄바꿈 방식. '\n'은 항상 줄을 바꾼다.
+//-----------------------------------------------------------------------------
+#define TEXT_ALIGN_C        0x00
+#define TEXT_ALIGN_L        0x01
+#define TEXT_ALIGN_R        0x02
+#define TEXT_ALIGN_MASK     0x0F
+// 단어(공백) 단위 줄바꿈, 공백이 없는 경우 문자 단위로 자름
+#define TEXT_WRAP_WORD      0x10
+// 문자 단위 줄바꿈 (한글 등)
+#define TEXT_WRAP_CHAR      0x20
+// 박스에 들어가지 않는 줄의 끝을 "..."로 표시
+#define TEXT_ELLIPSIS       0x40
+
+#define TEXT_LINE_MAX       16
+
+typedef struct text_line__t {
+    // 문자열 안의 위치(byte), 화면상 크기(cells, "..." 포함)
+    int     off, len, cells;
+    // 줄 끝에 "..." 표시
+    int     ellipsis;
+    // 박스 기준 표시 위치 (pixel)
+    int     x, y;
+}   text_line_t;
+
+typedef struct text_layout__t {
+    // layout 조건 (scale, 박스 크기, flags)
+    int         scale, w, h, flags;
+    // 줄 수, 모든 문자열이 박스에 들어가는 경우 1
+    int         lines, fit;
+    text_line_t line[TEXT_LINE_MAX];
+}   text_layout_t;
+
+//-----------------------------------------------------------------------------
+// Text sprite (sprite_text)
+// 문자열을 fb와 같은 pixel 형식 및 회전 방향의 image로 한번 그려 두고
+// sprite_blit()으로 원하는 위치에 반복하여 복사한다. (고정된 label 등)
+//-----------------------------------------------------------------------------
+#define SPRITE_POOL_MAX     64
+#define SPRITE_STR_MAX      256
+
+typedef struct text_sprite__t {
+    // 화면 좌표 기준 크기 (pixel)
+    int     w, h;
+    // image를 그린 조건 (fb 형식/회전, font, 색상, scale), 다른 경우 다시 그린다.
+    int     bpp, is_bgr, rotate, f_type, smooth, f_color, b_color, scale;
+    // 실제 메모리 방향으로 그려진 image (stride = 회전된 가로 크기 * bpp / 8)
+    // size = 할당된 buffer 크기 (pool에 반환할 때 해제)
+    int     stride, size;
+    char    *data;
+    int     used;
+    char    str[SPRITE_STR_MAX];
+}   text_sprite_t;
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 extern void         put_pixel   (fb_info_t *fb, int x, int y, int color);
 extern void         draw_text   (fb_info_t *fb, int x, int y,
                                     int f_color, int b_color, int scale, char *fmt, ...);
+extern void         draw_vtext  (fb_info_t *fb, int x, int y,
+                                    int f_color, int b_color, int scale, char *fmt, va_list va);
+extern void         draw_text_r (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                                    int f_color, int b_color, int scale, char *fmt, ...);
+extern void         draw_vtext_r (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                                    int f_color, int b_color, int scale, char *fmt, va_list va);
 //-----------------------------------------------------------------------------
 // img_buf size = w * h * bpp / 8
+// 반환값은 문자열 전체를 그리는데 필요한 buffer 크기 (img_buf = NULL 이면 크기만 계산)
 //-----------------------------------------------------------------------------
-extern void         make_draw_text (char *img_buf, int w, int h, int bpp,
+extern int          make_draw_text (char *img_buf, int w, int h, int bpp,
                                     int f_color, int b_color, int scale, char *fmt, ...);
+extern int          make_draw_vtext (char *img_buf, int w, int h, int bpp,
+                                    int f_color, int b_color, int scale, char *fmt, va_list va);
+extern text_sprite_t *sprite_text (fb_info_t *fb, fb_text_t *ctx, text_sprite_t *sp,
+                                    int f_color, int b_color, int scale, const char *str);
+extern void         sprite_blit (fb_info_t *fb, fb_text_t *ctx, text_sprite_t *sp, int x, int y);
+extern void         sprite_free (text_sprite_t *sp);
+extern int          text_next   (const char *p, int *cells);
+extern int          text_decode (const char *p, unsigned int *code);
+extern int          text_cells  (const char *str);
+extern int          text_measure (const char *str, int scale, int *w, int *h);
+extern int          text_fit_scale (int w, int h, int lw, int cells);
+extern int          text_layout (const char *str, int scale, int w, int h, int flags,
+                                    text_layout_t *lay);
+extern void         draw_layout_r (fb_info_t *fb, fb_text_t *ctx, int x, int y,
+                                    int f_color, int b_color, const char *str,
+                                    const text_layout_t *lay);
 extern void         draw_line   (fb_info_t *fb, int x, int y, int w, int color);
 extern void         draw_rect   (fb_info_t *fb, int x, int y, int w, int h, int lw, int color);
 extern void         draw_fill_rect (fb_info_t *fb, int x, int y, int w, int h, int color);
 extern void         set_font    (enum eFONTS_HANGUL s_font);
+extern void         set_font_smooth (char enable);
+extern void         text_ctx_init (fb_text_t *ctx, int f_type, int smooth);
+extern void         text_ctx_free (fb_text_t *ctx);
 extern void         fb_clear    (fb_info_t *fb);
 extern void         fb_close    (fb_info_t *fb);
 extern void         fb_cursor   (char status);
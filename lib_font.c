@@ -0,0 +1,744 @@
+//-----------------------------------------------------------------------------
+/**
+ * @file lib_font.c
+ * @author charles-park (charles.park@hardkernel.com)
+ * @brief bitmap font registry (multi-size ascii face select)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <pthread.h>
+
+#include "lib_fb.h"
+#include "lib_font.h"
+
+//-----------------------------------------------------------------------------
+// Fonts
+//-----------------------------------------------------------------------------
+#include "fonts/FontAscii_8x16.h"
+
+//-----------------------------------------------------------------------------
+// Function prototype define.
+//-----------------------------------------------------------------------------
+int                 font_register   (const font_face_t *face);
+const font_face_t   *font_select    (int px_h, int *scale);
+unsigned int        font_faces_id   (void);
+const unsigned char *font_glyph     (const font_face_t *face, unsigned int code);
+int                 font_load       (const char *path, int *f_type);
+const font_hangul_t *font_hangul    (int f_type);
+void                font_hangul_or  (const font_hangul_t *font,
+                        const font_prow_t *meta, int glyph, unsigned char *dest);
+void                font_unpack_or  (const unsigned char *rows, const font_prow_t *prow,
+                        unsigned char *dest, int pitch, int size);
+int                 font_cell_w     (int scale);
+int                 font_cell_h     (int scale);
+glyph_cache_t       *font_cache_alloc (void);
+void                font_cache_free  (glyph_cache_t *cache);
+const unsigned short *font_smooth_glyph (glyph_cache_t *cache,
+                        const void *font, unsigned int code,
+                        const unsigned char *bitmap, int w, int h, int scale, int rotate);
+const unsigned char *font_rot_glyph (glyph_cache_t *cache,
+                        const void *font, unsigned int code,
+                        const unsigned char *bitmap, int w, int h, int rotate);
+
+//-----------------------------------------------------------------------------
+// 내장 ASCII 폰트. 첫번째 face(8x16)가 기본 폰트이며 모든 크기의 기준이 된다.
+// 16x32 face는 fonts/gen의 packed face를 사용한다. (make fonts)
+//-----------------------------------------------------------------------------
+static const font_face_t FaceAscii_8x16 = {
+    "ascii-8x16",  FONT_ASCII_WIDTH,     FONT_HEIGHT,     1, 256,
+    (const unsigned char *)FONT_ASCII, NULL, 0, NULL
+};
+
+static const font_face_t *FontFaces[FONT_FACE_MAX] = {
+    &FaceAscii_8x16,
+    &FontAscii_16x32,
+};
+static int FontFaceCnt = 2;
+
+//-----------------------------------------------------------------------------
+// packed face의 glyph를 처음 사용할 때 풀어두는 buffer (face 별)
+//-----------------------------------------------------------------------------
+typedef struct face_unpack__t {
+    const font_face_t   *face;
+    unsigned char       *bitmap;
+    // glyph 별 unpack 여부 (bit)
+    unsigned char       *done;
+}   face_unpack_t;
+
+static face_unpack_t    FaceUnpack[FONT_FACE_MAX];
+// 이미 풀어둔 glyph 검색은 read lock, unpack buffer 할당/glyph unpack은 write lock
+static pthread_rwlock_t FaceLock = PTHREAD_RWLOCK_INITIALIZER;
+
+//-----------------------------------------------------------------------------
+// font_load로 mmap 되어진 font file.
+// Hangul font는 eFONT_END + n 번호로 set_font/f_type 에서 사용한다.
+//-----------------------------------------------------------------------------
+typedef struct font_file_map__t {
+    void                *map;
+    size_t              size;
+    char                name[32];
+    font_face_t         face;
+    // PSF2 unicode table에서 생성한 index (malloc)
+    font_index_t        *index;
+    font_hangul_t       hangul;
+}   font_file_map_t;
+
+static font_file_map_t FontFiles[FONT_FILE_MAX];
+static font_file_map_t *FontHangul[FONT_FILE_MAX];
+static int FontFileCnt = 0, FontHangulCnt = 0;
+
+// PSF2 (Linux console font) header
+#define PSF2_MAGIC          0x864AB572
+#define PSF2_HAS_UNICODE    0x01
+
+typedef struct psf2_header__t {
+    unsigned int        magic, version, headersize, flags;
+    unsigned int        length, charsize, height, width;
+}   psf2_header_t;
+
+//-----------------------------------------------------------------------------
+// Smooth glyph cache (font, code, scale, rotate)
+//-----------------------------------------------------------------------------
+typedef struct glyph_entry__t {
+    const void      *font;
+    unsigned int    code;
+    int             scale, rotate;
+    unsigned short  *runs;
+}   glyph_entry_t;
+
+//-----------------------------------------------------------------------------
+// 90/270도 회전 화면용 glyph cache (font, code, rotate)
+// 원본 glyph(w x h)의 세로줄을 실제 메모리의 가로줄로 바꾼 bitmap (h x w, row당 (h+7)/8 bytes)
+//-----------------------------------------------------------------------------
+typedef struct glyph_rot__t {
+    const void      *font;
+    unsigned int    code;
+    int             rotate, w, h;
+    unsigned char   *bitmap;
+}   glyph_rot_t;
+
+struct glyph_cache__t {
+    glyph_entry_t   entry[GLYPH_CACHE_SIZE];
+    glyph_rot_t     rot[GLYPH_CACHE_SIZE];
+};
+
+//-----------------------------------------------------------------------------
+int font_register (const font_face_t *face)
+{
+    if ((face == NULL) || (FontFaceCnt >= FONT_FACE_MAX)) {
+        fprintf(stdout, "%s : font face register fail!\n", __func__);
+        return -1;
+    }
+    FontFaces[FontFaceCnt] = face;
+    return FontFaceCnt++;
+}
+
+//-----------------------------------------------------------------------------
+// 요청 높이(px_h)를 정수배로 맞출수 있는 가장 큰 native face를 선택하고
+// 나머지 배율을 scale로 반환한다. (기본 폰트와 가로/세로 비율이 같은 face만 사용)
+// ex) px_h = 64 -> 16x32 x 2, px_h = 48 -> 8x16 x 3
+//-----------------------------------------------------------------------------
+const font_face_t *font_select (int px_h, int *scale)
+{
+    const font_face_t *face, *sel = FontFaces[0];
+    int i;
+
+    for (i = 1; i < FontFaceCnt; i++) {
+        face = FontFaces[i];
+        if (face->w * FONT_HEIGHT != FONT_ASCII_WIDTH * face->h)
+            continue;
+        if ((face->h > sel->h) && (face->h <= px_h) && !(px_h % face->h))
+            sel = face;
+    }
+    *scale = px_h / sel->h;
+    return sel;
+}
+
+//-----------------------------------------------------------------------------
+// 등록된 face 목록(순서, w/h)의 fingerprint. font_select 결과가 바뀌는지 검사하는데 사용한다.
+//-----------------------------------------------------------------------------
+unsigned int font_faces_id (void)
+{
+    unsigned int id = 2166136261u;
+    int i;
+
+    for (i = 0; i < FontFaceCnt; i++) {
+        id = (id ^ (unsigned int)FontFaces[i]->w) * 16777619u;
+        id = (id ^ (unsigned int)FontFaces[i]->h) * 16777619u;
+    }
+    return id;
+}
+
+//-----------------------------------------------------------------------------
+// 이미 풀어둔 glyph. 아직 풀지 않은 경우 NULL (read lock)
+//-----------------------------------------------------------------------------
+static const unsigned char *_font_unpacked (const font_face_t *face, unsigned int glyph)
+{
+    const face_unpack_t *u;
+    int i;
+
+    for (i = 0, u = FaceUnpack; (i < FONT_FACE_MAX) && (u->face != NULL); i++, u++) {
+        if (u->face != face)
+            continue;
+        if (u->done[glyph >> 3] & (0x80 >> (glyph & 7)))
+            return u->bitmap + glyph * face->h * face->pitch;
+        break;
+    }
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+// packed face의 glyph를 풀어서 반환한다. (glyph 단위로 처음 사용할 때 1번만 풀어둠)
+// 풀어둔 glyph는 read lock으로 찾으므로 여러 thread에서 동시에 그릴 수 있다.
+//-----------------------------------------------------------------------------
+static const unsigned char *_font_unpack_glyph (const font_face_t *face, unsigned int glyph)
+{
+    face_unpack_t *u = NULL;
+    int i, size = face->h * face->pitch;
+    const unsigned char *p_img;
+
+    pthread_rwlock_rdlock (&FaceLock);
+    p_img = _font_unpacked (face, glyph);
+    pthread_rwlock_unlock (&FaceLock);
+    if (p_img != NULL)
+        return p_img;
+
+    pthread_rwlock_wrlock (&FaceLock);
+    for (i = 0; i < FONT_FACE_MAX; i++) {
+        if ((FaceUnpack[i].face == face) || (FaceUnpack[i].face == NULL)) {
+            u = &FaceUnpack[i];
+            break;
+        }
+    }
+    if ((u != NULL) && (u->face == NULL)) {
+        u->bitmap = (unsigned char *)calloc (face->count, size);
+        u->done   = (unsigned char *)calloc ((face->count + 7) / 8, 1);
+        if ((u->bitmap == NULL) || (u->done == NULL)) {
+            fprintf(stdout, "%s : %s unpack malloc error!\n", __func__, face->name);
+            free (u->bitmap);   free (u->done);
+            u->bitmap = NULL;   u->done = NULL;
+            u = NULL;
+        } else
+            u->face = face;
+    }
+    if (u != NULL) {
+        if (!(u->done[glyph >> 3] & (0x80 >> (glyph & 7)))) {
+            font_unpack_or (face->bitmap, &face->pack[glyph], u->bitmap + glyph * size,
+                            face->pitch, size);
+            u->done[glyph >> 3] |= (0x80 >> (glyph & 7));
+        }
+        p_img = u->bitmap + glyph * size;
+    }
+    pthread_rwlock_unlock (&FaceLock);
+    return p_img;
+}
+
+//-----------------------------------------------------------------------------
+// code에 해당하는 glyph bitmap. face에 없는 문자는 NULL.
+//-----------------------------------------------------------------------------
+const unsigned char *font_glyph (const font_face_t *face, unsigned int code)
+{
+    int lo = 0, hi = face->index_cnt - 1, mid;
+    unsigned int glyph = (unsigned int)face->count;
+
+    if (face->index == NULL)
+        glyph = code;
+
+    while ((face->index != NULL) && (lo <= hi)) {
+        mid = (lo + hi) / 2;
+        if      (face->index[mid].code < code)  lo = mid + 1;
+        else if (face->index[mid].code > code)  hi = mid - 1;
+        else {
+            glyph = face->index[mid].glyph;
+            break;
+        }
+    }
+    if (glyph >= (unsigned int)face->count)
+        return NULL;
+
+    return face->pack ? _font_unpack_glyph (face, glyph) :
+                        face->bitmap + glyph * face->h * face->pitch;
+}
+
+//-----------------------------------------------------------------------------
+// 같은 크기의 face가 등록되어 있으면 교체하고 없으면 추가한다. (file font 우선)
+//-----------------------------------------------------------------------------
+static int _font_face_add (const font_face_t *face)
+{
+    int i;
+
+    for (i = 0; i < FontFaceCnt; i++) {
+        if ((FontFaces[i]->w == face->w) && (FontFaces[i]->h == face->h)) {
+            FontFaces[i] = face;
+            return i;
+        }
+    }
+    return font_register (face);
+}
+
+//-----------------------------------------------------------------------------
+static int _code_cmp (const void *a, const void *b)
+{
+    const font_index_t *ia = a, *ib = b;
+
+    return (ia->code > ib->code) - (ia->code < ib->code);
+}
+
+//-----------------------------------------------------------------------------
+// PSF2 unicode table -> font_index_t (UTF-8 문자열, 0xFE = sequence 시작, 0xFF = glyph 끝)
+// sequence(조합문자)는 사용하지 않는다.
+//-----------------------------------------------------------------------------
+static font_index_t *_psf2_index (const unsigned char *p, const unsigned char *end,
+                                    int glyphs, int *index_cnt)
+{
+    font_index_t *index;
+    int glyph = 0, cnt = 0, size = glyphs * 2, seq = 0;
+    unsigned int code, n;
+
+    if ((index = (font_index_t *)malloc (size * sizeof(font_index_t))) == NULL)
+        return NULL;
+
+    while ((p < end) && (glyph < glyphs)) {
+        if (*p == 0xFF) {   glyph++;    seq = 0;    p++;    continue;   }
+        if (*p == 0xFE) {   seq = 1;                p++;    continue;   }
+
+        /* UTF-8 decode */
+        if      (*p < 0x80) {   code = *p;          n = 0;  }
+        else if (*p < 0xE0) {   code = *p & 0x1F;   n = 1;  }
+        else if (*p < 0xF0) {   code = *p & 0x0F;   n = 2;  }
+        else                {   code = *p & 0x07;   n = 3;  }
+        for (p++; n && (p < end); n--, p++)
+            code = (code << 6) | (*p & 0x3F);
+
+        if (seq)
+            continue;
+        if (cnt >= size) {
+            font_index_t *t;
+            size *= 2;
+            if ((t = (font_index_t *)realloc (index, size * sizeof(font_index_t))) == NULL) {
+                free (index);
+                return NULL;
+            }
+            index = t;
+        }
+        index[cnt].code = code;     index[cnt].glyph = glyph;   cnt++;
+    }
+    qsort (index, cnt, sizeof(font_index_t), _code_cmp);
+    *index_cnt = cnt;
+    return index;
+}
+
+//-----------------------------------------------------------------------------
+static int _font_load_psf2 (font_file_map_t *f, const char *path)
+{
+    const psf2_header_t *hdr = (const psf2_header_t *)f->map;
+    const unsigned char *base = (const unsigned char *)f->map;
+    size_t glyph_end;
+
+    if ((f->size < sizeof(psf2_header_t)) || (hdr->magic != PSF2_MAGIC))
+        return -1;
+
+    glyph_end = hdr->headersize + (size_t)hdr->length * hdr->charsize;
+    if ((hdr->width == 0) || (hdr->height == 0) || (glyph_end > f->size) ||
+        (hdr->charsize != hdr->height * ((hdr->width + 7) / 8)))
+        return -1;
+
+    f->face.w      = hdr->width;
+    f->face.h      = hdr->height;
+    f->face.pitch  = (hdr->width + 7) / 8;
+    f->face.count  = hdr->length;
+    f->face.bitmap = base + hdr->headersize;
+
+    if (hdr->flags & PSF2_HAS_UNICODE) {
+        f->index = _psf2_index (base + glyph_end, base + f->size,
+                                    hdr->length, &f->face.index_cnt);
+        f->face.index = f->index;
+    }
+
+    strncpy (f->name, (strrchr (path, '/') ? strrchr (path, '/') + 1 : path), sizeof(f->name) -1);
+    f->face.name = f->name;
+    return eFONT_FILE_ASCII;
+}
+
+//-----------------------------------------------------------------------------
+static int _font_load_fbfn (font_file_map_t *f)
+{
+    const font_file_t *hdr = (const font_file_t *)f->map;
+    const unsigned char *base = (const unsigned char *)f->map;
+
+    if ((f->size < sizeof(font_file_t)) ||
+        memcmp (hdr->magic, FONT_FILE_MAGIC, sizeof(hdr->magic)) ||
+        (hdr->version != FONT_FILE_VERSION) || (hdr->type >= eFONT_FILE_END))
+        return -1;
+
+    if ((hdr->w == 0) || (hdr->h == 0) || (hdr->pitch < (hdr->w + 7) / 8) ||
+        (hdr->index_off + (size_t)hdr->index_cnt * sizeof(font_index_t) > f->size) ||
+        (hdr->glyph_off + (size_t)hdr->count * hdr->h * hdr->pitch > f->size))
+        return -1;
+
+    if ((hdr->type == eFONT_FILE_HANGUL) &&
+        ((hdr->w != FONT_HANGUL_WIDTH) || (hdr->h != FONT_HEIGHT) ||
+         (hdr->pitch != 2) || (hdr->count < FONT_HANGUL_GLYPHS)))
+        return -1;
+
+    memcpy (f->name, hdr->name, sizeof(hdr->name));
+    f->face.name      = f->name;
+    f->face.w         = hdr->w;
+    f->face.h         = hdr->h;
+    f->face.pitch     = hdr->pitch;
+    f->face.count     = hdr->count;
+    f->face.bitmap    = base + hdr->glyph_off;
+    f->face.index     = hdr->index_cnt ? (const font_index_t *)(base + hdr->index_off) : NULL;
+    f->face.index_cnt = hdr->index_cnt;
+
+    if (hdr->type == eFONT_FILE_HANGUL) {
+        f->hangul.name = f->name;
+        f->hangul.rows = f->face.bitmap;
+    }
+    return hdr->type;
+}
+
+//-----------------------------------------------------------------------------
+// font file을 mmap 하여 등록한다. (사용하는 glyph page만 메모리에 올라옴)
+// ASCII face는 같은 크기의 내장 face를 대체하며, Hangul font는 f_type에 번호를 반환.
+// return : eFONT_FILE_xxx, 실패시 -1
+//-----------------------------------------------------------------------------
+int font_load (const char *path, int *f_type)
+{
+    font_file_map_t *f;
+    struct stat st;
+    int fd, type = -1;
+
+    if (FontFileCnt >= FONT_FILE_MAX) {
+        fprintf(stdout, "%s : font file slot full!\n", __func__);
+        return -1;
+    }
+    if ((fd = open (path, O_RDONLY)) < 0) {
+        fprintf(stdout, "%s : %s file not found!\n", __func__, path);
+        return -1;
+    }
+    f = &FontFiles[FontFileCnt];
+    memset (f, 0, sizeof(font_file_map_t));
+
+    if ((fstat (fd, &st) == 0) && (st.st_size > 0)) {
+        f->size = st.st_size;
+        f->map  = mmap (NULL, f->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close (fd);
+
+    if ((f->map == NULL) || (f->map == MAP_FAILED)) {
+        fprintf(stdout, "%s : %s mmap error!\n", __func__, path);
+        return -1;
+    }
+
+    if ((type = _font_load_fbfn (f)) < 0)
+        type = _font_load_psf2 (f, path);
+
+    switch (type) {
+        case eFONT_FILE_ASCII:
+            if (_font_face_add (&f->face) < 0)
+                type = -1;
+            break;
+        case eFONT_FILE_HANGUL:
+            FontHangul[FontHangulCnt] = f;
+            if (f_type)
+                *f_type = eFONT_END + FontHangulCnt;
+            FontHangulCnt++;
+            break;
+        default :
+            fprintf(stdout, "%s : %s unknown font format!\n", __func__, path);
+            break;
+    }
+    if (type < 0) {
+        if (f->index)
+            free (f->index);
+        munmap (f->map, f->size);
+        return -1;
+    }
+    FontFileCnt++;
+    return type;
+}
+
+//-----------------------------------------------------------------------------
+// font_load로 등록된 Hangul font (f_type = eFONT_END + n)
+//-----------------------------------------------------------------------------
+const font_hangul_t *font_hangul (int f_type)
+{
+    f_type -= eFONT_END;
+    if ((f_type < 0) || (f_type >= FontHangulCnt))
+        return NULL;
+    return &FontHangul[f_type]->hangul;
+}
+
+//-----------------------------------------------------------------------------
+// glyph를 dest(16x16, 32 bytes)에 OR 한다. meta = font->jamo 또는 font->syllable
+// meta == NULL 이면 rows는 원본 glyph (font file)
+//-----------------------------------------------------------------------------
+void font_hangul_or (const font_hangul_t *font,
+                        const font_prow_t *meta, int glyph, unsigned char *dest)
+{
+    const unsigned char *src;
+    int i;
+
+    if (meta == NULL) {
+        src = font->rows + glyph * 32;
+        for (i = 0; i < 32; i++)
+            dest[i] |= src[i];
+    } else
+        font_unpack_or (font->rows, &meta[glyph], dest, FONT_HANGUL_WIDTH / 8, 32);
+}
+
+//-----------------------------------------------------------------------------
+// packed glyph(rows + prow->offset)를 dest(size bytes, row 당 pitch bytes)에 OR 한다.
+// 0x00 byte(mask bit 0)와 0x00 row(code 0)는 건너뛴다.
+//-----------------------------------------------------------------------------
+void font_unpack_or (const unsigned char *rows, const font_prow_t *prow,
+                        unsigned char *dest, int pitch, int size)
+{
+    const unsigned char *src = rows + (prow->offset & ~FONT_PACK_ROW), *payload, *row;
+    int i, b, m;
+
+    if (prow->offset & FONT_PACK_ROW) {
+        payload = src + FONT_PACK_CODE(size / pitch);
+        for (i = 0, row = NULL; i < size / pitch; i++, dest += pitch) {
+            m = (src[i >> 2] >> (6 - (i & 3) * 2)) & 0x03;
+            if (m == 2) {
+                row = payload;
+                payload += pitch;
+            } else if ((m == 0) || (row == NULL))
+                continue;
+            for (b = 0; b < pitch; b++)
+                dest[b] |= row[b];
+        }
+        return;
+    }
+    payload = src + FONT_PACK_MASK(size);
+    for (i = 0; i < size; i += 8) {
+        if (!(m = src[i >> 3]))
+            continue;
+        for (b = 0; m; b++, m = (m << 1) & 0xFF)
+            if (m & 0x80)
+                dest[i + b] |= *payload++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// scale 배율에서 ASCII 1문자의 화면상 크기(pixel). 한글은 가로 2칸을 사용한다.
+//-----------------------------------------------------------------------------
+int font_cell_w (int scale)
+{
+    int f_scale;
+    const font_face_t *face = font_select (FONT_HEIGHT * scale, &f_scale);
+
+    return face->w * f_scale;
+}
+
+//-----------------------------------------------------------------------------
+int font_cell_h (int scale)
+{
+    int f_scale;
+    const font_face_t *face = font_select (FONT_HEIGHT * scale, &f_scale);
+
+    return face->h * f_scale;
+}
+
+//-----------------------------------------------------------------------------
+static int _get_bit (const unsigned char *bitmap, int pitch, int w, int h, int x, int y)
+{
+    if ((x < 0) || (y < 0) || (x >= w) || (y >= h))
+        return 0;
+    return (bitmap[y * pitch + (x >> 3)] & (0x80 >> (x & 7))) ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+// 원본 bitmap을 bilinear로 보간한 외곽선(0.5)을 기준으로
+// 확대 pixel 1개당 GLYPH_SUPERSAMPLE^2 개의 sample 중 안쪽에 있는 비율을 alpha로 사용한다.
+// 주변 원본 pixel이 모두 같은 경우(글자 안쪽/바깥쪽)는 sample 계산을 생략한다.
+//-----------------------------------------------------------------------------
+static unsigned short *_smooth_glyph (const unsigned char *bitmap, int w, int h, int scale)
+{
+    int pitch = (w + 7) / 8, ow = w * scale, oh = h * scale;
+    int ox, oy, sx, sy, cx, cy, cnt, x0, y0, pos, size, n, alpha, len, i;
+    unsigned char *row_a;
+    unsigned short *runs, *p;
+    const int ss = GLYPH_SUPERSAMPLE;
+
+    size = oh * 8;
+    row_a = (unsigned char *)malloc (ow);
+    runs  = (unsigned short *)malloc (size * sizeof(unsigned short));
+    if ((row_a == NULL) || (runs == NULL))
+        goto err;
+
+    for (oy = 0, pos = 0; oy < oh; oy++) {
+        /* row 안의 sample 좌표 범위 (원본 pixel 중심 기준) */
+        int ya = (int)((oy + 0.5f / ss) / scale - 0.5f + 8) - 8;
+        int yb = (int)((oy + 1 - 0.5f / ss) / scale - 0.5f + 8) - 8 + 1;
+
+        for (ox = 0; ox < ow; ox++) {
+            int xa = (int)((ox + 0.5f / ss) / scale - 0.5f + 8) - 8;
+            int xb = (int)((ox + 1 - 0.5f / ss) / scale - 0.5f + 8) - 8 + 1;
+            int first = _get_bit (bitmap, pitch, w, h, xa, ya), uniform = 1;
+
+            for (cy = ya; uniform && (cy <= yb); cy++)
+                for (cx = xa; cx <= xb; cx++)
+                    if (_get_bit (bitmap, pitch, w, h, cx, cy) != first) {
+                        uniform = 0;
+                        break;
+                    }
+            if (uniform) {
+                row_a[ox] = first ? 255 : 0;
+                continue;
+            }
+            for (sy = 0, cnt = 0; sy < ss; sy++) {
+                float v = (oy + (sy + 0.5f) / ss) / scale - 0.5f, fy;
+
+                y0 = (int)(v + 8) - 8;  fy = v - y0;
+                for (sx = 0; sx < ss; sx++) {
+                    float u = (ox + (sx + 0.5f) / ss) / scale - 0.5f, fx, f;
+
+                    x0 = (int)(u + 8) - 8;  fx = u - x0;
+                    f = (1 - fx) * (1 - fy) * _get_bit (bitmap, pitch, w, h, x0,     y0)
+                      + (    fx) * (1 - fy) * _get_bit (bitmap, pitch, w, h, x0 + 1, y0)
+                      + (1 - fx) * (    fy) * _get_bit (bitmap, pitch, w, h, x0,     y0 + 1)
+                      + (    fx) * (    fy) * _get_bit (bitmap, pitch, w, h, x0 + 1, y0 + 1);
+                    if (f >= 0.5f)
+                        cnt++;
+                }
+            }
+            row_a[ox] = (cnt * 255) / (ss * ss);
+        }
+
+        /* alpha row -> run 변환 (최대 ow개의 run) */
+        if (pos + 1 + ow * 2 > size) {
+            size = (pos + 1 + ow * 2) * 2;
+            if ((p = (unsigned short *)realloc (runs, size * sizeof(unsigned short))) == NULL)
+                goto err;
+            runs = p;
+        }
+        for (i = 0, n = 0, p = &runs[pos + 1]; i < ow; i += len, n++) {
+            alpha = row_a[i];
+            for (len = 1; (i + len < ow) && (row_a[i + len] == alpha); len++);
+            *p++ = len;     *p++ = alpha;
+        }
+        runs[pos] = n;
+        pos += 1 + n * 2;
+    }
+    free (row_a);
+    return runs;
+err:
+    fprintf(stdout, "%s : smooth glyph malloc error!\n", __func__);
+    if (row_a)  free (row_a);
+    if (runs)   free (runs);
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+glyph_cache_t *font_cache_alloc (void)
+{
+    glyph_cache_t *cache = (glyph_cache_t *)malloc (sizeof(glyph_cache_t));
+
+    if (cache != NULL)
+        memset (cache, 0, sizeof(glyph_cache_t));
+    return cache;
+}
+
+//-----------------------------------------------------------------------------
+void font_cache_free (glyph_cache_t *cache)
+{
+    int i;
+
+    if (cache) {
+        for (i = 0; i < GLYPH_CACHE_SIZE; i++) {
+            if (cache->entry[i].runs)
+                free (cache->entry[i].runs);
+            if (cache->rot[i].bitmap)
+                free (cache->rot[i].bitmap);
+        }
+        free (cache);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// 확대된 smooth glyph를 반환한다. 처음 요청시 생성하여 cache에 저장하며
+// 이후 같은 (font, code, scale, rotate) 요청은 cache된 run을 그대로 사용한다.
+// rotate는 bitmap이 font_rot_glyph()로 회전된 경우 그 회전값 (그 외 0)
+//-----------------------------------------------------------------------------
+const unsigned short *font_smooth_glyph (glyph_cache_t *cache,
+                        const void *font, unsigned int code,
+                        const unsigned char *bitmap, int w, int h, int scale, int rotate)
+{
+    glyph_entry_t *c;
+    unsigned int hash;
+
+    hash = ((unsigned int)(unsigned long)font >> 4) ^ (code * 31) ^ (scale * 131) ^ rotate;
+    c = &cache->entry[hash % GLYPH_CACHE_SIZE];
+
+    if ((c->runs != NULL) && (c->font == font) && (c->code == code) &&
+        (c->scale == scale) && (c->rotate == rotate))
+        return c->runs;
+
+    if (c->runs)
+        free (c->runs);
+
+    c->font  = font;    c->code  = code;    c->scale = scale;   c->rotate = rotate;
+    c->runs  = _smooth_glyph (bitmap, w, h, scale);
+    return c->runs;
+}
+
+//-----------------------------------------------------------------------------
+// 90/270도 회전 화면에서 사용할 glyph를 반환한다. (처음 요청시 생성)
+// 반환된 bitmap의 각 row는 실제 메모리의 연속된 가로줄이 되며 크기는 h x w 이다.
+//   90 : 시계방향 회전  dest(x, y) = src(y, h - 1 - x)
+//  270 : 반시계방향 회전 dest(x, y) = src(w - 1 - y, x)
+// 화면 회전이 바뀐 경우 cache는 다음 요청시 새 회전값으로 다시 만들어진다.
+//-----------------------------------------------------------------------------
+const unsigned char *font_rot_glyph (glyph_cache_t *cache,
+                        const void *font, unsigned int code,
+                        const unsigned char *bitmap, int w, int h, int rotate)
+{
+    glyph_rot_t *c;
+    unsigned int hash;
+    int s_pitch = (w + 7) / 8, d_pitch = (h + 7) / 8, x, y, sx, sy;
+
+    hash = ((unsigned int)(unsigned long)font >> 4) ^ (code * 31);
+    c = &cache->rot[hash % GLYPH_CACHE_SIZE];
+
+    if ((c->bitmap != NULL) && (c->font == font) && (c->code == code) && (c->rotate == rotate))
+        return c->bitmap;
+
+    /* 같은 크기의 glyph인 경우 buffer를 다시 사용 */
+    if ((c->bitmap != NULL) && ((c->w != w) || (c->h != h))) {
+        free (c->bitmap);
+        c->bitmap = NULL;
+    }
+    if ((c->bitmap == NULL) && ((c->bitmap = (unsigned char *)malloc (d_pitch * w)) == NULL))
+        return NULL;
+
+    memset (c->bitmap, 0, d_pitch * w);
+    for (y = 0; y < w; y++) {
+        for (x = 0; x < h; x++) {
+            sx = (rotate == 90) ? y         : w - 1 - y;
+            sy = (rotate == 90) ? h - 1 - x : x;
+            if (bitmap[sy * s_pitch + (sx >> 3)] & (0x80 >> (sx & 7)))
+                c->bitmap[y * d_pitch + (x >> 3)] |= 0x80 >> (x & 7);
+        }
+    }
+    c->font = font;     c->code = code;     c->rotate = rotate;
+    c->w    = w;        c->h    = h;
+    return c->bitmap;
+}
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
@@ -0,0 +1,158 @@
+//-----------------------------------------------------------------------------
+/**
+ * @file lib_font.h
+ * @author charles-park (charles.park@hardkernel.com)
+ * @brief bitmap font registry header file.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+#ifndef __LIB_FONT_H__
+#define __LIB_FONT_H__
+
+//-----------------------------------------------------------------------------
+// ASCII font face
+//-----------------------------------------------------------------------------
+#define FONT_FACE_MAX       8
+
+// code -> glyph 번호 (code 오름차순 정렬)
+typedef struct font_index__t {
+    unsigned int        code, glyph;
+}   font_index_t;
+
+typedef struct font_face__t {
+    const char          *name;
+    // glyph cell size (pixel)
+    int                 w, h;
+    // bytes per glyph row
+    int                 pitch;
+    // glyph count (index == NULL 이면 code 0 ~ count-1)
+    int                 count;
+    const unsigned char *bitmap;
+    const font_index_t  *index;
+    int                 index_cnt;
+    // packed face (fonts/gen), NULL 이면 bitmap은 원본 glyph
+    // packed face의 bitmap은 packed rows이며 glyph는 처음 사용할 때 풀어서 사용한다.
+    const struct font_prow__t *pack;
+}   font_face_t;
+
+//-----------------------------------------------------------------------------
+// Packed glyph (tools/fontc 에서 생성한 fonts/gen/*.c)
+// glyph 별로 작은 쪽의 coding을 사용하며, 같은 glyph는 같은 offset을 사용한다.
+// byte mask : byte 단위 mask(bit = 1 이면 0이 아닌 byte)와 0이 아닌 byte만 저장한다.
+//   rows[offset] : [mask (FONT_PACK_MASK(glyph bytes))] [payload]
+// row (offset에 FONT_PACK_ROW 설정) : row 별 2 bit code와 새 row만 저장한다.
+//   rows[offset] : [code (FONT_PACK_CODE(glyph rows))] [row (pitch bytes) x code 2 개수]
+//   code : 0 = 0x00 row, 1 = 이전 row 반복, 2 = payload의 다음 row
+//-----------------------------------------------------------------------------
+#define FONT_PACK_MASK(size)    (((size) + 7) / 8)
+#define FONT_PACK_CODE(h)       (((h) + 3) / 4)
+#define FONT_PACK_ROW           0x80000000u
+
+typedef struct font_prow__t {
+    // rows[] 안의 시작 위치 (byte) | FONT_PACK_ROW
+    unsigned int        offset;
+}   font_prow_t;
+
+// 16x16 조합형 Hangul font (glyph 번호는 초성, 중성, 종성 순서)
+typedef struct font_hangul__t {
+    const char          *name;
+    // jamo == NULL 이면 rows는 glyph당 32 bytes의 원본 bitmap
+    const font_prow_t   *jamo;
+    // 완성형 glyph (가 ~ 힣, FONT_HANGUL_SYLLABLES 개), 없으면 NULL
+    const font_prow_t   *syllable;
+    const unsigned char *rows;
+    // 90도 회전된 glyph table (fontc -r), 없으면 NULL
+    const struct font_hangul__t *rot90;
+}   font_hangul_t;
+
+//-----------------------------------------------------------------------------
+// Font file (font_load 에서 mmap 하여 사용, little endian)
+//   [font_file_t][font_index_t x index_cnt][glyph (h * pitch bytes) x count]
+// Hangul 파일은 16x16 조합형 glyph를 초성(8x20), 중성(4x22), 종성(4x28) 순서로 저장한다.
+// Linux console font(PSF2, 압축되지 않은 파일)도 ASCII face로 읽을 수 있다.
+//-----------------------------------------------------------------------------
+#define FONT_FILE_MAGIC     "FBFN"
+#define FONT_FILE_VERSION   1
+#define FONT_FILE_MAX       8
+
+#define FONT_HANGUL_F_CNT   (8 * 20)
+#define FONT_HANGUL_M_CNT   (4 * 22)
+#define FONT_HANGUL_L_CNT   (4 * 28)
+#define FONT_HANGUL_GLYPHS  (FONT_HANGUL_F_CNT + FONT_HANGUL_M_CNT + FONT_HANGUL_L_CNT)
+#define FONT_HANGUL_SYLLABLES   11172
+
+enum eFONT_FILE_TYPE {
+    eFONT_FILE_ASCII = 0,
+    eFONT_FILE_HANGUL,
+    eFONT_FILE_END
+};
+
+typedef struct font_file__t {
+    char                magic[4];
+    unsigned int        version;
+    unsigned int        type;
+    unsigned int        w, h, pitch;
+    unsigned int        count;
+    unsigned int        index_cnt;
+    // file 시작 기준 offset
+    unsigned int        index_off, glyph_off;
+    char                name[24];
+}   font_file_t;
+
+//-----------------------------------------------------------------------------
+// Smooth(anti-aliased) glyph
+// 확대된 glyph의 각 row는 run 단위로 저장된다.
+//   row : [run count(n)] [len, alpha] x n    (alpha 0 = 배경, 255 = 전경)
+//-----------------------------------------------------------------------------
+#define GLYPH_CACHE_SIZE    256
+#define GLYPH_SUPERSAMPLE   4
+
+// render context(fb_text_t) 별로 소유하는 glyph cache (smooth glyph, 회전된 glyph)
+typedef struct glyph_cache__t glyph_cache_t;
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+extern int                  font_register   (const font_face_t *face);
+extern const font_face_t    *font_select    (int px_h, int *scale);
+extern unsigned int         font_faces_id   (void);
+extern const unsigned char  *font_glyph     (const font_face_t *face, unsigned int code);
+extern int                  font_load       (const char *path, int *f_type);
+extern const font_hangul_t  *font_hangul    (int f_type);
+extern void                 font_hangul_or  (const font_hangul_t *font,
+                                const font_prow_t *meta, int glyph, unsigned char *dest);
+extern void                 font_unpack_or  (const unsigned char *rows, const font_prow_t *prow,
+                                unsigned char *dest, int pitch, int size);
+
+//-----------------------------------------------------------------------------
+// fonts/gen (tools/fontc 생성) 내장 font
+//-----------------------------------------------------------------------------
+extern const font_face_t    FontAscii_16x32;
+extern const font_hangul_t  FontHangul_Myeongjo;
+extern const font_hangul_t  FontHangul_Hanboot;
+extern const font_hangul_t  FontHangul_Hangodic;
+extern const font_hangul_t  FontHangul_Hanpil;
+extern const font_hangul_t  FontHangul_Hansoft;
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+extern int                  font_cell_w     (int scale);
+extern int                  font_cell_h     (int scale);
+extern glyph_cache_t        *font_cache_alloc (void);
+extern void                 font_cache_free  (glyph_cache_t *cache);
+extern const unsigned short *font_smooth_glyph (glyph_cache_t *cache,
+                                const void *font, unsigned int code,
+                                const unsigned char *bitmap, int w, int h, int scale, int rotate);
+extern const unsigned char  *font_rot_glyph (glyph_cache_t *cache,
+                                const void *font, unsigned int code,
+                                const unsigned char *bitmap, int w, int h, int rotate);
+
+//------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------
+#endif  // #define __LIB_FONT_H__
+//------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------
@@ -28,6 +28,7 @@
 #include <getopt.h>
 
 #include "lib_fb.h"
+#include "lib_font.h"
 #include "lib_ui.h"
 
 //------------------------------------------------------------------------------
@@ -42,6 +43,9 @@ const char *OPT_TEXT_STR = "FrameBuffer 테스트 프로그램입니다.";
 unsigned int opt_x = 0, opt_y = 0, opt_width = 0, opt_height = 0, opt_color = 0, opt_fb_rotate = 0;
 unsigned char opt_red = 0, opt_green = 0, opt_blue = 0, opt_thckness = 1, opt_scale = 1;
 unsigned char opt_clear = 0, opt_fill = 0, opt_info = 0, opt_font = 0, opt_ui_cfg = 0;
+unsigned char opt_smooth = 0, opt_watch = 0, opt_cache = 0;
+unsigned int opt_bench = 0, opt_render = 0;
+const char *OPT_FONT_FILE = NULL;
 
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
@@ -71,6 +75,12 @@ static void print_usage(const char *prog)
          "                 2 HANGODIC\n"
          "                 3 HANPIL\n"
          "                 4 HANSOFT\n"
+         "  -S --smooth    smooth(anti-aliased) font for scaled text.\n"
+         "  -L --load      load font file(fbfn, psf2). hangul font file is selected.\n"
+         "  -B --bench     ui benchmark loop count(full refresh, touch hit test). need -I option.\n"
+         "  -W --watch     reload ui cfg file when it is saved. need -I option.\n"
+         "  -P --render    draw ui items in render thread at max fps. need -I option.\n"
+         "  -K --cache     save ui cfg cache(<cfg>.cache) for faster loading. need -I option.\n"
          "  Useage : ./lib_fbui -I fbui.cfg -s 3 -F 2\n"
     );
     exit(1);
@@ -100,11 +110,17 @@ static void parse_opts(int argc, char *argv[])
             { "info",		0, 0, 'i' },
             { "font",		1, 0, 'F' },
             { "ui_cfg",		1, 0, 'I' },
+            { "smooth",		0, 0, 'S' },
+            { "load",		1, 0, 'L' },
+            { "bench",		1, 0, 'B' },
+            { "watch",		0, 0, 'W' },
+            { "render",		1, 0, 'P' },
+            { "cache",		0, 0, 'K' },
             { NULL, 0, 0, 0 },
         };
         int c;
 
-        c = getopt_long(argc, argv, "D:T:R:r:g:b:x:y:w:h:fn:t:s:c:CiF:I:", lopts, NULL);
+        c = getopt_long(argc, argv, "D:T:R:r:g:b:x:y:w:h:fn:t:s:c:CiF:I:SL:B:WP:K", lopts, NULL);
 
         if (c == -1)
             break;
@@ -173,6 +189,24 @@ static void parse_opts(int argc, char *argv[])
             opt_ui_cfg = 1;
             OPT_FBUI_CFG = optarg;
             break;
+        case 'S':
+            opt_smooth = 1;
+            break;
+        case 'L':
+            OPT_FONT_FILE = optarg;
+            break;
+        case 'B':
+            opt_bench = abs(atoi(optarg));
+            break;
+        case 'W':
+            opt_watch = 1;
+            break;
+        case 'P':
+            opt_render = abs(atoi(optarg));
+            break;
+        case 'K':
+            opt_cache = 1;
+            break;
         default:
             print_usage(argv[0]);
             break;
@@ -194,6 +228,39 @@ void dump_fb_info (fb_info_t *fb)
     printf("==================================\n");
 }
 
+//------------------------------------------------------------------------------
+// ui benchmark : 전체 업데이트(ui_update(-1)) 및 화면 전체 touch hit test 시간
+//------------------------------------------------------------------------------
+static double bench_usec (struct timespec *s, struct timespec *e)
+{
+    return (e->tv_sec - s->tv_sec) * 1000000.0 + (e->tv_nsec - s->tv_nsec) / 1000.0;
+}
+
+void ui_bench (fb_info_t *fb, ui_grp_t *ui_grp, int loop)
+{
+    struct timespec s, e;
+    int i, x, y, hits = 0, cnt = 0;
+
+    clock_gettime (CLOCK_MONOTONIC, &s);
+    for (i = 0; i < loop; i++)
+        ui_update (fb, ui_grp, -1);
+    clock_gettime (CLOCK_MONOTONIC, &e);
+    printf ("full refresh : items = %d, %.1f usec/refresh\n",
+            ui_grp->b_order_cnt, bench_usec (&s, &e) / loop);
+
+    /* 화면을 4 pixel 간격으로 touch */
+    clock_gettime (CLOCK_MONOTONIC, &s);
+    for (i = 0; i < loop; i++) {
+        for (y = 0; y < fb->h; y += 4) {
+            for (x = 0; x < fb->w; x += 4, cnt++)
+                hits += (ui_find_titem (fb, ui_grp, x, y) >= 0);
+        }
+    }
+    clock_gettime (CLOCK_MONOTONIC, &e);
+    printf ("hit test     : t_items = %d, %.1f nsec/hit (hits = %d / %d)\n",
+            ui_grp->t_item_cnt, bench_usec (&s, &e) * 1000.0 / (cnt ? cnt : 1), hits, cnt);
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char **argv)
 {
@@ -210,12 +277,33 @@ int main(int argc, char **argv)
     fb_cursor (0);
     fb_set_rotate (pfb, opt_fb_rotate);
 
+    /* font file은 ui_init 전에 등록 (hangul font file은 기본 폰트로 선택) */
+    if (OPT_FONT_FILE) {
+        int f_type;
+
+        if (font_load (OPT_FONT_FILE, &f_type) == eFONT_FILE_HANGUL)
+            opt_font = f_type;
+    }
+
     if (opt_ui_cfg) {
+        /* 다음 실행부터 ui_init은 cfg 대신 cache를 읽는다. */
+        if (opt_cache && !ui_cache_save (pfb, OPT_FBUI_CFG))
+            fprintf(stdout, "ERROR: %s cache save fail!\n", OPT_FBUI_CFG);
+
         if ((ui_grp = ui_init (pfb, OPT_FBUI_CFG)) == NULL) {
             fprintf(stdout, "ERROR: User interface create fail!\n");
             exit(1);
         }
         ui_update(pfb, ui_grp, -1);
+
+        if (opt_bench) {
+            ui_bench (pfb, ui_grp, opt_bench);
+            fb_close (pfb);
+            ui_close (ui_grp);
+            return 0;
+        }
+        if (opt_watch && !ui_watch_start (pfb, ui_grp, OPT_FBUI_CFG))
+            fprintf(stdout, "ERROR: %s watch fail!\n", OPT_FBUI_CFG);
     }
 
     f_color = RGB_TO_UINT(opt_red, opt_green, opt_blue);
@@ -232,6 +320,7 @@ int main(int argc, char **argv)
 
     if (OPT_TEXT_STR) {
         set_font(opt_font);
+        set_font_smooth(opt_smooth);
         switch(opt_font) {
             default :
             case eFONT_HAN_DEFAULT:
@@ -269,23 +358,32 @@ int main(int argc, char **argv)
             draw_line(pfb, opt_x, opt_y, opt_width, f_color);
     }
 
+    /* 이후 ui item은 render thread에서 그린다. */
+    if (opt_ui_cfg && opt_render && !ui_render_start (pfb, ui_grp, opt_render))
+        fprintf(stdout, "ERROR: render thread start fail!\n");
+
     // ts input test
     {
         ts_t *p_ts;
         ts_event_t event;
 
         p_ts = ts_init (OPT_TS_DEVICE_NAME);
-        while (p_ts != NULL) {
+        while ((p_ts != NULL) || (opt_ui_cfg && ui_grp->watch)) {
             usleep (10000);
-            if (ts_get_event (pfb, p_ts, &event)) {
+            if (p_ts && ts_get_event (pfb, p_ts, &event)) {
                 printf ("status = %d, x = %d, y = %d, ui_id = %d\n",
                         event.status, event.x, event.y, ui_get_titem (pfb, ui_grp, &event));
 
             }
+            /* 저장된 cfg의 바뀐 item만 다시 그림 */
+            if (opt_ui_cfg)
+                ui_watch_reload (pfb, ui_grp);
         }
     }
 
     sleep(1);
+    if (opt_ui_cfg)
+        ui_render_stop (ui_grp);
     fb_close (pfb);
     if (opt_ui_cfg)
         ui_close(ui_grp);
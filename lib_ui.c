@@ -24,6 +24,8 @@
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/inotify.h>
+#include <poll.h>
 #include <linux/fb.h>
 #include <getopt.h>
 #include <pthread.h>
@@ -32,36 +34,144 @@
 
 //------------------------------------------------------------------------------
 #include "lib_fb.h"
+#include "lib_font.h"
 #include "lib_ui.h"
 
+//------------------------------------------------------------------------------
+// cfg tokenizer (lib_ui.c 내부에서만 사용)
+//------------------------------------------------------------------------------
+typedef struct ui_tok__t   ui_tok_t;
+typedef struct ui_slice__t ui_slice_t;
+struct ui_cache_hdr__t;
+
+// cfg hot reload (ui_watch_start)
+typedef struct ui_watch__t ui_watch_t;
+// render thread (ui_render_start), popup 표시/지우기 요청
+typedef struct ui_render__t ui_render_t;
+#define  UI_RENDER_POPUP_SHOW 1
+#define  UI_RENDER_POPUP_HIDE 2
+// 한 frame 사이에 쌓일 수 있는 popup 요청 수 (fps가 낮은 경우)
+#define  UI_RENDER_POPUP_Q    8
+
 //------------------------------------------------------------------------------
 // Function prototype.
 //------------------------------------------------------------------------------
-static   int  _my_strlen         (char *str);
-static   int  _ui_str_scale      (int w, int h, int lw, int slen);
-static   void _ui_clr_str        (fb_info_t *fb, rect_item_t *r_item, string_item_t *s_item);
+static   void *_ui_alloc         (ui_arena_t *arena, size_t size);
+static   void _ui_arena_free     (ui_arena_t *arena);
+static   const char *_ui_intern  (ui_arena_t *arena, const char *str, int len);
+static   int  _ui_str_alloc      (ui_grp_t *ui_grp, string_item_t *s_item, int len);
+static   void _ui_str_set        (ui_grp_t *ui_grp, string_item_t *s_item, const char *str);
+static   int  _ui_str_clamp      (const char *str, int len, int max);
+static   void _ui_str_nset       (ui_grp_t *ui_grp, string_item_t *s_item,
+                                    const char *str, int len);
+static   void _ui_str_vset       (ui_grp_t *ui_grp, string_item_t *s_item, char *fmt, va_list va);
+static   int  _ui_str_size       (string_item_t *s_item, int *w, int *h);
+static   int  _ui_str_scale      (rect_item_t *r_item, string_item_t *s_item);
+static   int  _ui_str_multi      (string_item_t *s_item);
+static   const text_layout_t *_ui_str_layout (rect_item_t *r_item, string_item_t *s_item);
+static   void _ui_update_layout  (fb_info_t *fb, fb_text_t *ctx,
+                                    rect_item_t *r_item, string_item_t *s_item, int bc);
 static   void _ui_update_r       (fb_info_t *fb, rect_item_t *r_item);
-static   void _ui_update_s       (fb_info_t *fb, string_item_t *s_item, int x, int y);
-static   void _ui_parser_cmd_C   (char *buf, fb_info_t *fb, ui_grp_t *ui_grp);
-static   void _ui_parser_cmd_R   (char *buf, fb_info_t *fb, ui_grp_t *ui_grp);
-static   void _ui_parser_cmd_S   (char *buf, ui_grp_t *ui_grp);
-static   void _ui_parser_cmd_B   (char *buf, fb_info_t *fb, ui_grp_t *ui_grp);
-static   void _ui_parser_cmd_I   (char *buf, ui_grp_t *ui_grp);
-static   void _ui_parser_cmd_T   (char *buf, ui_grp_t *ui_grp);
+static   void _ui_update_s       (fb_info_t *fb, fb_text_t *ctx,
+                                    string_item_t *s_item, int x, int y);
+static   void _ui_update_rs      (fb_info_t *fb, fb_text_t *ctx,
+                                    rect_item_t *r_item, string_item_t *s_item);
+static   int  _ui_str_sprite     (string_item_t *s_item);
+static   void _ui_drawn_s        (string_item_t *s_item, int x, int y, int bc);
+static   void _ui_draw_run       (fb_info_t *fb, fb_text_t *ctx, rect_item_t *r_item,
+                                    string_item_t *s_item, const char *p_s, int len, int cell);
+static   void _ui_update_diff    (fb_info_t *fb, fb_text_t *ctx,
+                                    rect_item_t *r_item, string_item_t *s_item);
+static   int  _ui_tok_line       (ui_tok_t *t);
+static   int  _ui_tok_field      (ui_tok_t *t, ui_slice_t *s);
+static   void _ui_tok_error      (ui_tok_t *t, const char *p, const char *msg);
+static   int  _ui_slice_num      (const ui_slice_t *s, int base, int *val);
+static   int  _ui_tok_num        (ui_tok_t *t, int base, int *val, const char *name);
+static   int  _ui_tok_opt        (ui_tok_t *t, int base, int *val, const char *name);
+static   int  _ui_tok_str        (ui_tok_t *t, ui_slice_t *s);
+static   int  _ui_tok_rect       (ui_tok_t *t, fb_info_t *fb, rect_item_t *r);
+static   void _ui_parser_cmd_C   (ui_tok_t *t, fb_info_t *fb, ui_grp_t *ui_grp);
+static   void _ui_parser_cmd_R   (ui_tok_t *t, fb_info_t *fb, ui_grp_t *ui_grp);
+static   void _ui_parser_cmd_S   (ui_tok_t *t, ui_grp_t *ui_grp);
+static   void _ui_parser_cmd_B   (ui_tok_t *t, fb_info_t *fb, ui_grp_t *ui_grp);
+static   void _ui_parser_cmd_I   (ui_tok_t *t, ui_grp_t *ui_grp);
+static   void _ui_parser_cmd_T   (ui_tok_t *t, ui_grp_t *ui_grp);
 static   void _ui_str_pos_xy     (rect_item_t *r_item, string_item_t *s_item);
-static   void *_ui_find_item     (ui_grp_t *ui_grp, int fid);
-static   void _ui_update         (fb_info_t *fb, ui_grp_t *ui_grp, int id);
-
+static   int  _ui_item_add       (ui_grp_t *ui_grp, int id, int append);
+static   void _ui_item_map       (ui_grp_t *ui_grp, int item_pos);
+static   void _ui_item_order     (ui_grp_t *ui_grp);
+static   int  _ui_find_item      (ui_grp_t *ui_grp, int fid);
+static   int  _ui_touch_cells    (ui_grp_t *ui_grp, t_item_t *t_item,
+                                  int *cx_s, int *cx_e, int *cy_s, int *cy_e);
+static   void _ui_touch_index    (fb_info_t *fb, ui_grp_t *ui_grp);
+static   int  _ui_touch_hit      (ui_grp_t *ui_grp, t_item_t *t_item, int x, int y);
+static   void _ui_update         (fb_info_t *fb, ui_grp_t *ui_grp, int pos);
+static   void _ui_item_prep      (ui_grp_t *ui_grp, int pos);
+static   void _ui_mark           (fb_info_t *fb, ui_grp_t *ui_grp, int pos, int dirty);
+static   int  _ui_flush_item     (fb_info_t *fb, ui_grp_t *ui_grp, int pos);
+static   void _ui_cache_layout   (struct ui_cache_hdr__t *hdr, unsigned int str_size);
+static   unsigned long long _ui_cfg_hash (const char *p, size_t size);
+static   int  _ui_cache_load     (fb_info_t *fb, ui_grp_t *ui_grp, const char *cache_name,
+                                    unsigned long long cfg_hash, unsigned int cfg_size);
+static   int  _ui_cache_save     (fb_info_t *fb, ui_grp_t *ui_grp, const char *cache_name,
+                                    unsigned long long cfg_hash, unsigned int cfg_size);
+static   int  _ui_cfg_alloc      (const ui_tok_t *tok, ui_grp_t *ui_grp);
+static   int  _ui_cfg_parse      (ui_tok_t *t, fb_info_t *fb, ui_grp_t *ui_grp);
+static   ui_grp_t *_ui_load      (fb_info_t *fb, const char *cfg_filename, int *errors,
+                                    int *saved);
+static   void *_ui_watch_func    (void *arg);
+static   int  _ui_reload_item    (ui_grp_t *ui_grp, rect_item_t *r, b_item_t *pitem,
+                                    const rect_item_t *o_r, const b_item_t *o_item,
+                                    const rect_item_t *n_r, const b_item_t *n_item);
+static   void _ui_reload_new     (ui_grp_t *ui_grp, b_item_t *pitem, const b_item_t *n_item);
+static   int  _ui_reload_find    (ui_grp_t *ui_grp, int id, const char *used);
+static   int  _ui_item_area      (const rect_item_t *r, const string_item_t *s, rect_item_t *a);
+static   int  _ui_rect_overlap   (const rect_item_t *r, const rect_item_t *d, int d_cnt);
+static   int  _ui_reload_ti      (ui_grp_t *ui_grp, ui_grp_t *n_grp);
+static   int  _ui_reload         (fb_info_t *fb, ui_grp_t *ui_grp,
+                                    ui_grp_t *o_grp, ui_grp_t *n_grp, int is_bgr);
+static   void _ui_lock           (ui_grp_t *ui_grp);
+static   void _ui_unlock         (ui_grp_t *ui_grp);
+static   void _ui_render_kick    (ui_grp_t *ui_grp);
+static   void _ui_render_fill    (ui_grp_t *ui_grp, const rect_item_t *r);
+static   void _ui_render_popup   (ui_grp_t *ui_grp, int req);
+static   int  _ui_popup_on       (ui_grp_t *ui_grp);
+static   void _ui_popup_end      (ui_grp_t *ui_grp, int cancel);
+static   int  _ui_render_str     (string_item_t *c, const string_item_t *m);
+static   void _ui_render_clear   (string_item_t *s, int cnt);
+static   int  _ui_render_build   (ui_grp_t *ui_grp, ui_render_t *rt, int keep);
+static   int  _ui_render_sync    (ui_grp_t *ui_grp, ui_render_t *rt, int all);
+static   int  _ui_render_work    (ui_grp_t *ui_grp, ui_render_t *rt);
+static   int  _ui_render_take    (ui_grp_t *ui_grp, ui_render_t *rt);
+static   void _ui_render_draw    (ui_render_t *rt);
+static   void *_ui_render_func   (void *arg);
+static   void _ui_render_free    (ui_render_t *rt);
+static   void _ui_render_end     (ui_grp_t *ui_grp, int flush);
+
+         int ui_find_titem       (fb_info_t *fb, ui_grp_t *ui_grp, int x, int y);
          int ui_get_titem        (fb_info_t *fb, ui_grp_t *ui_grp, ts_event_t *event);
          void ui_set_ritem       (fb_info_t *fb, ui_grp_t *ui_grp, int f_id, int bc, int lc);
          void ui_set_sitem       (fb_info_t *fb, ui_grp_t *ui_grp, int f_1d, int fc, int bc, char *str);
          void ui_set_str         (fb_info_t *fb, ui_grp_t *ui_grp,
                                     int f_id, int x, int y, int scale, int font, char *fmt, ...);
+         void ui_vset_str        (fb_info_t *fb, ui_grp_t *ui_grp,
+                                    int f_id, int x, int y, int scale, int font, char *fmt, va_list va);
          void ui_set_printf      (fb_info_t *fb, ui_grp_t *ui_grp, int id, char *fmt, ...);
+         void ui_vset_printf     (fb_info_t *fb, ui_grp_t *ui_grp, int id, char *fmt, va_list va);
+         void ui_set_smooth      (fb_info_t *fb, ui_grp_t *ui_grp, int id, int enable);
+         void ui_set_sprite      (ui_grp_t *ui_grp, int id, int enable);
          void ui_update          (fb_info_t *fb, ui_grp_t *ui_grp, int id);
+         void ui_set_deferred    (fb_info_t *fb, ui_grp_t *ui_grp, int enable);
+         int  ui_flush           (fb_info_t *fb, ui_grp_t *ui_grp);
          void ui_update_group    (fb_info_t *fb, ui_grp_t *ui_grp, int gid);
          void ui_close           (ui_grp_t *ui_grp);
          ui_grp_t *ui_init       (fb_info_t *fb, const char *cfg_filename);
+         int ui_cache_save       (fb_info_t *fb, const char *cfg_filename);
+         int ui_watch_start      (fb_info_t *fb, ui_grp_t *ui_grp, const char *cfg_filename);
+         int ui_watch_reload     (fb_info_t *fb, ui_grp_t *ui_grp);
+         void ui_watch_stop      (ui_grp_t *ui_grp);
+         int ui_render_start     (fb_info_t *fb, ui_grp_t *ui_grp, int fps);
+         void ui_render_stop     (ui_grp_t *ui_grp);
 
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
@@ -82,701 +192,3156 @@ static   void _ui_update         (fb_info_t *fb, ui_grp_t *ui_grp, int id);
 */
 
 //------------------------------------------------------------------------------
-static int _my_strlen(char *str)
+// UI arena
+// block 앞부분에 header(ui_arena_blk_t)가 있으며 할당은 8 bytes 단위로 한다.
+// block 크기의 절반보다 큰 할당은 별도의 block을 사용한다.
+//------------------------------------------------------------------------------
+typedef struct ui_arena_blk__t {
+   struct ui_arena_blk__t  *next;
+   size_t                  size, used;
+}  ui_arena_blk_t;
+
+typedef struct ui_istr__t {
+   struct ui_istr__t       *next;
+   char                    str[];
+}  ui_istr_t;
+
+#define  UI_ARENA_ALIGN(n)    (((n) + 7) & ~(size_t)7)
+#define  UI_ARENA_HDR         UI_ARENA_ALIGN(sizeof(ui_arena_blk_t))
+
+static void *_ui_alloc (ui_arena_t *arena, size_t size)
 {
-   int cnt = 0, err = 512;
+   ui_arena_blk_t *blk = arena->blk;
+   size_t blk_size;
+   void *p;
+
+   size = UI_ARENA_ALIGN(size);
+   if ((blk == NULL) || (blk->used + size > blk->size)) {
+      blk_size = (size + UI_ARENA_HDR > UI_ARENA_BLOCK / 2) ?
+                  size + UI_ARENA_HDR : UI_ARENA_BLOCK;
+
+      if ((blk = (ui_arena_blk_t *)malloc (blk_size)) == NULL) {
+         fprintf(stdout, "%s : malloc error! (size = %d)\n", __func__, (int)blk_size);
+         return NULL;
+      }
+      blk->size = blk_size;
+      blk->used = UI_ARENA_HDR;
 
-   /* utf-8 에서 한글표현은 3바이트 */
-   while ((*str != 0x00) && err--) {
-      if (*str & 0x80) {
-         str += 3;   cnt += 2;
+      /* 별도 block은 현재 block 뒤에 연결 (현재 block의 남은 공간은 계속 사용) */
+      if ((blk_size != UI_ARENA_BLOCK) && (arena->blk != NULL)) {
+         blk->next = arena->blk->next;
+         arena->blk->next = blk;
       } else {
-         str += 1;   cnt++;
+         blk->next  = arena->blk;
+         arena->blk = blk;
       }
    }
-   return err ? cnt : 0;
+   p = (char *)blk + blk->used;
+   blk->used += size;
+   memset (p, 0, size);
+   return p;
 }
 
 //------------------------------------------------------------------------------
-static int _ui_str_scale (int w, int h, int lw, int slen)
+static void _ui_arena_free (ui_arena_t *arena)
 {
-   int as, w_len, h_len;
+   ui_arena_blk_t *blk, *next;
 
-   /* auto scaling */
-   /* 배율이 설정되어진 최대치 보다 큰 경우 종료한다. */
-   for (as = 1; as < ITEM_SCALE_MAX; as++) {
-      w_len = FONT_ASCII_WIDTH * as * slen + lw * 2;
-      h_len = FONT_HEIGHT      * as        + lw * 2;
-      /*
-         만약 배율이 1인 경우에도 화면에 표시되지 않는 경우 scale은 0값이 되고
-         문자열은 화면상의 표시가 되지 않는다.
-      */
-      if ((w_len > w) || (h_len > h)) {
-         if (as == 1)
-            fprintf(stdout, "ERROR: String length too big. String can't display(scale = 0).\n");
-         return (as -1);
-      }
+   for (blk = arena->blk; blk != NULL; blk = next) {
+      next = blk->next;
+      free (blk);
    }
-   return ITEM_SCALE_MAX;
+   arena->blk = NULL;
 }
 
 //------------------------------------------------------------------------------
-static void _ui_clr_str (fb_info_t *fb, rect_item_t *r_item, string_item_t *s_item)
+// 같은 문자열은 arena에 1개만 저장하고 공유한다. (default 문자열, i_item 이름)
+// str은 len 길이의 slice (NULL 종료 문자열이 아니어도 됨)
+//------------------------------------------------------------------------------
+static const char *_ui_intern (ui_arena_t *arena, const char *str, int len)
 {
-   int color = s_item->fc.uint;
+   unsigned int hash = 2166136261u;
+   ui_istr_t *is, **bucket;
+   int i;
+
+   /* FNV-1a */
+   for (i = 0; i < len; i++)
+      hash = (hash ^ (unsigned char)str[i]) * 16777619u;
+
+   bucket = &arena->str_hash[hash % UI_STR_HASH];
+   for (is = *bucket; is != NULL; is = is->next)
+      if (!strncmp (is->str, str, len) && !is->str[len])
+         return is->str;
 
-   /* 기존 String을 배경색으로 다시 그림(텍스트 지움) */
-   /* string x, y 좌표 연산 */
-   s_item->fc.uint = s_item->bc.uint;
-   _ui_str_pos_xy(r_item, s_item);
-   _ui_update_s (fb, s_item, r_item->x, r_item->y);
-   s_item->fc.uint = color;
-   memset (s_item->str, 0x00, ITEM_STR_MAX);
+   if ((is = (ui_istr_t *)_ui_alloc (arena, sizeof(ui_istr_t) + len + 1)) == NULL)
+      return "";
+
+   memcpy (is->str, str, len);
+   is->next = *bucket;
+   *bucket  = is;
+   return is->str;
 }
 
 //------------------------------------------------------------------------------
-static void _ui_update_r (fb_info_t *fb, rect_item_t *r_item)
+// 문자열 buffer(str, d_str)를 len 길이의 문자열을 저장할 수 있는 크기로 늘린다.
+// 마지막으로 그려진 문자열(d_str)은 새 buffer로 복사한다.
+//------------------------------------------------------------------------------
+static int _ui_str_alloc (ui_grp_t *ui_grp, string_item_t *s_item, int len)
 {
-   draw_fill_rect (fb, r_item->x, r_item->y, r_item->w, r_item->h,
-                     r_item->bc.uint);
-   if (r_item->lw)
-      draw_rect (fb, r_item->x, r_item->y, r_item->w, r_item->h, r_item->lw,
-                     r_item->lc.uint);
+   int size = 16;
+   char *buf;
+
+   if (len < s_item->size)
+      return 0;
+
+   while (size <= len)
+      size <<= 1;
+
+   if ((buf = (char *)_ui_alloc (&ui_grp->arena, size * 2)) == NULL)
+      return -1;
+
+   if (s_item->size) {
+      memcpy (buf,        s_item->str,   s_item->size);
+      memcpy (buf + size, s_item->d_str, s_item->size);
+   }
+   s_item->str   = buf;
+   s_item->d_str = buf + size;
+   s_item->size  = size;
+   return 0;
+}
+
+//------------------------------------------------------------------------------
+static void _ui_str_set (ui_grp_t *ui_grp, string_item_t *s_item, const char *str)
+{
+   _ui_str_nset (ui_grp, s_item, str, strlen(str));
 }
 
 //------------------------------------------------------------------------------
-static void _ui_update_s (fb_info_t *fb, string_item_t *s_item, int x, int y)
+// max 보다 긴 문자열은 UTF-8 문자 경계에서 자른 길이를 반환한다. (str은 max byte까지 유효)
+//------------------------------------------------------------------------------
+static int _ui_str_clamp (const char *str, int len, int max)
 {
-   draw_text (fb, x + s_item->x, y + s_item->y, s_item->fc.uint, s_item->bc.uint,
-               s_item->scale, s_item->str);
+   const unsigned char *p = (const unsigned char *)str;
+   int lead, n;
+
+   if (len <= max)
+      return len;
+
+   /* 마지막 문자의 시작 위치에서 문자 길이가 max를 넘으면 그 앞에서 자름 */
+   for (lead = max -1; (lead > 0) && ((p[lead] & 0xC0) == 0x80); lead--)
+      ;
+   if (lead < 0)
+      return 0;
+   n = (p[lead] >= 0xF0) ? 4 : (p[lead] >= 0xE0) ? 3 : (p[lead] >= 0xC0) ? 2 : 1;
+   return (lead + n > max) ? lead : max;
 }
 
 //------------------------------------------------------------------------------
-// C(cmd), LCD RGB배열(0 = RGB, 1 = BGR), 기본문자색상(fc), 기본박스색상(rc), 기본외곽색상(lc), 한글폰트(fn:0~4)
+// 문자열 변경은 모두 이 함수를 통해야 크기 cache가 무효화 된다. (str은 len 길이의 slice)
 //------------------------------------------------------------------------------
-static void _ui_parser_cmd_C (char *buf, fb_info_t *fb, ui_grp_t *ui_grp)
+static void _ui_str_nset (ui_grp_t *ui_grp, string_item_t *s_item, const char *str, int len)
 {
-   char *ptr = strtok (buf, ",");
+   len = _ui_str_clamp (str, len, UI_STR_MAX -1);
 
-   ptr = strtok (NULL, ",");     fb->is_bgr        = (atoi(ptr) != 0) ? 1: 0;
-   ptr = strtok (NULL, ",");     ui_grp->fc.uint   = strtol(ptr, NULL, 16);
-   ptr = strtok (NULL, ",");     ui_grp->bc.uint   = strtol(ptr, NULL, 16);
-   ptr = strtok (NULL, ",");     ui_grp->lc.uint   = strtol(ptr, NULL, 16);
-   ptr = strtok (NULL, ",");     ui_grp->f_type    = atoi(ptr);
+   /* buffer를 늘리지 못한 경우 현재 buffer 크기로 자름 */
+   if (_ui_str_alloc (ui_grp, s_item, len) && ((len = s_item->size - 1) < 0))
+      return;
 
-   set_font(ui_grp->f_type);
+   memmove (s_item->str, str, len);
+   s_item->str[len] = 0;
+   s_item->len      = len;
+   s_item->m_cells  = -1;
+   s_item->l_valid  = 0;
 }
 
 //------------------------------------------------------------------------------
-// R(cmd), ID(uid), 시작x좌표(x%), 시작y좌표(y%), 넓이(w%), 높이(h%), 외곽두께(lw), color, line_color, GroupID,
+// fmt를 item 문자열 버퍼에 바로 format 한다. (buffer가 작으면 늘린 후 다시 format)
 //------------------------------------------------------------------------------
-static void _ui_parser_cmd_R (char *buf, fb_info_t *fb, ui_grp_t *ui_grp)
+static void _ui_str_vset (ui_grp_t *ui_grp, string_item_t *s_item, char *fmt, va_list va)
 {
-   int item_cnt = ui_grp->b_item_cnt, id, item_pos, color;
-   char *ptr = strtok (buf, ",");
-   rect_item_t *r;
+   va_list va_retry;
+   int len;
 
-   ptr = strtok (NULL, ",");  id = atoi(ptr);
-
-   /* 설정되어진 ID가 있는지 찾는다. (기존 설정되어진 값 변경시) */
-   for (item_pos = 0; item_pos < item_cnt; item_pos++) {
-      if (ui_grp->b_item[item_pos].id == id)
-         break;
+   if (strchr (fmt, '%') == NULL) {
+      _ui_str_set (ui_grp, s_item, fmt);
+      return;
    }
-   ui_grp->b_item[item_pos].id = id;
-   r = &ui_grp->b_item[item_pos].r;
-
-   ptr = strtok (NULL, ",");     r->x  = atoi(ptr);
-   ptr = strtok (NULL, ",");     r->y  = atoi(ptr);
-   ptr = strtok (NULL, ",");     r->w  = atoi(ptr);
-   ptr = strtok (NULL, ",");     r->h  = atoi(ptr);
-   ptr = strtok (NULL, ",");     r->lw = atoi(ptr);
+   va_copy (va_retry, va);
+   if ((len = vsnprintf (s_item->str, s_item->size, fmt, va)) < 0)
+      len = 0;
+
+   /* buffer는 UI_STR_MAX 까지만 늘린다. */
+   if ((len >= s_item->size) &&
+       !_ui_str_alloc (ui_grp, s_item, (len < UI_STR_MAX) ? len : UI_STR_MAX -1))
+      vsnprintf (s_item->str, s_item->size, fmt, va_retry);
+   va_end (va_retry);
+
+   if (s_item->size == 0)
+      return;
+
+   s_item->len      = _ui_str_clamp (s_item->str, len, s_item->size -1);
+   s_item->str[s_item->len] = 0;
+   s_item->m_cells  = -1;
+   s_item->l_valid  = 0;
+}
 
-   r->x = (r->x * fb->w / 100);  r->y = (r->y * fb->h / 100);
-   r->w = (r->w * fb->w / 100);  r->h = (r->h * fb->h / 100);
+//------------------------------------------------------------------------------
+// 현재 scale로 표시되는 문자열의 pixel 크기. (문자열 또는 scale 변경시에만 다시 계산)
+// 한글/ASCII 폰트는 모두 같은 cell 크기를 가지므로 f_type은 크기에 영향을 주지 않는다.
+//------------------------------------------------------------------------------
+static int _ui_str_size (string_item_t *s_item, int *w, int *h)
+{
+   if (s_item->m_cells < 0) {
+      s_item->m_cells = text_cells (s_item->str);
+      s_item->m_nl    = (strchr (s_item->str, '\n') != NULL);
+      s_item->m_scale = -1;
+   }
+   if (s_item->m_scale != s_item->scale) {
+      s_item->m_w     = s_item->m_cells * font_cell_w (s_item->scale);
+      s_item->m_h     = font_cell_h (s_item->scale);
+      s_item->m_scale = s_item->scale;
+   }
+   if (w)   *w = s_item->m_w;
+   if (h)   *h = s_item->m_h;
+   return s_item->m_w;
+}
 
-   r->bc.uint = ui_grp->bc.uint; r->lc.uint = ui_grp->lc.uint;
+//------------------------------------------------------------------------------
+// r_item 안에 s_item 문자열을 표시할 수 있는 최대 배율 (auto scaling)
+//------------------------------------------------------------------------------
+static int _ui_str_scale (rect_item_t *r_item, string_item_t *s_item)
+{
+   int as, max, w = r_item->w - r_item->lw * 2, h = r_item->h - r_item->lw * 2;
+
+   if (s_item->m_cells < 0)
+      _ui_str_size (s_item, NULL, NULL);
+
+   as = text_fit_scale (r_item->w, r_item->h, r_item->lw, s_item->m_cells);
+
+   /*
+      여러 줄로 표시하는 경우 한 줄에 모두 표시되는 scale(as)부터
+      박스 높이로 가능한 최대 scale 사이에서 문자열이 모두 들어가는 가장 큰 scale을 찾는다.
+   */
+   if (_ui_str_multi (s_item) && (h > 0)) {
+      max = h / font_cell_h (1);
+      if (max > ITEM_SCALE_MAX)
+         max = ITEM_SCALE_MAX;
+      for (as = (as > 1) ? as : 1; max > as; max--)
+         if (text_layout (s_item->str, max, w, h, s_item->align, &s_item->lay))
+            break;
+      s_item->l_valid = 0;
+      return max > as ? max : as;
+   }
+   /*
+      만약 배율이 1인 경우에도 화면에 표시되지 않는 경우 scale은 0값이 되고
+      문자열은 화면상의 표시가 되지 않는다.
+   */
+   if (as == 0)
+      fprintf(stdout, "ERROR: String length too big. String can't display(scale = 0).\n");
+
+   return (as > ITEM_SCALE_MAX) ? ITEM_SCALE_MAX : as;
+}
 
-   ptr = strtok (NULL, ",");
-   if ((color = strtol(ptr, NULL, 16)) >= 0)
-      r->bc.uint = color;
+//------------------------------------------------------------------------------
+// 여러 줄 layout으로 표시하는 문자열 (줄바꿈/ellipsis 설정 또는 '\n' 포함)
+//------------------------------------------------------------------------------
+static int _ui_str_multi (string_item_t *s_item)
+{
+   if (s_item->m_cells < 0)
+      _ui_str_size (s_item, NULL, NULL);
 
-   ptr = strtok (NULL, ",");
-   if ((color = strtol(ptr, NULL, 16)) >= 0)
-      r->lc.uint = color;
+   return (s_item->align & (STR_WRAP_WORD | STR_WRAP_CHAR | STR_ELLIPSIS)) || s_item->m_nl;
+}
 
-   ptr = strtok (NULL, ",");
-   ui_grp->b_item[item_pos].gid = atoi(ptr);
+//------------------------------------------------------------------------------
+// 문자열 위치(s_item->x, y)부터 rect 외곽선 안쪽까지의 박스에 대한 layout.
+// 문자열, scale, 박스 크기, 정렬이 바뀌지 않으면 cache된 줄 나눔을 그대로 사용한다.
+//------------------------------------------------------------------------------
+static const text_layout_t *_ui_str_layout (rect_item_t *r_item, string_item_t *s_item)
+{
+   int w = r_item->w - r_item->lw - s_item->x, h = r_item->h - r_item->lw - s_item->y;
+   text_layout_t *lay = &s_item->lay;
 
-   if (item_cnt == item_pos)
-      ui_grp->b_item_cnt++;
+   if (!s_item->l_valid || (lay->scale != s_item->scale) ||
+       (lay->w != w) || (lay->h != h) || (lay->flags != s_item->align)) {
+      text_layout (s_item->str, s_item->scale, w, h, s_item->align, lay);
+      s_item->l_valid = 1;
+   }
+   return lay;
 }
 
 //------------------------------------------------------------------------------
-// S(cmd), ID(uid), 폰트크기(scale), 문자정렬(align), color, back_color, 문자열(str)
+// 여러 줄 문자열을 그린다. (bc = 문자열 배경색, rect 배경은 이미 채워져 있어야 함)
 //------------------------------------------------------------------------------
-static void _ui_parser_cmd_S (char *buf, ui_grp_t *ui_grp)
+static void _ui_update_layout (fb_info_t *fb, fb_text_t *ctx,
+                                 rect_item_t *r_item, string_item_t *s_item, int bc)
 {
-   int item_cnt = ui_grp->b_item_cnt, id, item_pos, color;
-   char *ptr = strtok (buf, ",");
-   string_item_t *s;
-
-   ptr = strtok (NULL, ",");  id = atoi(ptr);
+   const text_layout_t *lay = _ui_str_layout (r_item, s_item);
 
-   /* 설정되어진 ID가 있는지 찾는다. (기존 설정되어진 값 변경시) */
-   for (item_pos = 0; item_pos < item_cnt; item_pos++) {
-      if (ui_grp->b_item[item_pos].id == id)
-         break;
-   }
-   ui_grp->b_item[item_pos].id = id;
-   s = &ui_grp->b_item[item_pos].s;
-   ptr = strtok (NULL, ",");     s->scale = atoi(ptr);
-   ptr = strtok (NULL, ",");     ui_grp->b_item[item_pos].s_align = atoi(ptr);
+   ctx->f_type = s_item->f_type;
+   ctx->smooth = s_item->f_smooth;
+   draw_layout_r (fb, ctx, r_item->x + s_item->x, r_item->y + s_item->y,
+                  s_item->fc.uint, bc, s_item->str, lay);
+   _ui_drawn_s (s_item, r_item->x + s_item->x, r_item->y + s_item->y, s_item->bc.uint);
+}
 
-   s->f_type  = ui_grp->f_type;  s->fc.uint = ui_grp->fc.uint;
-   s->bc.uint = ui_grp->bc.uint;
+//------------------------------------------------------------------------------
+static void _ui_update_r (fb_info_t *fb, rect_item_t *r_item)
+{
+   draw_fill_rect (fb, r_item->x, r_item->y, r_item->w, r_item->h,
+                     r_item->bc.uint);
+   if (r_item->lw)
+      draw_rect (fb, r_item->x, r_item->y, r_item->w, r_item->h, r_item->lw,
+                     r_item->lc.uint);
+}
 
-   ptr = strtok (NULL, ",");
-   if ((color = strtol(ptr, NULL, 16)) >= 0)
-      s->fc.uint = color;
+//------------------------------------------------------------------------------
+// ctx : 호출하는 thread가 소유한 text context (ui_grp->text, p_item->text)
+//------------------------------------------------------------------------------
+static void _ui_update_s (fb_info_t *fb, fb_text_t *ctx,
+                           string_item_t *s_item, int x, int y)
+{
+   ctx->f_type = s_item->f_type;
+   ctx->smooth = s_item->f_smooth;
+   draw_text_r (fb, ctx, x + s_item->x, y + s_item->y, s_item->fc.uint, s_item->bc.uint,
+               s_item->scale, "%s", s_item->str);
+   _ui_drawn_s (s_item, x + s_item->x, y + s_item->y, s_item->bc.uint);
+}
 
-   ptr = strtok (NULL, ",");
-   if ((color = strtol(ptr, NULL, 16)) >= 0)
-      s->bc.uint = color;
-   else
-      s->bc.uint = ui_grp->b_item[item_pos].r.bc.uint;
+//------------------------------------------------------------------------------
+// rect를 채운 직후 문자열을 그린다.
+// 문자열이 rect 외곽선 안쪽에 있고 배경색이 같다면 배경은 이미 채워져 있으므로 전경 픽셀만 그린다.
+//------------------------------------------------------------------------------
+static void _ui_update_rs (fb_info_t *fb, fb_text_t *ctx,
+                           rect_item_t *r_item, string_item_t *s_item)
+{
+   int bc = s_item->bc.uint, w, h;
 
-   /* 문자열이 없거나 앞부분의 공백이 있는 경우 제거 */
-   if ((ptr = strtok (NULL, ",")) != NULL) {
-      int slen = strlen(ptr);
+   _ui_update_r (fb, r_item);
+   _ui_str_size (s_item, &w, &h);
 
-      while ((*ptr == 0x20) && slen--)
-         ptr++;
+   /* sprite를 사용하지 않는 item 또는 마지막으로 그린 문자열과 다른 경우 sprite를 반환 */
+   if (!_ui_str_sprite (s_item)) {
+      sprite_free (s_item->sprite);
+      s_item->sprite = NULL;
+   }
 
-      s->len = slen;
-      strncpy(s->str, ptr, s->len);
-      // default string for ui_reset
-      strncpy(ui_grp->b_item[item_pos].s_dfl, ptr, s->len);
+   if (_ui_str_multi (s_item)) {
+      _ui_update_layout (fb, ctx, r_item, s_item,
+                        (s_item->bc.uint == r_item->bc.uint) ? COLOR_TRANSPARENT : bc);
+      return;
    }
 
-   switch (ui_grp->b_item[item_pos].s_align) {
-      case STR_ALIGN_L: case STR_ALIGN_R: case STR_ALIGN_C:
-      default :
-         s->x = -1;  s->y = -1;
-      break;
+   ctx->f_type = s_item->f_type;
+   ctx->smooth = s_item->f_smooth;
+
+   if (_ui_str_sprite (s_item) &&
+       (s_item->x >= r_item->lw) && (s_item->y >= r_item->lw) &&
+       (s_item->x + w <= r_item->w - r_item->lw) &&
+       (s_item->y + h <= r_item->h - r_item->lw)) {
+      /*
+         같은 문자열을 다시 그리는 경우 (고정된 label, group reset, popup 깜빡임)
+         외곽선 안쪽의 문자열은 배경을 포함한 image(sprite)로 만들어 복사한다.
+         이후 문자열이 바뀌지 않았다면 glyph를 다시 그리지 않는다.
+      */
+      if ((signed)bc == COLOR_TRANSPARENT)
+         bc = r_item->bc.uint;
+
+      s_item->sprite = sprite_text (fb, ctx, s_item->sprite, s_item->fc.uint, bc,
+                                    s_item->scale, s_item->str);
+      if (s_item->sprite != NULL) {
+         sprite_blit (fb, ctx, s_item->sprite, r_item->x + s_item->x, r_item->y + s_item->y);
+         _ui_drawn_s (s_item, r_item->x + s_item->x, r_item->y + s_item->y, s_item->bc.uint);
+         return;
+      }
+      if (bc == (int)r_item->bc.uint)
+         bc = COLOR_TRANSPARENT;
    }
 
-   if (item_cnt == item_pos)
-      ui_grp->b_item_cnt++;
+   draw_text_r (fb, ctx, r_item->x + s_item->x, r_item->y + s_item->y, s_item->fc.uint, bc,
+               s_item->scale, "%s", s_item->str);
+   _ui_drawn_s (s_item, r_item->x + s_item->x, r_item->y + s_item->y, s_item->bc.uint);
 }
 
 //------------------------------------------------------------------------------
-// B(cmd), ID(id), 시작x좌표(x%), 시작y좌표(y%), 넓이(w%), 높이(h%), 외곽두께(lw),
-//          폰트크기(scale), 문자정렬(align), GroupID, 문자열(str)
+// sprite를 사용하는 item이 마지막으로 그린 문자열을 다시 그리는 경우 1.
+// 자주 바뀌는 문자열은 sprite를 만들지 않고 바로 그린다.
 //------------------------------------------------------------------------------
-static void _ui_parser_cmd_B (char *buf, fb_info_t *fb, ui_grp_t *ui_grp)
+static int _ui_str_sprite (string_item_t *s_item)
 {
-   int item_cnt = ui_grp->b_item_cnt;
-   char *ptr = strtok (buf, ",");
-   rect_item_t   *r = &ui_grp->b_item[item_cnt].r;
-   string_item_t *s = &ui_grp->b_item[item_cnt].s;
-
-   ptr = strtok (NULL, ",");     ui_grp->b_item[item_cnt].id = atoi(ptr);
-   ptr = strtok (NULL, ",");     r->x  = atoi(ptr);
-   ptr = strtok (NULL, ",");     r->y  = atoi(ptr);
-   ptr = strtok (NULL, ",");     r->w  = atoi(ptr);
-   ptr = strtok (NULL, ",");     r->h  = atoi(ptr);
-   ptr = strtok (NULL, ",");     r->lw = atoi(ptr);
-
-   r->x = (r->x * fb->w / 100);  r->y = (r->y * fb->h / 100);
-   r->w = (r->w * fb->w / 100);  r->h = (r->h * fb->h / 100);
-
-   r->bc.uint = ui_grp->bc.uint;
-   r->lc.uint = ui_grp->lc.uint;
-
-   ptr = strtok (NULL, ",");     s->scale = atoi(ptr);
-   ptr = strtok (NULL, ",");     ui_grp->b_item[item_cnt].s_align = atoi(ptr);
-
-   ptr = strtok (NULL, ",");
-   ui_grp->b_item[item_cnt].gid = atoi(ptr);
-
-   /* 문자열이 없거나 앞부분의 공백이 있는 경우 제거 */
-   if ((ptr = strtok (NULL, ",")) != NULL) {
-      int slen = strlen(ptr);
+   return s_item->f_sprite && s_item->size && !strcmp (s_item->str, s_item->d_str);
+}
 
-      while ((*ptr == 0x20) && slen--)
-         ptr++;
+//------------------------------------------------------------------------------
+// 화면에 그려진 문자열의 layout을 저장한다. (다음 업데이트시 glyph 단위 비교)
+//------------------------------------------------------------------------------
+static void _ui_drawn_s (string_item_t *s_item, int x, int y, int bc)
+{
+   s_item->d_valid  = 1;
+   s_item->d_x      = x;                  s_item->d_y      = y;
+   s_item->d_scale  = s_item->scale;      s_item->d_f_type = s_item->f_type;
+   s_item->d_smooth = s_item->f_smooth;
+   s_item->d_fc     = s_item->fc;         s_item->d_bc.uint = bc;
+   s_item->d_layout = _ui_str_multi (s_item);
+   _ui_str_size (s_item, NULL, NULL);
+   s_item->d_cells  = s_item->m_cells;
+   memcpy (s_item->d_str, s_item->str, s_item->len + 1);
+}
 
-      s->len = slen;
-      strncpy(s->str, ptr, s->len);
-      // default string for ui_reset
-      strncpy(ui_grp->b_item[item_cnt].s_dfl, ptr, s->len);
-   }
+//------------------------------------------------------------------------------
+// 문자열 중 p_s 부터 len byte (시작위치 cell)만 다시 그린다.
+// 배경이 투명인 경우 해당 영역을 rect 배경색으로 지운 후 그린다.
+//------------------------------------------------------------------------------
+static void _ui_draw_run (fb_info_t *fb, fb_text_t *ctx, rect_item_t *r_item,
+                           string_item_t *s_item, const char *p_s, int len, int cell)
+{
+   int x = s_item->d_x + cell * font_cell_w (s_item->scale);
+   int pos, cells, c;
 
-   s->f_type  = ui_grp->f_type;   s->fc.uint = ui_grp->fc.uint;
-   s->bc.uint = ui_grp->bc.uint;
+   if ((signed)s_item->bc.uint == COLOR_TRANSPARENT) {
+      for (pos = 0, cells = 0; pos < len; cells += c)
+         pos += text_next (p_s + pos, &c);
 
-   switch (ui_grp->b_item[item_cnt].s_align) {
-      case STR_ALIGN_L: case STR_ALIGN_R: case STR_ALIGN_C:
-      default :
-         s->x = -1;  s->y = -1;
-      break;
+      draw_fill_rect (fb, x, s_item->d_y, cells * font_cell_w (s_item->scale),
+                        font_cell_h (s_item->scale), r_item->bc.uint);
    }
-
-   item_cnt++;
-   ui_grp->b_item_cnt = item_cnt;
+   draw_text_r (fb, ctx, x, s_item->d_y, s_item->fc.uint, s_item->bc.uint,
+                  s_item->scale, "%.*s", len, p_s);
 }
 
 //------------------------------------------------------------------------------
-static void _ui_parser_cmd_I (char *buf, ui_grp_t *ui_grp)
+// 마지막으로 그려진 문자열과 비교하여 변경된 glyph만 다시 그린다.
+// 위치/크기/폰트/색상이 바뀐 경우는 기존 문자열 영역을 지우고 전체를 다시 그림.
+//------------------------------------------------------------------------------
+static void _ui_update_diff (fb_info_t *fb, fb_text_t *ctx,
+                              rect_item_t *r_item, string_item_t *s_item)
 {
-   int item_cnt = ui_grp->i_item_cnt;
-   char *ptr = strtok (buf, ",");
+   const char *p_o, *p_n, *p_run = NULL;
+   int cell, run_cell = 0, o_cell, o_cells, n_len, cells, bc, x, y, w, h;
 
-   if ((ptr = strtok (NULL, ",")) != NULL)
-      ui_grp->i_item[item_cnt].ui_id = atoi(ptr);
+   /* 바뀐 문자열의 sprite는 pool에 반환한다. */
+   if (!_ui_str_sprite (s_item)) {
+      sprite_free (s_item->sprite);
+      s_item->sprite = NULL;
+   }
+   _ui_str_pos_xy (r_item, s_item);
+   _ui_str_size (s_item, &w, &h);
+
+   x  = r_item->x + s_item->x;     y = r_item->y + s_item->y;
+   bc = ((signed)s_item->bc.uint == COLOR_TRANSPARENT) ? r_item->bc.uint : s_item->bc.uint;
+
+   /* 여러 줄 문자열은 rect 외곽선 안쪽을 지우고 다시 그린다. */
+   if (_ui_str_multi (s_item) || (s_item->d_valid && s_item->d_layout)) {
+      draw_fill_rect (fb, r_item->x + r_item->lw, r_item->y + r_item->lw,
+                        r_item->w - r_item->lw * 2, r_item->h - r_item->lw * 2, r_item->bc.uint);
+      if (_ui_str_multi (s_item))
+         _ui_update_layout (fb, ctx, r_item, s_item, s_item->bc.uint);
+      else
+         _ui_update_s (fb, ctx, s_item, r_item->x, r_item->y);
+      return;
+   }
 
-   if ((ptr = strtok (NULL, ",")) != NULL)
-      ui_grp->i_item[item_cnt].grp_id = atoi(ptr);
+   if (!s_item->d_valid || (s_item->d_x != x) || (s_item->d_y != y) ||
+      (s_item->d_scale  != s_item->scale)    || (s_item->d_f_type != s_item->f_type) ||
+      (s_item->d_smooth != s_item->f_smooth) ||
+      (s_item->d_fc.uint != s_item->fc.uint) || (s_item->d_bc.uint != s_item->bc.uint)) {
+
+      if (s_item->d_valid) {
+         int d_w = s_item->d_cells * font_cell_w (s_item->d_scale);
+         int d_h = font_cell_h (s_item->d_scale);
+
+         /* 새 문자열의 배경이 기존 문자열 영역을 모두 덮지 못하면 기존 영역을 지운다. */
+         if ((bc != (int)s_item->bc.uint) || (s_item->d_y != y) || (d_h != h) ||
+             (s_item->d_x < x) || (s_item->d_x + d_w > x + w))
+            draw_fill_rect (fb, s_item->d_x, s_item->d_y, d_w, d_h,
+                              ((signed)s_item->d_bc.uint == COLOR_TRANSPARENT) ?
+                                 r_item->bc.uint : s_item->d_bc.uint);
+      }
+      _ui_update_s (fb, ctx, s_item, r_item->x, r_item->y);
+      return;
+   }
 
-   if ((ptr = strtok (NULL, ",")) != NULL)
-      ui_grp->i_item[item_cnt].dev_id = atoi(ptr);
+   ctx->f_type = s_item->f_type;
+   ctx->smooth = s_item->f_smooth;
 
-   ui_grp->i_item[item_cnt].is_info = 1;
-   if ((ptr = strtok (NULL, ",")) != NULL)
-      ui_grp->i_item[item_cnt].is_info = (atoi(ptr) == 1) ? 1 : 0;
+   /* 같은 cell 위치의 glyph를 비교하여 변경된 glyph가 연속된 구간(run) 단위로 그린다. */
+   p_o = s_item->d_str;    o_cell = 0;
+   for (p_n = s_item->str, cell = 0; *p_n; p_n += n_len, cell += cells) {
+      n_len = text_next (p_n, &cells);
 
-   /* 문자열이 없거나 앞부분의 공백이 있는 경우 제거 */
-   if ((ptr = strtok (NULL, ",")) != NULL) {
-      int slen = strlen(ptr);
+      while (*p_o && (o_cell < cell)) {
+         p_o    += text_next (p_o, &o_cells);
+         o_cell += o_cells;
+      }
+      if (*p_o && (o_cell == cell) &&
+         (text_next (p_o, &o_cells) == n_len) && !memcmp (p_o, p_n, n_len)) {
+         if (p_run != NULL) {
+            _ui_draw_run (fb, ctx, r_item, s_item, p_run, p_n - p_run, run_cell);
+            p_run = NULL;
+         }
+      } else if (p_run == NULL) {
+         p_run = p_n;   run_cell = cell;
+      }
+   }
+   if (p_run != NULL)
+      _ui_draw_run (fb, ctx, r_item, s_item, p_run, p_n - p_run, run_cell);
 
-      while ((*ptr == 0x20) && slen--)
-         ptr++;
+   /* 문자열이 짧아진 경우 남은 부분만 지운다. */
+   if (s_item->d_cells > cell)
+      draw_fill_rect (fb, s_item->d_x + cell * font_cell_w (s_item->scale), s_item->d_y,
+                        (s_item->d_cells - cell) * font_cell_w (s_item->scale), h, bc);
 
-      strncpy(ui_grp->i_item[item_cnt].name, ptr, slen);
-   }
-   item_cnt++;
-   ui_grp->i_item_cnt = item_cnt;
+   _ui_drawn_s (s_item, s_item->d_x, s_item->d_y, s_item->bc.uint);
 }
 
 //------------------------------------------------------------------------------
-// T(cmd), ID(uid), Press Color, Release Color
+// cfg tokenizer
+// mmap된 cfg 파일을 복사하지 않고 줄, field(',') 단위의 slice로 나눈다.
+// 모든 상태는 ui_tok_t에 있으므로 여러 ui_grp를 동시에 읽을 수 있다. (strtok 미사용)
+// 줄 길이 제한이 없으며 오류는 "file:line:col" 형식으로 표시한다.
 //------------------------------------------------------------------------------
-static void _ui_parser_cmd_T (char *buf, ui_grp_t *ui_grp)
-{
-   int item_cnt = ui_grp->t_item_cnt, color, id, item_pos;
-   char *ptr = strtok (buf, ",");
-
-   ui_grp->t_item[item_cnt].ui_id   = 0;
-   ui_grp->t_item[item_cnt].pc.uint = ui_grp->bc.uint;
-   ui_grp->t_item[item_cnt].rc.uint = ui_grp->bc.uint;
-
-   if ((ptr = strtok (NULL, ",")) != NULL)
-      ui_grp->t_item[item_cnt].ui_id = atoi(ptr);
+struct ui_slice__t {
+   const char  *p;
+   int         len;
+};
+
+struct ui_tok__t {
+   const char  *filename;
+   // 다음 줄 시작, 파일 끝
+   const char  *p, *end;
+   // 현재 줄 (줄바꿈 문자 제외), 다음 field 시작 (NULL = 더 이상 field 없음)
+   const char  *line, *line_end, *f;
+   int         line_no, errors;
+};
 
-   if ((ptr = strtok (NULL, ",")) != NULL) {
-      if ((color = strtol (ptr, NULL, 16)) >= 0)
-         ui_grp->t_item[item_cnt].pc.uint = color;
+//------------------------------------------------------------------------------
+// 다음 줄로 이동한다. 파일 끝이면 0.
+//------------------------------------------------------------------------------
+static int _ui_tok_line (ui_tok_t *t)
+{
+   const char *nl;
+
+   if (t->p >= t->end)
+      return 0;
+
+   t->line = t->p;
+   if ((nl = memchr (t->p, '\n', t->end - t->p)) != NULL) {
+      t->line_end = nl;
+      t->p        = nl + 1;
+   } else {
+      t->line_end = t->end;
+      t->p        = t->end;
    }
+   if ((t->line_end > t->line) && (t->line_end[-1] == '\r'))
+      t->line_end--;
 
-   if ((ptr = strtok (NULL, ",")) != NULL) {
-      if ((color = strtol (ptr, NULL, 16)) >= 0)
-         ui_grp->t_item[item_cnt].rc.uint = color;
-      else {
-         /* 설정되어진 ID가 있는지 찾는다. (기존 설정되어진 값 변경시) */
-         id = ui_grp->t_item[item_cnt].ui_id;
-         for (item_pos = 0; item_pos < ui_grp->b_item_cnt; item_pos++) {
-            if (ui_grp->b_item[item_pos].id == id) {
-               rect_item_t *r = &ui_grp->b_item[item_pos].r;
-               ui_grp->t_item[item_cnt].rc.uint = r->bc.uint;
-               break;
-            }
-         }
-      }
+   t->f = t->line;
+   t->line_no++;
+   return 1;
+}
+
+//------------------------------------------------------------------------------
+// 현재 줄의 다음 field. 줄에 남은 field가 없으면 0. (빈 field는 len = 0)
+//------------------------------------------------------------------------------
+static int _ui_tok_field (ui_tok_t *t, ui_slice_t *s)
+{
+   const char *comma;
+
+   if (t->f == NULL)
+      return 0;
+
+   s->p = t->f;
+   if ((comma = memchr (t->f, ',', t->line_end - t->f)) != NULL) {
+      s->len = comma - t->f;
+      t->f   = comma + 1;
+   } else {
+      s->len = t->line_end - t->f;
+      t->f   = NULL;
    }
-   item_cnt++;
-   ui_grp->t_item_cnt = item_cnt;
+   return 1;
 }
 
 //------------------------------------------------------------------------------
-static void _ui_str_pos_xy (rect_item_t *r_item, string_item_t *s_item)
+// p 위치(앞부분 공백 제외)의 줄/칸 번호와 함께 오류를 표시한다.
+//------------------------------------------------------------------------------
+static void _ui_tok_error (ui_tok_t *t, const char *p, const char *msg)
 {
-   int slen = _my_strlen(s_item->str);
+   while ((p < t->line_end) && ((*p == ' ') || (*p == '\t')))
+      p++;
+   fprintf(stdout, "%s:%d:%d: ERROR: %s\n", t->filename, t->line_no, (int)(p - t->line) + 1, msg);
+   t->errors++;
+}
 
-   if (s_item->x < 0) {
-      slen = slen * FONT_ASCII_WIDTH * s_item->scale;
-      s_item->x = ((r_item->w - slen) / 2);
+//------------------------------------------------------------------------------
+// slice 앞뒤의 공백 제거 후 정수 변환. (base = 0 이면 0x(hex), 0(octal) 접두사 인식)
+// 숫자가 없거나 숫자 뒤에 다른 문자가 있으면 -1.
+//------------------------------------------------------------------------------
+static int _ui_slice_num (const ui_slice_t *s, int base, int *val)
+{
+   const char *p = s->p, *e = s->p + s->len;
+   unsigned int v = 0;
+   int neg = 0, digits = 0, d;
+
+   while ((p < e) && ((*p == ' ') || (*p == '\t')))
+      p++;
+   while ((e > p) && ((e[-1] == ' ') || (e[-1] == '\t')))
+      e--;
+
+   if ((p < e) && ((*p == '-') || (*p == '+')))
+      neg = (*p++ == '-');
+
+   if (((base == 0) || (base == 16)) && (e - p > 2) && (p[0] == '0') && ((p[1] | 0x20) == 'x')) {
+      p += 2;  base = 16;
+   } else if (base == 0)
+      base = ((e - p > 1) && (p[0] == '0')) ? 8 : 10;
+
+   for (; p < e; p++, digits++) {
+      if      ((*p >= '0') && (*p <= '9'))           d = *p - '0';
+      else if (((*p | 0x20) >= 'a') && ((*p | 0x20) <= 'z'))  d = (*p | 0x20) - 'a' + 10;
+      else                                            break;
+      if (d >= base)
+         break;
+      v = v * base + d;
    }
-   if (s_item->y < 0)
-      s_item->y = ((r_item->h - FONT_HEIGHT * s_item->scale)) / 2;
+   if (!digits || (p != e))
+      return -1;
+
+   *val = neg ? -(int)v : (int)v;
+   return 0;
 }
 
 //------------------------------------------------------------------------------
-static void *_ui_find_item (ui_grp_t *ui_grp, int fid)
+// 반드시 있어야 하는 숫자 field. 없거나 숫자가 아니면 오류 표시 후 -1.
+//------------------------------------------------------------------------------
+static int _ui_tok_num (ui_tok_t *t, int base, int *val, const char *name)
 {
+   ui_slice_t s;
+   char msg[64];
    int i;
-   for (i = 0; i < ui_grp->b_item_cnt; i++) {
-      if (fid == ui_grp->b_item[i].id)
-         return &ui_grp->b_item[i];
+
+   if (!_ui_tok_field (t, &s))
+      s.p = t->line_end,   s.len = 0;
+
+   for (i = 0; (i < s.len) && ((s.p[i] == ' ') || (s.p[i] == '\t')); i++)
+      ;
+   if (i == s.len) {
+      snprintf (msg, sizeof(msg), "missing field '%s'", name);
+      _ui_tok_error (t, s.p, msg);
+      return -1;
+   }
+   if (_ui_slice_num (&s, base, val)) {
+      snprintf (msg, sizeof(msg), "invalid %s field '%s'", (base == 16) ? "hex" : "number", name);
+      _ui_tok_error (t, s.p, msg);
+      return -1;
    }
-   return NULL;
+   return 0;
 }
 
 //------------------------------------------------------------------------------
-int ui_get_titem (fb_info_t *fb, ui_grp_t *ui_grp, ts_event_t *event)
+// 생략 가능한 숫자 field. 있으면 1, 없거나 비어있으면 0, 숫자가 아니면 오류 표시 후 0.
+//------------------------------------------------------------------------------
+static int _ui_tok_opt (ui_tok_t *t, int base, int *val, const char *name)
 {
-   int ui_id, x_s, x_e, y_s, y_e, i, p_color, r_color;
-   b_item_t *pitem;
+   ui_slice_t s;
+   char msg[64];
+   int i;
 
-   for (i = 0; i < ui_grp->t_item_cnt; i++) {
-      ui_id    = ui_grp->t_item[i].ui_id;
-      p_color  = ui_grp->t_item[i].pc.uint;
-      r_color  = ui_grp->t_item[i].rc.uint;
+   if (!_ui_tok_field (t, &s))
+      return 0;
 
-      if ((pitem = (b_item_t *)_ui_find_item(ui_grp, ui_id)) == NULL)
-         continue;
-      x_s = pitem->r.x;
-      x_e = pitem->r.x + pitem->r.w;
-      y_s = pitem->r.y;
-      y_e = pitem->r.y + pitem->r.h;
-
-      if ((x_s <= event->x) && (x_e > event->x)) {
-         if ((y_s <= event->y) && (y_e > event->y)) {
-            if (event->status == eTS_STATUS_PRESS)
-               ui_set_ritem (fb, ui_grp, ui_id, p_color, -1);
-            else
-               ui_set_ritem (fb, ui_grp, ui_id, r_color, -1);
+   for (i = 0; (i < s.len) && ((s.p[i] == ' ') || (s.p[i] == '\t')); i++)
+      ;
+   if (i == s.len)
+      return 0;
 
-            return ui_id;
-         }
-      }
+   if (_ui_slice_num (&s, base, val)) {
+      snprintf (msg, sizeof(msg), "invalid %s field '%s'", (base == 16) ? "hex" : "number", name);
+      _ui_tok_error (t, s.p, msg);
+      return 0;
    }
-   return -1;
+   return 1;
 }
 
 //------------------------------------------------------------------------------
-void ui_set_ritem (fb_info_t *fb, ui_grp_t *ui_grp, int f_id, int bc, int lc)
+// 문자열 field. 앞부분의 공백은 제거한다. field가 없으면 0.
+//------------------------------------------------------------------------------
+static int _ui_tok_str (ui_tok_t *t, ui_slice_t *s)
 {
-    b_item_t *pitem = _ui_find_item(ui_grp, f_id);
+   if (!_ui_tok_field (t, s))
+      return 0;
 
-    /* popup message */
-    if (ui_grp->p_item.timeout) return;
-
-    if ((f_id < ITEM_COUNT_MAX) && (pitem != NULL)) {
-        if (bc != -1)  pitem->r.bc.uint = bc;
-        if (lc != -1)  pitem->r.lc.uint = lc;
-        ui_set_sitem (fb, ui_grp, f_id, -1, bc, NULL);
-        ui_update (fb, ui_grp, f_id);
-    }
+   while (s->len && (*s->p == 0x20)) {
+      s->p++;  s->len--;
+   }
+   return 1;
 }
 
 //------------------------------------------------------------------------------
-void ui_set_sitem (fb_info_t *fb, ui_grp_t *ui_grp, int f_id, int fc, int bc, char *str)
+// C(cmd), LCD RGB배열(0 = RGB, 1 = BGR), 기본문자색상(fc), 기본박스색상(rc), 기본외곽색상(lc), 한글폰트(fn:0~4),
+//          smooth font(sf:0,1 생략가능)
+//------------------------------------------------------------------------------
+static void _ui_parser_cmd_C (ui_tok_t *t, fb_info_t *fb, ui_grp_t *ui_grp)
 {
-    b_item_t *pitem = _ui_find_item(ui_grp, f_id);
+   int is_bgr, fc, bc, lc, f_type, smooth;
 
-    /* popup message */
-    if (ui_grp->p_item.timeout) return;
+   if (_ui_tok_num (t, 10, &is_bgr, "bgr") || _ui_tok_num (t, 16, &fc, "fc") ||
+       _ui_tok_num (t, 16, &bc, "bc")      || _ui_tok_num (t, 16, &lc, "lc") ||
+       _ui_tok_num (t, 10, &f_type, "font"))
+      return;
 
-    if ((f_id < ITEM_COUNT_MAX) && (pitem != NULL)) {
-        /* font color 변경 */
-        if (fc != -1)
-            pitem->s.fc.uint = fc;
-        if (bc != -1)
-            pitem->s.bc.uint = bc;
+   fb->is_bgr      = (is_bgr != 0) ? 1: 0;
+   ui_grp->fc.uint = fc;   ui_grp->bc.uint = bc;   ui_grp->lc.uint = lc;
+   ui_grp->f_type  = f_type;
 
-        /* 받아온 string을 buf에 저장 */
-        if (str != NULL)  {
-            char buf[ITEM_STR_MAX];
-
-            memset (buf, 0x00, sizeof(buf));
-            sprintf(buf, "%s", str);
-            /*
-                기존 문자열 보다 새로운 문자열이 더 작은 경우
-                기존 문자열을 배경색으로 덮어 씌운다.
-            */
-            if ((strlen(pitem->s.str) > strlen(buf)))
-                _ui_clr_str (fb, &pitem->r, &pitem->s);
-
-            /* 새로운 string 복사 */
-            strncpy(pitem->s.str, buf, strlen(buf));
-            switch (pitem->s_align) {
-                default :
-                case STR_ALIGN_C:
-                    pitem->s.x = -1, pitem->s.y = -1;
-                    break;
-            }
-        }
-        _ui_str_pos_xy(&pitem->r, &pitem->s);
-        _ui_update_s (fb, &pitem->s, pitem->r.x, pitem->r.y);
-    }
+   if (_ui_tok_opt (t, 10, &smooth, "smooth"))
+      ui_grp->f_smooth = (smooth != 0) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
-void ui_set_str (fb_info_t *fb, ui_grp_t *ui_grp,
-                  int f_id, int x, int y, int scale, int font, char *fmt, ...)
+// B/R 항목의 rect field (x%, y%, w%, h%, lw). 비율값은 fb 크기의 pixel 값으로 변환한다.
+//------------------------------------------------------------------------------
+static int _ui_tok_rect (ui_tok_t *t, fb_info_t *fb, rect_item_t *r)
 {
-   b_item_t *pitem = _ui_find_item (ui_grp, f_id);
+   if (_ui_tok_num (t, 10, &r->x, "x")  || _ui_tok_num (t, 10, &r->y, "y") ||
+       _ui_tok_num (t, 10, &r->w, "w")  || _ui_tok_num (t, 10, &r->h, "h") ||
+       _ui_tok_num (t, 10, &r->lw, "lw"))
+      return -1;
 
-   if ((f_id < ITEM_COUNT_MAX) && (pitem != NULL)) {
+   r->x = (r->x * fb->w / 100);  r->y = (r->y * fb->h / 100);
+   r->w = (r->w * fb->w / 100);  r->h = (r->h * fb->h / 100);
+   return 0;
+}
 
-      va_list va;
-      char buf[ITEM_STR_MAX];
-      int n_scale = pitem->s.scale;
+//------------------------------------------------------------------------------
+// R(cmd), ID(uid), 시작x좌표(x%), 시작y좌표(y%), 넓이(w%), 높이(h%), 외곽두께(lw), color, line_color, GroupID,
+//------------------------------------------------------------------------------
+static void _ui_parser_cmd_R (ui_tok_t *t, fb_info_t *fb, ui_grp_t *ui_grp)
+{
+   int id, bc, lc, gid, pos;
+   rect_item_t r;
 
-      /* 받아온 가변인자를 string 형태로 변환 하여 buf에 저장 */
-      memset(buf, 0x00, sizeof(buf));
-      va_start(va, fmt);   vsprintf(buf, fmt, va); va_end(va);
+   if (_ui_tok_num (t, 10, &id, "id") || _ui_tok_rect (t, fb, &r) ||
+       _ui_tok_num (t, 16, &bc, "color") || _ui_tok_num (t, 16, &lc, "line_color") ||
+       _ui_tok_num (t, 10, &gid, "gid"))
+      return;
 
-      if (scale) {
-         /* scale = -1 이면 최대 스케일을 구하여 표시한다 */
-         if (scale < 0)
-            n_scale = _ui_str_scale (pitem->r.w, pitem->r.h, pitem->r.lw,
-                                       _my_strlen(buf));
-         else
-            n_scale = scale;
+   /* 설정되어진 ID가 있는지 찾는다. (기존 설정되어진 값 변경시) */
+   if ((pos = _ui_item_add (ui_grp, id, 0)) < 0)
+      return;
 
-         if (pitem->s.scale > n_scale)
-            _ui_clr_str (fb, &pitem->r, &pitem->s);
-      }
+   r.bc.uint = (bc >= 0) ? (unsigned int)bc : ui_grp->bc.uint;
+   r.lc.uint = (lc >= 0) ? (unsigned int)lc : ui_grp->lc.uint;
 
-      if (font) {
-         pitem->s.f_type = (font < 0) ? ui_grp->f_type : font;
-         set_font(pitem->s.f_type);
-      }
+   ui_grp->b_rect[pos] = r;
+   ui_grp->b_gid[pos]  = gid;
+}
 
-      /*
-      기존 문자열 보다 새로운 문자열이 더 작은 경우
-      기존 문자열을 배경색으로 덮어 씌운다.
-      */
-      if ((strlen(pitem->s.str) > strlen(buf)) || n_scale != pitem->s.scale) {
-         _ui_clr_str (fb, &pitem->r, &pitem->s);
-         pitem->s.scale = n_scale;
-      }
-      pitem->s.x = (x != 0) ? x : pitem->s.x;
-      pitem->s.y = (y != 0) ? y : pitem->s.y;
+//------------------------------------------------------------------------------
+// S(cmd), ID(uid), 폰트크기(scale), 문자정렬(align), color, back_color, 문자열(str)
+//------------------------------------------------------------------------------
+static void _ui_parser_cmd_S (ui_tok_t *t, ui_grp_t *ui_grp)
+{
+   int id, scale, align, fc, bc, pos;
+   string_item_t *s;
+   b_item_t *pitem;
+   ui_slice_t str;
 
-      /* 새로운 string 복사 */
-      strncpy(pitem->s.str, buf, strlen(buf));
+   if (_ui_tok_num (t, 10, &id, "id") || _ui_tok_num (t, 10, &scale, "scale") ||
+       _ui_tok_num (t,  0, &align, "align") ||
+       _ui_tok_num (t, 16, &fc, "color") || _ui_tok_num (t, 16, &bc, "back_color"))
+      return;
 
-      _ui_str_pos_xy(&pitem->r, &pitem->s);
-      _ui_update_s (fb, &pitem->s, pitem->r.x, pitem->r.y);
+   /* 설정되어진 ID가 있는지 찾는다. (기존 설정되어진 값 변경시) */
+   if ((pos = _ui_item_add (ui_grp, id, 0)) < 0)
+      return;
+   pitem = &ui_grp->b_item[pos];
+   s = &pitem->s;
+   s->scale = scale;
+   pitem->s_align = align;
+   s->align = pitem->s_align;
+
+   s->f_type  = ui_grp->f_type;  s->f_smooth = ui_grp->f_smooth;
+   s->fc.uint = (fc >= 0) ? (unsigned int)fc : ui_grp->fc.uint;
+
+   /* back_color = -2 (COLOR_TRANSPARENT) 인 경우 문자열의 배경은 그리지 않음 */
+   if ((bc >= 0) || (bc == COLOR_TRANSPARENT))
+      s->bc.uint = bc;
+   else
+      s->bc.uint = ui_grp->b_rect[pos].bc.uint;
+
+   /* 문자열이 없거나 앞부분의 공백이 있는 경우 제거 */
+   if (_ui_tok_str (t, &str)) {
+      _ui_str_nset (ui_grp, s, str.p, str.len);
+      // default string for ui_reset
+      pitem->s_dfl = _ui_intern (&ui_grp->arena, str.p, str.len);
    }
+
+   /* 문자열 위치는 정렬(align)에 따라 _ui_str_pos_xy()에서 계산 */
+   s->x = -1;  s->y = -1;
 }
 
 //------------------------------------------------------------------------------
-static void _ui_update (fb_info_t *fb, ui_grp_t *ui_grp, int id)
+// B(cmd), ID(id), 시작x좌표(x%), 시작y좌표(y%), 넓이(w%), 높이(h%), 외곽두께(lw),
+//          폰트크기(scale), 문자정렬(align), GroupID, 문자열(str)
+//------------------------------------------------------------------------------
+static void _ui_parser_cmd_B (ui_tok_t *t, fb_info_t *fb, ui_grp_t *ui_grp)
 {
-    b_item_t *pitem = _ui_find_item(ui_grp, id);
+   int id, scale, align, gid, pos;
+   rect_item_t   r;
+   string_item_t *s;
+   b_item_t *pitem;
+   ui_slice_t str;
 
-    /* popup message */
-    if (ui_grp->p_item.timeout) return;
+   if (_ui_tok_num (t, 10, &id, "id") || _ui_tok_rect (t, fb, &r) ||
+       _ui_tok_num (t, 10, &scale, "scale") || _ui_tok_num (t, 0, &align, "align") ||
+       _ui_tok_num (t, 10, &gid, "gid"))
+      return;
 
-    if ((id < ITEM_COUNT_MAX) && (pitem != NULL)) {
-        pitem->s.f_type = ui_grp->f_type;
+   if ((pos = _ui_item_add (ui_grp, id, 1)) < 0)
+      return;
+   pitem = &ui_grp->b_item[pos];
+   s = &pitem->s;
 
-        if ((signed)pitem->s.bc.uint < 0)
-            pitem->s.bc.uint = pitem->r.bc.uint;
+   r.bc.uint = ui_grp->bc.uint;
+   r.lc.uint = ui_grp->lc.uint;
+   ui_grp->b_rect[pos] = r;
+   ui_grp->b_gid[pos]  = gid;
 
-        set_font(pitem->s.f_type);
+   s->scale = scale;
+   pitem->s_align = align;
+   s->align = pitem->s_align;
 
-        if (pitem->s.scale < 0)
-            pitem->s.scale = _ui_str_scale (pitem->r.w, pitem->r.h, pitem->r.lw,
-                                               _my_strlen(pitem->s.str));
+   /* 문자열이 없거나 앞부분의 공백이 있는 경우 제거 */
+   if (_ui_tok_str (t, &str)) {
+      _ui_str_nset (ui_grp, s, str.p, str.len);
+      // default string for ui_reset
+      pitem->s_dfl = _ui_intern (&ui_grp->arena, str.p, str.len);
+   }
 
-        _ui_str_pos_xy(&pitem->r, &pitem->s);
-        _ui_update_r (fb, &pitem->r);
-        _ui_update_s (fb, &pitem->s, pitem->r.x, pitem->r.y);
-    }
+   s->f_type  = ui_grp->f_type;   s->fc.uint = ui_grp->fc.uint;
+   s->bc.uint = ui_grp->bc.uint;  s->f_smooth = ui_grp->f_smooth;
+
+   /* 문자열 위치는 정렬(align)에 따라 _ui_str_pos_xy()에서 계산 */
+   s->x = -1;  s->y = -1;
 }
 
 //------------------------------------------------------------------------------
-void ui_set_printf (fb_info_t *fb, ui_grp_t *ui_grp, int id, char *fmt, ...)
+// I(cmd), ID(uid), GroupID, DeviceID, 상태표시(is_info, 생략시 1), 이름(name) - 모두 생략 가능
+//------------------------------------------------------------------------------
+static void _ui_parser_cmd_I (ui_tok_t *t, ui_grp_t *ui_grp)
 {
-   va_list va;
-   char buf[ITEM_STR_MAX];
+   int item_cnt = ui_grp->i_item_cnt, val;
+   i_item_t *i_item;
+   ui_slice_t str;
 
-   /* 받아온 가변인자를 string 형태로 변환 하여 buf에 저장 */
-   memset(buf, 0x00, sizeof(buf));
-   va_start(va, fmt);   vsprintf(buf, fmt, va); va_end(va);
-
-   ui_set_str (fb, ui_grp, id, -1, -1, -1, -1, buf);
-}
+   if (item_cnt >= ui_grp->i_item_max) {
+      fprintf(stdout, "%s : i_item overflow! (max = %d)\n", __func__, ui_grp->i_item_max);
+      return;
+   }
+   i_item = &ui_grp->i_item[item_cnt];
+   i_item->name    = "";
+   i_item->is_info = 1;
 
-//------------------------------------------------------------------------------
-void ui_update (fb_info_t *fb, ui_grp_t *ui_grp, int id)
-{
-    int i;
+   if (_ui_tok_opt (t, 10, &val, "id"))       i_item->ui_id  = val;
+   if (_ui_tok_opt (t, 10, &val, "gid"))      i_item->grp_id = val;
+   if (_ui_tok_opt (t, 10, &val, "did"))      i_item->dev_id = val;
+   if (_ui_tok_opt (t, 10, &val, "is_info"))  i_item->is_info = (val == 1) ? 1 : 0;
 
-    /* popup message */
-    if (ui_grp->p_item.timeout) return;
+   /* 문자열이 없거나 앞부분의 공백이 있는 경우 제거 */
+   if (_ui_tok_str (t, &str))
+      i_item->name = _ui_intern (&ui_grp->arena, str.p, str.len);
 
-    /* ui_grp에 등록되어있는 모든 item에 대하여 화면 업데이트 함 */
-    if (id < 0) {
-        /* 모든 item에 대한 화면 업데이트 */
-        for (i = 0; i < ITEM_COUNT_MAX; i++)
-            _ui_update (fb, ui_grp, i);
-    }
-    else
-        /* id값으로 설정된 1 개의 item에 대한 화면 업데이트 */
-        _ui_update (fb, ui_grp, id);
+   item_cnt++;
+   ui_grp->i_item_cnt = item_cnt;
 }
 
 //------------------------------------------------------------------------------
-void ui_update_group (fb_info_t *fb, ui_grp_t *ui_grp, int gid)
+// T(cmd), ID(uid), Press Color, Release Color
+//------------------------------------------------------------------------------
+static void _ui_parser_cmd_T (ui_tok_t *t, ui_grp_t *ui_grp)
 {
-   int i;
+   int item_cnt = ui_grp->t_item_cnt, val, pos;
+   t_item_t *t_item;
 
-    /* popup message */
-    if (ui_grp->p_item.timeout) return;
+   if (item_cnt >= ui_grp->t_item_max) {
+      fprintf(stdout, "%s : t_item overflow! (max = %d)\n", __func__, ui_grp->t_item_max);
+      return;
+   }
+   t_item = &ui_grp->t_item[item_cnt];
+   t_item->ui_id   = 0;
+   t_item->pc.uint = ui_grp->bc.uint;
+   t_item->rc.uint = ui_grp->bc.uint;
 
+   if (_ui_tok_opt (t, 10, &val, "id"))
+      t_item->ui_id = val;
+
+   if (_ui_tok_opt (t, 16, &val, "press_color") && (val >= 0))
+      t_item->pc.uint = val;
+
+   if (_ui_tok_opt (t, 16, &val, "release_color")) {
+      if (val >= 0)
+         t_item->rc.uint = val;
+      else {
+         /* 설정되어진 ID가 있는지 찾는다. (기존 설정되어진 값 변경시) */
+         pos = _ui_find_item (ui_grp, t_item->ui_id);
+         if (pos >= 0)
+            t_item->rc.uint = ui_grp->b_rect[pos].bc.uint;
+      }
+   }
+   item_cnt++;
+   ui_grp->t_item_cnt = item_cnt;
+}
+
+//------------------------------------------------------------------------------
+// 문자열 위치가 설정되지 않은 경우(-1) 정렬(align)에 따라 위치를 계산한다.
+// 여러 줄 문자열은 rect 외곽선 안쪽이 layout 박스가 되며 줄 단위 정렬은 layout에서 처리한다.
+//------------------------------------------------------------------------------
+static void _ui_str_pos_xy (rect_item_t *r_item, string_item_t *s_item)
+{
+   int w, h;
+
+   _ui_str_size (s_item, &w, &h);
+
+   if (_ui_str_multi (s_item)) {
+      if (s_item->x < 0)   s_item->x = r_item->lw;
+      if (s_item->y < 0)   s_item->y = r_item->lw;
+      return;
+   }
+   if (s_item->x < 0) {
+      switch (s_item->align & TEXT_ALIGN_MASK) {
+         case STR_ALIGN_L:
+            s_item->x = r_item->lw;
+            break;
+         case STR_ALIGN_R:
+            s_item->x = r_item->w - r_item->lw - w;
+            break;
+         default :
+         case STR_ALIGN_C:
+            s_item->x = ((r_item->w - w) / 2);
+            break;
+      }
+   }
+   if (s_item->y < 0)
+      s_item->y = ((r_item->h - h)) / 2;
+}
+
+//------------------------------------------------------------------------------
+// b_item을 추가하고 item 위치를 반환한다. (실패시 -1)
+// append가 0이면 같은 id의 item이 있는 경우 그 item 위치를 돌려준다.
+// item table은 ui_init에서 cfg 파일의 B/R/S 항목 수 만큼 할당되어 있다.
+//------------------------------------------------------------------------------
+static int _ui_item_add (ui_grp_t *ui_grp, int id, int append)
+{
+   int pos;
+
+   if (!append && ((pos = _ui_find_item (ui_grp, id)) >= 0))
+      return pos;
+
+   if ((pos = ui_grp->b_item_cnt) >= ui_grp->b_item_max) {
+      fprintf(stdout, "%s : b_item overflow! (max = %d)\n", __func__, ui_grp->b_item_max);
+      return -1;
+   }
+   ui_grp->b_id[pos]         = id;
+   ui_grp->b_item[pos].s_dfl = "";
+   if (_ui_str_alloc (ui_grp, &ui_grp->b_item[pos].s, 0))
+      return -1;
+
+   _ui_item_map (ui_grp, pos);
+   ui_grp->b_item_cnt++;
+   return pos;
+}
+
+//------------------------------------------------------------------------------
+// id -> b_item 위치를 등록한다. 같은 id가 여러개인 경우 처음 등록된 item을 사용한다.
+//------------------------------------------------------------------------------
+static void _ui_item_map (ui_grp_t *ui_grp, int item_pos)
+{
+   int id = ui_grp->b_id[item_pos];
+
+   if ((id >= 0) && (id < ui_grp->b_map_size) && !ui_grp->b_map[id])
+      ui_grp->b_map[id] = item_pos + 1;
+}
+
+//------------------------------------------------------------------------------
+// 전체 업데이트(ui_update(-1))시 그리는 순서. 등록된 item만 id 순서로 저장한다.
+// b_map 범위를 벗어나는 id는 뒤쪽에 id 순서로 삽입한다.
+//------------------------------------------------------------------------------
+static void _ui_item_order (ui_grp_t *ui_grp)
+{
+   int id, i, j, pos;
+
+   for (id = 0, ui_grp->b_order_cnt = 0; id < ui_grp->b_map_size; id++)
+      if (ui_grp->b_map[id])
+         ui_grp->b_order[ui_grp->b_order_cnt++] = ui_grp->b_map[id] - 1;
+
+   for (i = 0; i < ui_grp->b_item_cnt; i++) {
+      id = ui_grp->b_id[i];
+      if ((id < ui_grp->b_map_size) || (_ui_find_item (ui_grp, id) != i))
+         continue;
+
+      for (j = ui_grp->b_order_cnt; j > 0; j--) {
+         pos = ui_grp->b_order[j - 1];
+         if (ui_grp->b_id[pos] < id)
+            break;
+         ui_grp->b_order[j] = pos;
+      }
+      ui_grp->b_order[j] = i;
+      ui_grp->b_order_cnt++;
+   }
+}
+
+//------------------------------------------------------------------------------
+// id에 해당하는 item 위치(없으면 -1). (0 ~ b_map_size-1 은 b_map, 그 외의 id는 b_id 검색)
+//------------------------------------------------------------------------------
+static int _ui_find_item (ui_grp_t *ui_grp, int fid)
+{
+   int i;
+
+   if ((fid >= 0) && (fid < ui_grp->b_map_size))
+      return ui_grp->b_map[fid] - 1;
+
+   for (i = 0; i < ui_grp->b_item_cnt; i++) {
+      if (fid == ui_grp->b_id[i])
+         return i;
+   }
+   return -1;
+}
+
+//------------------------------------------------------------------------------
+// t_item이 가지는 rect와 겹치는 grid cell 범위. rect가 없으면 0을 반환한다.
+//------------------------------------------------------------------------------
+static int _ui_touch_cells (ui_grp_t *ui_grp, t_item_t *t_item,
+                              int *cx_s, int *cx_e, int *cy_s, int *cy_e)
+{
+   rect_item_t *r;
+
+   if (t_item->b_pos < 0)
+      return 0;
+
+   r = &ui_grp->b_rect[t_item->b_pos];
+   if ((r->w <= 0) || (r->h <= 0) || (r->x >= ui_grp->tg_w) || (r->y >= ui_grp->tg_h) ||
+       (r->x + r->w <= 0) || (r->y + r->h <= 0))
+      return 0;
+
+   *cx_s = (r->x <= 0) ? 0 : (r->x * UI_TGRID / ui_grp->tg_w);
+   *cy_s = (r->y <= 0) ? 0 : (r->y * UI_TGRID / ui_grp->tg_h);
+   *cx_e = (r->x + r->w >= ui_grp->tg_w) ?
+            UI_TGRID - 1 : ((r->x + r->w - 1) * UI_TGRID / ui_grp->tg_w);
+   *cy_e = (r->y + r->h >= ui_grp->tg_h) ?
+            UI_TGRID - 1 : ((r->y + r->h - 1) * UI_TGRID / ui_grp->tg_h);
+   return 1;
+}
+
+//------------------------------------------------------------------------------
+// t_item을 item 위치와 연결하고 touch hit test grid를 만든다.
+// fb 화면을 UI_TGRID x UI_TGRID cell로 나누고 cell과 겹치는 t_item 번호를 t_item 순서로 저장한다.
+// ui_init 및 fb 크기(회전)가 바뀐 경우 다시 만든다.
+//------------------------------------------------------------------------------
+static void _ui_touch_index (fb_info_t *fb, ui_grp_t *ui_grp)
+{
+   int i, cx, cy, cx_s, cx_e, cy_s, cy_e, cell;
+   int pos[UI_TGRID * UI_TGRID];
+
+   if (ui_grp->tg_list)
+      free (ui_grp->tg_list);
+   ui_grp->tg_list = NULL;
+   ui_grp->tg_w    = fb->w;
+   ui_grp->tg_h    = fb->h;
+   memset (ui_grp->tg_start, 0, sizeof(ui_grp->tg_start));
+
+   if ((fb->w <= 0) || (fb->h <= 0))
+      return;
+
+   /* cell 별 t_item 수 */
+   for (i = 0; i < ui_grp->t_item_cnt; i++) {
+      ui_grp->t_item[i].b_pos = _ui_find_item (ui_grp, ui_grp->t_item[i].ui_id);
+      if (!_ui_touch_cells (ui_grp, &ui_grp->t_item[i], &cx_s, &cx_e, &cy_s, &cy_e))
+         continue;
+      for (cy = cy_s; cy <= cy_e; cy++)
+         for (cx = cx_s; cx <= cx_e; cx++)
+            ui_grp->tg_start[cy * UI_TGRID + cx + 1]++;
+   }
+   for (cell = 0; cell < UI_TGRID * UI_TGRID; cell++) {
+      ui_grp->tg_start[cell + 1] += ui_grp->tg_start[cell];
+      pos[cell] = ui_grp->tg_start[cell];
+   }
+   if (!ui_grp->tg_start[UI_TGRID * UI_TGRID])
+      return;
+
+   if ((ui_grp->tg_list = (int *)malloc (ui_grp->tg_start[UI_TGRID * UI_TGRID] *
+                                         sizeof(int))) == NULL) {
+      fprintf(stdout, "%s : touch grid malloc error!\n", __func__);
+      return;
+   }
+   for (i = 0; i < ui_grp->t_item_cnt; i++) {
+      if (!_ui_touch_cells (ui_grp, &ui_grp->t_item[i], &cx_s, &cx_e, &cy_s, &cy_e))
+         continue;
+      for (cy = cy_s; cy <= cy_e; cy++)
+         for (cx = cx_s; cx <= cx_e; cx++)
+            ui_grp->tg_list[pos[cy * UI_TGRID + cx]++] = i;
+   }
+}
+
+//------------------------------------------------------------------------------
+// (x, y)가 t_item의 rect(hot table) 안에 있는지 확인한다.
+//------------------------------------------------------------------------------
+static int _ui_touch_hit (ui_grp_t *ui_grp, t_item_t *t_item, int x, int y)
+{
+   rect_item_t *r;
+
+   if (t_item->b_pos < 0)
+      return 0;
+
+   r = &ui_grp->b_rect[t_item->b_pos];
+   return (r->x <= x) && (r->x + r->w > x) && (r->y <= y) && (r->y + r->h > y);
+}
+
+//------------------------------------------------------------------------------
+// (x, y) 위치의 t_item 번호(없으면 -1). 화면에는 그리지 않는다.
+// touch 위치의 cell에 등록된 t_item만 확인한다. (겹치는 경우 먼저 등록된 t_item)
+//------------------------------------------------------------------------------
+int ui_find_titem (fb_info_t *fb, ui_grp_t *ui_grp, int x, int y)
+{
+   int i, n, cell;
+
+   if ((ui_grp->tg_w != fb->w) || (ui_grp->tg_h != fb->h))
+      _ui_touch_index (fb, ui_grp);
+
+   /* 화면 밖의 touch 위치는 모든 t_item을 확인 */
+   if ((x < 0) || (x >= fb->w) || (y < 0) || (y >= fb->h)) {
+      for (i = 0; i < ui_grp->t_item_cnt; i++)
+         if (_ui_touch_hit (ui_grp, &ui_grp->t_item[i], x, y))
+            return i;
+      return -1;
+   }
+   if (ui_grp->tg_list == NULL)
+      return -1;
+
+   cell = (y * UI_TGRID / fb->h) * UI_TGRID + (x * UI_TGRID / fb->w);
+   for (n = ui_grp->tg_start[cell]; n < ui_grp->tg_start[cell + 1]; n++) {
+      i = ui_grp->tg_list[n];
+      if (_ui_touch_hit (ui_grp, &ui_grp->t_item[i], x, y))
+         return i;
+   }
+   return -1;
+}
+
+//------------------------------------------------------------------------------
+// touch 위치의 t_item을 press/release 색으로 표시하고 ui_id를 반환한다.
+//------------------------------------------------------------------------------
+int ui_get_titem (fb_info_t *fb, ui_grp_t *ui_grp, ts_event_t *event)
+{
+   t_item_t *t_item;
+   int i;
+
+   if ((i = ui_find_titem (fb, ui_grp, event->x, event->y)) < 0)
+      return -1;
+
+   t_item = &ui_grp->t_item[i];
+   if (event->status == eTS_STATUS_PRESS)
+      ui_set_ritem (fb, ui_grp, t_item->ui_id, t_item->pc.uint, -1);
+   else
+      ui_set_ritem (fb, ui_grp, t_item->ui_id, t_item->rc.uint, -1);
+
+   return t_item->ui_id;
+}
+
+//------------------------------------------------------------------------------
+// rect 색상 변경. rect와 문자열 배경을 같이 바꾸며 item 전체를 1번만 다시 그린다.
+//------------------------------------------------------------------------------
+void ui_set_ritem (fb_info_t *fb, ui_grp_t *ui_grp, int f_id, int bc, int lc)
+{
+    int pos = _ui_find_item(ui_grp, f_id);
+
+    if (pos >= 0) {
+        _ui_lock (ui_grp);
+        if (bc != -1)  ui_grp->b_rect[pos].bc.uint = bc;
+        if (lc != -1)  ui_grp->b_rect[pos].lc.uint = lc;
+        if (bc != -1)  ui_grp->b_item[pos].s.bc.uint = bc;
+        _ui_mark (fb, ui_grp, pos, UI_DIRTY_RECT | UI_DIRTY_COLOR);
+        _ui_unlock (ui_grp);
+    }
+}
+
+//------------------------------------------------------------------------------
+void ui_set_sitem (fb_info_t *fb, ui_grp_t *ui_grp, int f_id, int fc, int bc, char *str)
+{
+    int pos = _ui_find_item(ui_grp, f_id), dirty = 0;
+    b_item_t *pitem;
+
+    if (pos >= 0) {
+        _ui_lock (ui_grp);
+        pitem = &ui_grp->b_item[pos];
+        /* font color 변경 */
+        if (fc != -1)
+            pitem->s.fc.uint = fc,  dirty |= UI_DIRTY_COLOR;
+        if (bc != -1)
+            pitem->s.bc.uint = bc,  dirty |= UI_DIRTY_COLOR;
+
+        /* 새로운 string 복사 */
+        if (str != NULL)  {
+            _ui_str_set (ui_grp, &pitem->s, str);
+            /* 정렬(align)에 따라 위치를 다시 계산 */
+            pitem->s.x = -1, pitem->s.y = -1;
+            dirty |= UI_DIRTY_STR;
+        }
+        /* 기존 문자열과 비교하여 변경된 glyph만 다시 그림 */
+        _ui_mark (fb, ui_grp, pos, dirty ? dirty : UI_DIRTY_STR);
+        _ui_unlock (ui_grp);
+    }
+}
+
+//------------------------------------------------------------------------------
+void ui_set_str (fb_info_t *fb, ui_grp_t *ui_grp,
+                  int f_id, int x, int y, int scale, int font, char *fmt, ...)
+{
+   va_list va;
+
+   va_start(va, fmt);
+   ui_vset_str (fb, ui_grp, f_id, x, y, scale, font, fmt, va);
+   va_end(va);
+}
+
+//------------------------------------------------------------------------------
+void ui_vset_str (fb_info_t *fb, ui_grp_t *ui_grp,
+                  int f_id, int x, int y, int scale, int font, char *fmt, va_list va)
+{
+   int pos = _ui_find_item (ui_grp, f_id);
+   b_item_t *pitem;
+
+   if (pos >= 0) {
+      _ui_lock (ui_grp);
+      pitem = &ui_grp->b_item[pos];
+
+      /* 받아온 가변인자를 item 문자열로 바로 변환 (기존 문자열은 d_str에 남아있음) */
+      _ui_str_vset (ui_grp, &pitem->s, fmt, va);
+
+      /* scale = -1 이면 최대 스케일을 구하여 표시한다 */
+      if (scale)
+         pitem->s.scale = (scale < 0) ? _ui_str_scale (&ui_grp->b_rect[pos], &pitem->s) : scale;
+
+      if (font)
+         pitem->s.f_type = (font < 0) ? ui_grp->f_type : font;
+
+      pitem->s.x = (x != 0) ? x : pitem->s.x;
+      pitem->s.y = (y != 0) ? y : pitem->s.y;
+
+      /*
+         기존 문자열과 비교하여 변경된 glyph만 다시 그린다.
+         위치 또는 scale이 바뀐 경우 기존 문자열을 지우고 전체를 다시 그림.
+      */
+      _ui_mark (fb, ui_grp, pos, UI_DIRTY_STR);
+      _ui_unlock (ui_grp);
+   }
+}
+
+//------------------------------------------------------------------------------
+// pos 위치의 item(rect + 문자열)을 다시 그린다. (pos < 0 이면 무시)
+// popup 표시중에는 dirty로 표시만 하고 popup이 끝난 후 그린다.
+//------------------------------------------------------------------------------
+static void _ui_update (fb_info_t *fb, ui_grp_t *ui_grp, int pos)
+{
+    if ((pos >= 0) && _ui_popup_on (ui_grp)) {
+        ui_grp->b_dirty[pos] |= UI_DIRTY_RECT;
+        ui_grp->dirty = 1;
+        return;
+    }
+
+    if (pos >= 0) {
+        _ui_item_prep (ui_grp, pos);
+        _ui_update_rs (fb, &ui_grp->text, &ui_grp->b_rect[pos], &ui_grp->b_item[pos].s);
+        ui_grp->b_dirty[pos] = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+// item 전체를 그리기 전 font, 배경색(rect 배경색 사용), 자동 scale, 문자열 위치를 정한다.
+//------------------------------------------------------------------------------
+static void _ui_item_prep (ui_grp_t *ui_grp, int pos)
+{
+    string_item_t *s = &ui_grp->b_item[pos].s;
+    rect_item_t *r   = &ui_grp->b_rect[pos];
+
+    s->f_type = ui_grp->f_type;
+
+    if (((signed)s->bc.uint < 0) && ((signed)s->bc.uint != COLOR_TRANSPARENT))
+        s->bc.uint = r->bc.uint;
+
+    if (s->scale < 0)
+        s->scale = _ui_str_scale (r, s);
+
+    _ui_str_pos_xy(r, s);
+}
+
+//------------------------------------------------------------------------------
+// pos 위치 item의 dirty bit를 설정한다.
+// 지연 모드가 아니면 바로 그리고, 지연 모드에서는 ui_flush에서 1번만 그린다.
+// popup 표시중 미뤄진 item이 있으면 (ui_grp->dirty) popup이 끝난 후 같이 그린다.
+//------------------------------------------------------------------------------
+static void _ui_mark (fb_info_t *fb, ui_grp_t *ui_grp, int pos, int dirty)
+{
+   if (pos < 0)
+      return;
+
+   ui_grp->b_dirty[pos] |= dirty;
+   if (ui_grp->deferred) {
+      ui_grp->dirty = 1;
+      _ui_render_kick (ui_grp);
+   } else if (ui_grp->dirty)
+      ui_flush (fb, ui_grp);
+   else
+      _ui_flush_item (fb, ui_grp, pos);
+}
+
+//------------------------------------------------------------------------------
+// dirty item을 그린다. rect가 바뀐 경우 item 전체, 문자열/색상만 바뀐 경우 변경된 glyph만 그림.
+// 그린 경우 1, popup 표시중이라 그리지 못한 경우 0 (dirty 유지)
+//------------------------------------------------------------------------------
+static int _ui_flush_item (fb_info_t *fb, ui_grp_t *ui_grp, int pos)
+{
+   int dirty = ui_grp->b_dirty[pos];
+
+   if (_ui_popup_on (ui_grp)) {
+      ui_grp->dirty = 1;
+      return 0;
+   }
+
+   if (dirty & UI_DIRTY_RECT) {
+      _ui_update (fb, ui_grp, pos);
+      return !ui_grp->b_dirty[pos];
+   }
+   if (dirty & (UI_DIRTY_STR | UI_DIRTY_COLOR))
+      _ui_update_diff (fb, &ui_grp->text, &ui_grp->b_rect[pos], &ui_grp->b_item[pos].s);
+
+   ui_grp->b_dirty[pos] = 0;
+   return 1;
+}
+
+//------------------------------------------------------------------------------
+// 지연 모드 설정. 설정시 ui_set_xxx 함수는 item을 dirty로 표시만 하고 ui_flush에서 그린다.
+// 해제시 남아있는 dirty item을 그린다. render thread 사용중에는 변경할 수 없다.
+//------------------------------------------------------------------------------
+void ui_set_deferred (fb_info_t *fb, ui_grp_t *ui_grp, int enable)
+{
+   if (ui_grp->render)
+      return;
+
+   ui_grp->deferred = enable ? 1 : 0;
+   if (!ui_grp->deferred)
+      ui_flush (fb, ui_grp);
+}
+
+//------------------------------------------------------------------------------
+// dirty item을 z-order(ui_update(-1)과 같은 id 순서)로 1번씩 그린다. 반환값 : 그린 item 수
+// popup 표시중에는 그리지 않는다. (dirty는 유지되며 다음 ui_flush에서 그림)
+// render thread 사용중에는 render thread가 그리므로 0.
+//------------------------------------------------------------------------------
+int ui_flush (fb_info_t *fb, ui_grp_t *ui_grp)
+{
+   int i, pos, cnt = 0;
+
+   if (!ui_grp->dirty || ui_grp->render || _ui_popup_on (ui_grp))
+      return 0;
+
+   ui_grp->dirty = 0;
+   for (i = 0; i < ui_grp->b_order_cnt; i++) {
+      pos = ui_grp->b_order[i];
+      if (ui_grp->b_dirty[pos])
+         cnt += _ui_flush_item (fb, ui_grp, pos);
+   }
+   return cnt;
+}
+
+//------------------------------------------------------------------------------
+void ui_set_printf (fb_info_t *fb, ui_grp_t *ui_grp, int id, char *fmt, ...)
+{
+   va_list va;
+
+   va_start(va, fmt);
+   ui_vset_str (fb, ui_grp, id, -1, -1, -1, -1, fmt, va);
+   va_end(va);
+}
+
+//------------------------------------------------------------------------------
+void ui_vset_printf (fb_info_t *fb, ui_grp_t *ui_grp, int id, char *fmt, va_list va)
+{
+   ui_vset_str (fb, ui_grp, id, -1, -1, -1, -1, fmt, va);
+}
+
+//------------------------------------------------------------------------------
+// 확대된 문자열의 smooth glyph 사용 설정. id < 0 이면 전체 item 및 popup에 적용.
+//------------------------------------------------------------------------------
+void ui_set_smooth (fb_info_t *fb, ui_grp_t *ui_grp, int id, int enable)
+{
+   int i;
+
+   enable = enable ? 1 : 0;
+   _ui_lock (ui_grp);
+   if (id < 0) {
+      ui_grp->f_smooth = enable;
+      for (i = 0; i < ui_grp->b_item_cnt; i++)
+         ui_grp->b_item[i].s.f_smooth = enable;
+      if (ui_grp->deferred) {
+         for (i = 0; i < ui_grp->b_order_cnt; i++)
+            _ui_mark (fb, ui_grp, ui_grp->b_order[i], UI_DIRTY_RECT);
+      } else
+         ui_update (fb, ui_grp, -1);
+   } else {
+      int pos = _ui_find_item (ui_grp, id);
+
+      if (pos >= 0) {
+         ui_grp->b_item[pos].s.f_smooth = enable;
+         _ui_mark (fb, ui_grp, pos, UI_DIRTY_RECT);
+      }
+   }
+   _ui_unlock (ui_grp);
+}
+
+//------------------------------------------------------------------------------
+// rect 전체를 다시 그릴때 문자열을 sprite(image)로 복사할 item 설정. id < 0 이면 전체 item.
+// group reset 등으로 같은 문자열을 반복하여 다시 그리는 고정된 label에 사용한다.
+// sprite는 item 1개당 문자열 크기의 image buffer를 사용하며 해제시 반환한다.
+//------------------------------------------------------------------------------
+void ui_set_sprite (ui_grp_t *ui_grp, int id, int enable)
+{
+   int i, pos = (id < 0) ? -1 : _ui_find_item (ui_grp, id);
+
+   _ui_lock (ui_grp);
+   for (i = 0; i < ui_grp->b_item_cnt; i++) {
+      if ((id >= 0) && (i != pos))
+         continue;
+      ui_grp->b_item[i].s.f_sprite = enable ? 1 : 0;
+      /* render thread 사용시는 사본의 sprite를 다음에 그릴때 반환한다. */
+      if (!enable && !ui_grp->render) {
+         sprite_free (ui_grp->b_item[i].s.sprite);
+         ui_grp->b_item[i].s.sprite = NULL;
+      }
+   }
+   _ui_unlock (ui_grp);
+}
+
+//------------------------------------------------------------------------------
+void ui_update (fb_info_t *fb, ui_grp_t *ui_grp, int id)
+{
+    int i;
+
+    /* render thread 사용시 dirty로 표시만 한다. */
+    if (ui_grp->render) {
+        _ui_lock (ui_grp);
+        if (id < 0) {
+            for (i = 0; i < ui_grp->b_order_cnt; i++)
+                _ui_mark (fb, ui_grp, ui_grp->b_order[i], UI_DIRTY_RECT);
+        } else
+            _ui_mark (fb, ui_grp, _ui_find_item (ui_grp, id), UI_DIRTY_RECT);
+        _ui_unlock (ui_grp);
+        return;
+    }
+
+    /* ui_grp에 등록되어있는 모든 item에 대하여 화면 업데이트 함 */
+    if (id < 0) {
+        /* 모든 item에 대한 화면 업데이트 (등록된 item만 id 순서로) */
+        for (i = 0; i < ui_grp->b_order_cnt; i++)
+            _ui_update (fb, ui_grp, ui_grp->b_order[i]);
+    }
+    else
+        /* id값으로 설정된 1 개의 item에 대한 화면 업데이트 */
+        _ui_update (fb, ui_grp, _ui_find_item (ui_grp, id));
+}
+
+//------------------------------------------------------------------------------
+void ui_update_group (fb_info_t *fb, ui_grp_t *ui_grp, int gid)
+{
+   int i;
+
+    /* gid 검색은 hot table(b_gid)만 읽고, 해당 item만 cold table(문자열)을 변경 */
+    _ui_lock (ui_grp);
     for (i = 0; i < ui_grp->b_item_cnt; i++) {
-        if (ui_grp->b_item[i].gid == gid) {
-            ui_grp->b_item[i].r.bc.uint = ui_grp->bc.uint;
-            ui_grp->b_item[i].r.lc.uint = ui_grp->lc.uint;
+        if (ui_grp->b_gid[i] == gid) {
+            ui_grp->b_rect[i].bc.uint = ui_grp->bc.uint;
+            ui_grp->b_rect[i].lc.uint = ui_grp->lc.uint;
             ui_grp->b_item[i].s.bc.uint = ui_grp->bc.uint;
             ui_grp->b_item[i].s.fc.uint = ui_grp->fc.uint;
             ui_grp->b_item[i].s.x = ui_grp->b_item[i].s.y = -1;
-            memset  (ui_grp->b_item[i].s.str, 0x00, ITEM_STR_MAX);
-            strncpy (ui_grp->b_item[i].s.str, ui_grp->b_item[i].s_dfl, strlen (ui_grp->b_item[i].s_dfl));
-            _ui_update (fb, ui_grp, ui_grp->b_item[i].id);
+            _ui_str_set (ui_grp, &ui_grp->b_item[i].s, ui_grp->b_item[i].s_dfl);
+            if (ui_grp->render)
+                _ui_mark (fb, ui_grp, _ui_find_item (ui_grp, ui_grp->b_id[i]), UI_DIRTY_RECT);
+            else
+                _ui_update (fb, ui_grp, _ui_find_item (ui_grp, ui_grp->b_id[i]));
         }
     }
+    _ui_unlock (ui_grp);
+}
+
+//------------------------------------------------------------------------------
+void ui_close (ui_grp_t *ui_grp)
+{
+   /* 할당받은 메모리가 있다면 시스템으로 반환한다. */
+   if (ui_grp) {
+      ui_arena_t arena;
+      int i;
+
+      _ui_popup_end (ui_grp, 1);
+      _ui_render_end (ui_grp, 0);
+      ui_watch_stop (ui_grp);
+
+      for (i = 0; i < ui_grp->b_item_cnt; i++)
+         sprite_free (ui_grp->b_item[i].s.sprite);
+      sprite_free (ui_grp->p_item.s.sprite);
+
+      if (ui_grp->tg_list)
+         free (ui_grp->tg_list);
+
+      text_ctx_free (&ui_grp->text);
+      text_ctx_free (&ui_grp->p_item.text);
+      pthread_mutex_destroy (&ui_grp->p_item.lock);
+
+      if (ui_grp->c_map)
+         munmap (ui_grp->c_map, ui_grp->c_size);
+
+      /* ui_grp 자신도 arena에 있으므로 arena 정보를 복사한 후 해제 */
+      arena = ui_grp->arena;
+      _ui_arena_free (&arena);
+   }
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+int ui_set_popup (fb_info_t *fb, ui_grp_t *ui_grp,
+                    int w, int h, int lw,       /* box width, box height, box outline width */
+                    int fc, int bc, int lc,     /* color : font, background, outline */
+                    int fs, int ts, char *fmt, ...); /* font scale, display time(sec), msg format */
+int ui_vset_popup (fb_info_t *fb, ui_grp_t *ui_grp,
+                    int w, int h, int lw, int fc, int bc, int lc,
+                    int fs, int ts, char *fmt, va_list va);
+
+//------------------------------------------------------------------------------
+// render thread 사용시 popup 표시/지우기는 render thread에 요청한다.
+// popup thread가 끝날 때까지 render thread는 시작/종료되지 않는다. (_ui_popup_end)
+//------------------------------------------------------------------------------
+void *ui_popup_func (void *arg)
+{
+   ui_grp_t *ui_grp = (ui_grp_t *)arg;
+   p_item_t *p = &ui_grp->p_item;
+
+   while (_ui_popup_on (ui_grp)) {
+      if (ui_grp->render)
+         _ui_render_popup (ui_grp, UI_RENDER_POPUP_SHOW);
+      else
+         _ui_update_rs ((fb_info_t *)p->vp_fb, &p->text, &p->r, &p->s);
+      usleep (500 * 1000);
+      if (ui_grp->render)
+         _ui_render_popup (ui_grp, UI_RENDER_POPUP_HIDE);
+      else
+         _ui_update_r ((fb_info_t *)p->vp_fb, &p->r);
+      usleep (500 * 1000);
+
+      pthread_mutex_lock (&p->lock);
+      if (p->timeout)   p->timeout--;
+      pthread_mutex_unlock (&p->lock);
+   }
+   sprite_free (p->s.sprite);
+   p->s.sprite = NULL;
+   /* popup 표시중 변경된 item을 그린다. */
+   _ui_render_popup (ui_grp, 0);
+   return arg;
+}
+
+//------------------------------------------------------------------------------
+// popup 표시중이면 1
+//------------------------------------------------------------------------------
+static int _ui_popup_on (ui_grp_t *ui_grp)
+{
+   int on;
+
+   pthread_mutex_lock (&ui_grp->p_item.lock);
+   on = ui_grp->p_item.timeout ? 1 : 0;
+   pthread_mutex_unlock (&ui_grp->p_item.lock);
+   return on;
+}
+
+//------------------------------------------------------------------------------
+// popup thread가 끝날 때까지 기다린다. cancel = 1 이면 표시 시간과 관계없이 끝낸다. (ui_close)
+//------------------------------------------------------------------------------
+static void _ui_popup_end (ui_grp_t *ui_grp, int cancel)
+{
+   p_item_t *p = &ui_grp->p_item;
+
+   if (!p->joinable)
+      return;
+
+   if (cancel) {
+      pthread_mutex_lock (&p->lock);
+      p->timeout = 0;
+      pthread_mutex_unlock (&p->lock);
+   }
+   pthread_join (p->thread, NULL);
+   p->joinable = 0;
+}
+
+//------------------------------------------------------------------------------
+int ui_set_popup (fb_info_t *fb, ui_grp_t *ui_grp,
+                    int w, int h, int lw,       /* width, height, line width */
+                    int fc, int bc, int lc,     /* color : font, background, line */
+                    int fs, int ts, char *fmt, ...)  /* font scale, display time(sec), msg format */
+{
+    va_list va;
+    int ret;
+
+    va_start(va, fmt);
+    ret = ui_vset_popup (fb, ui_grp, w, h, lw, fc, bc, lc, fs, ts, fmt, va);
+    va_end(va);
+
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+int ui_vset_popup (fb_info_t *fb, ui_grp_t *ui_grp,
+                    int w, int h, int lw, int fc, int bc, int lc,
+                    int fs, int ts, char *fmt, va_list va)
+{
+    p_item_t *p = &ui_grp->p_item;
+    int i;
+
+    /* thread busy */
+    if (_ui_popup_on (ui_grp))  return 0;
+
+    /* 이전 popup thread는 끝났거나 끝나는 중 */
+    _ui_popup_end (ui_grp, 0);
+
+    /* render thread가 popup item을 복사하는 동안 변경하지 않는다. */
+    _ui_lock (ui_grp);
+
+    if ((w < fb->w) && (w > 0)) {   p->r.w = w;     p->r.x = (fb->w - w) / 2;   }
+    else                        {   p->r.w = fb->w; p->r.x = 0;                 }
+
+    if ((h < fb->h) && (h > 0)) {   p->r.h = h;     p->r.y = (fb->h - h) / 2;   }
+    else                        {   p->r.h = fb->h; p->r.y = 0;                 }
+
+    p->r.lw = lw < 0 ? 0 : lw;
+
+    p->s.fc.uint = fc < 0 ? ui_grp->fc.uint : (unsigned int)fc;
+    p->r.lc.uint = lc < 0 ? ui_grp->lc.uint : (unsigned int)lc;
+    p->s.bc.uint = p->r.bc.uint = bc < 0 ? ui_grp->bc.uint : (unsigned int)bc;
+    p->s.f_type   = ui_grp->f_type;
+    p->s.f_smooth = ui_grp->f_smooth;
+    /* 깜빡일 때마다 같은 문자열을 다시 그린다. */
+    p->s.f_sprite = 1;
+
+    /* 받아온 가변인자를 popup 문자열로 바로 변환 */
+    _ui_str_vset (ui_grp, &p->s, fmt, va);
+
+    /* 한 줄에 표시할 수 없는 긴 메시지는 단어 단위로 줄바꿈 하여 표시 */
+    p->s.align = STR_ALIGN_C;
+    _ui_str_size (&p->s, NULL, NULL);
+    if (fs < 0 ? !text_fit_scale (p->r.w, p->r.h, p->r.lw, p->s.m_cells) :
+                 (p->s.m_cells * font_cell_w (fs) > p->r.w - p->r.lw * 2))
+        p->s.align |= STR_WRAP_WORD | STR_ELLIPSIS;
+
+    p->s.scale = fs < 0 ? _ui_str_scale (&p->r, &p->s) : fs;
+
+    p->s.x = -1;    p->s.y = -1;
+    _ui_str_pos_xy(&p->r, &p->s);
+
+    p->vp_fb = (void *)fb;
+
+    /* popup이 item을 덮으므로 이후 item 업데이트는 전체를 다시 그린다. */
+    for (i = 0; i < ui_grp->b_item_cnt; i++)
+        ui_grp->b_item[i].s.d_valid = 0;
+    _ui_unlock (ui_grp);
+
+    // popup message display time setting
+    pthread_mutex_lock (&p->lock);
+    p->timeout = ts;
+    pthread_mutex_unlock (&p->lock);
+
+    if (pthread_create(&p->thread, NULL, ui_popup_func, ui_grp)) {
+        pthread_mutex_lock (&p->lock);
+        p->timeout = 0;
+        pthread_mutex_unlock (&p->lock);
+        return 0;
+    }
+    p->joinable = 1;
+    return 1;
+}
+
+//------------------------------------------------------------------------------
+// UI binary cache (<cfg>.cache)
+// ui_cache_save는 cfg를 파싱하여 pixel 값으로 변환된 item 정보를 저장한다. cfg 내용(hash, 크기),
+// fb 크기, 회전, 등록된 font face 목록이 같으면 ui_init은 파싱 대신 cache를 mmap(MAP_PRIVATE)하여 사용한다.
+// hot table(b_id, b_gid, b_rect)과 t_item, 문자열은 mmap 영역을 바로 사용한다.
+// 모든 영역은 8 bytes 단위로 정렬, 같은 시스템에서 만든 파일만 사용한다. (sizes 검사)
+//------------------------------------------------------------------------------
+#define  UI_CACHE_EXT      ".cache"
+#define  UI_CACHE_VERSION  2
+
+typedef struct ui_cache_hdr__t {
+   char                 magic[4];
+   unsigned int         version, sizes;
+   unsigned int         cfg_size;
+   unsigned long long   cfg_hash;
+   int                  w, h, rotate;
+   int                  is_bgr, f_type, f_smooth;
+   unsigned int         fc, bc, lc;
+   // 저장할 때 등록된 font face 목록 (font_faces_id). scale/x/y가 face 선택에 따라 달라진다.
+   unsigned int         faces;
+   int                  b_cnt, i_cnt, t_cnt, b_map_size;
+   // 각 영역의 file offset, 전체 file 크기
+   unsigned int         o_id, o_gid, o_rect, o_b, o_i, o_t, o_str, size;
+}  ui_cache_hdr_t;
+
+// b_item(cold) 초기값. s_dfl은 문자열 영역의 offset
+typedef struct ui_cache_b__t {
+   int                  x, y, scale, f_type, f_smooth, align, s_align;
+   unsigned int         fc, bc, s_dfl;
+}  ui_cache_b_t;
+
+typedef struct ui_cache_i__t {
+   int                  ui_id, grp_id, dev_id, is_info;
+   unsigned int         name;
+}  ui_cache_i_t;
+
+#define  UI_CACHE_SIZES    (sizeof(rect_item_t) | (sizeof(t_item_t) << 8) | \
+                           (sizeof(ui_cache_b_t) << 16) | (sizeof(ui_cache_i_t) << 24))
+
+//------------------------------------------------------------------------------
+// item 개수와 문자열 크기로 각 영역의 offset과 전체 크기를 정한다.
+//------------------------------------------------------------------------------
+static void _ui_cache_layout (ui_cache_hdr_t *hdr, unsigned int str_size)
+{
+   unsigned int size = UI_ARENA_ALIGN(sizeof(ui_cache_hdr_t));
+
+   hdr->o_id   = size;  size += UI_ARENA_ALIGN(sizeof(int) * hdr->b_cnt);
+   hdr->o_gid  = size;  size += UI_ARENA_ALIGN(sizeof(int) * hdr->b_cnt);
+   hdr->o_rect = size;  size += UI_ARENA_ALIGN(sizeof(rect_item_t) * hdr->b_cnt);
+   hdr->o_b    = size;  size += UI_ARENA_ALIGN(sizeof(ui_cache_b_t) * hdr->b_cnt);
+   hdr->o_i    = size;  size += UI_ARENA_ALIGN(sizeof(ui_cache_i_t) * hdr->i_cnt);
+   hdr->o_t    = size;  size += UI_ARENA_ALIGN(sizeof(t_item_t) * hdr->t_cnt);
+   hdr->o_str  = size;  size += str_size;
+   hdr->size   = size;
+}
+
+//------------------------------------------------------------------------------
+// cfg 파일 내용의 hash (64bits FNV-1a)
+//------------------------------------------------------------------------------
+static unsigned long long _ui_cfg_hash (const char *p, size_t size)
+{
+   unsigned long long hash = 14695981039346656037ull;
+   size_t i;
+
+   for (i = 0; i < size; i++)
+      hash = (hash ^ (unsigned char)p[i]) * 1099511628211ull;
+   return hash;
+}
+
+//------------------------------------------------------------------------------
+// cache를 mmap 하여 ui_grp를 채운다. cache가 없거나 맞지 않으면 ui_grp를 변경하지 않고 -1.
+//------------------------------------------------------------------------------
+static int _ui_cache_load (fb_info_t *fb, ui_grp_t *ui_grp, const char *cache_name,
+                           unsigned long long cfg_hash, unsigned int cfg_size)
+{
+   const ui_cache_hdr_t *hdr;
+   ui_cache_hdr_t chk;
+   const ui_cache_b_t *cb;
+   const ui_cache_i_t *ci;
+   const char *str;
+   struct stat st;
+   char *map;
+   int fd, i;
+
+   if ((fd = open (cache_name, O_RDONLY)) < 0)
+      return -1;
+
+   map = MAP_FAILED;
+   if (!fstat (fd, &st) && (st.st_size >= (off_t)sizeof(ui_cache_hdr_t)))
+      map = mmap (NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+   close (fd);
+   if (map == MAP_FAILED)
+      return -1;
+
+   hdr = (const ui_cache_hdr_t *)map;
+   if (memcmp (hdr->magic, "FBUI", 4) || (hdr->version != UI_CACHE_VERSION) ||
+       (hdr->sizes != UI_CACHE_SIZES) || (hdr->size != st.st_size) ||
+       (hdr->cfg_hash != cfg_hash) || (hdr->cfg_size != cfg_size) ||
+       (hdr->w != fb->w) || (hdr->h != fb->h) || (hdr->rotate != fb->rotate) ||
+       (hdr->faces != font_faces_id ()) ||
+       (hdr->b_cnt < 0) || (hdr->i_cnt < 0) || (hdr->t_cnt < 0) ||
+       (hdr->b_map_size < 0) || (hdr->b_map_size > UI_MAP_MAX) || (hdr->o_str > hdr->size))
+      goto out;
+
+   /* 영역 offset 및 문자열 영역(NULL 종료) 확인 */
+   chk = *hdr;
+   _ui_cache_layout (&chk, hdr->size - hdr->o_str);
+   if ((chk.o_id != hdr->o_id) || (chk.o_gid != hdr->o_gid) || (chk.o_rect != hdr->o_rect) ||
+       (chk.o_b  != hdr->o_b)  || (chk.o_i   != hdr->o_i)   || (chk.o_t    != hdr->o_t)    ||
+       ((hdr->size > hdr->o_str) && map[hdr->size - 1]))
+      goto out;
+   cb = (const ui_cache_b_t *)(map + hdr->o_b);
+   for (i = 0; i < hdr->b_cnt; i++)
+      if (cb[i].s_dfl >= hdr->size - hdr->o_str)
+         goto out;
+   ci = (const ui_cache_i_t *)(map + hdr->o_i);
+   for (i = 0; i < hdr->i_cnt; i++)
+      if (ci[i].name >= hdr->size - hdr->o_str)
+         goto out;
+
+   /* cold table, id map 할당 (실패시 ui_grp는 변경되지 않음, arena 메모리는 ui_close에서 해제) */
+   if (hdr->b_cnt) {
+      ui_grp->b_item  = (b_item_t *)_ui_alloc (&ui_grp->arena, sizeof(b_item_t) * hdr->b_cnt);
+      ui_grp->b_order = (int *)_ui_alloc (&ui_grp->arena, sizeof(int) * hdr->b_cnt);
+      ui_grp->b_dirty = (unsigned char *)_ui_alloc (&ui_grp->arena, hdr->b_cnt);
+      if ((ui_grp->b_item == NULL) || (ui_grp->b_order == NULL) || (ui_grp->b_dirty == NULL))
+         goto out;
+   }
+   if (hdr->b_map_size &&
+      ((ui_grp->b_map = (int *)_ui_alloc (&ui_grp->arena, sizeof(int) * hdr->b_map_size)) == NULL))
+      goto out;
+   if (hdr->i_cnt &&
+      ((ui_grp->i_item = (i_item_t *)_ui_alloc (&ui_grp->arena,
+                                             sizeof(i_item_t) * hdr->i_cnt)) == NULL))
+      goto out;
+
+   fb->is_bgr       = hdr->is_bgr;
+   ui_grp->f_type   = hdr->f_type;     ui_grp->f_smooth = hdr->f_smooth;
+   ui_grp->fc.uint  = hdr->fc;         ui_grp->bc.uint  = hdr->bc;
+   ui_grp->lc.uint  = hdr->lc;
+
+   /* hot table, t_item은 mmap 영역을 그대로 사용 (MAP_PRIVATE, 변경은 process 내부에만 적용) */
+   ui_grp->b_item_max = hdr->b_cnt;
+   ui_grp->b_map_size = hdr->b_map_size;
+   ui_grp->b_id       = (int *)(map + hdr->o_id);
+   ui_grp->b_gid      = (int *)(map + hdr->o_gid);
+   ui_grp->b_rect     = (rect_item_t *)(map + hdr->o_rect);
+   ui_grp->t_item_max = ui_grp->t_item_cnt = hdr->t_cnt;
+   ui_grp->t_item     = (t_item_t *)(map + hdr->o_t);
+   ui_grp->i_item_max = hdr->i_cnt;
+
+   str = map + hdr->o_str;
+   cb  = (const ui_cache_b_t *)(map + hdr->o_b);
+   for (i = 0; i < hdr->b_cnt; i++, cb++) {
+      string_item_t *s = &ui_grp->b_item[i].s;
+
+      ui_grp->b_item[i].s_dfl   = str + cb->s_dfl;
+      ui_grp->b_item[i].s_align = cb->s_align;
+      s->x        = cb->x;          s->y        = cb->y;
+      s->scale    = cb->scale;      s->f_type   = cb->f_type;
+      s->f_smooth = cb->f_smooth;   s->align    = cb->align;
+      s->fc.uint  = cb->fc;         s->bc.uint  = cb->bc;
+      _ui_str_set (ui_grp, s, ui_grp->b_item[i].s_dfl);
+
+      _ui_item_map (ui_grp, i);
+      ui_grp->b_item_cnt++;
+   }
+   ci = (const ui_cache_i_t *)(map + hdr->o_i);
+   for (i = 0; i < hdr->i_cnt; i++, ci++) {
+      ui_grp->i_item[i].ui_id   = ci->ui_id;
+      ui_grp->i_item[i].grp_id  = ci->grp_id;
+      ui_grp->i_item[i].dev_id  = ci->dev_id;
+      ui_grp->i_item[i].is_info = ci->is_info;
+      ui_grp->i_item[i].name    = str + ci->name;
+      ui_grp->i_item_cnt++;
+   }
+   ui_grp->c_map  = map;
+   ui_grp->c_size = st.st_size;
+   return 0;
+
+out:
+   munmap (map, st.st_size);
+   return -1;
+}
+
+//------------------------------------------------------------------------------
+// 파싱이 끝난 ui_grp를 cache 파일로 저장한다. (임시 파일에 쓴 후 rename)
+// 성공시 0, 저장하지 못한 경우(read-only file system 등) -1
+//------------------------------------------------------------------------------
+static int _ui_cache_save (fb_info_t *fb, ui_grp_t *ui_grp, const char *cache_name,
+                            unsigned long long cfg_hash, unsigned int cfg_size)
+{
+   ui_cache_hdr_t c_hdr, *hdr;
+   ui_cache_b_t *cb;
+   ui_cache_i_t *ci;
+   unsigned int str_size = 0, len;
+   char tmp_name[PATH_MAX], *buf, *str;
+   int fd, i, wr, ret = -1;
+
+   for (i = 0; i < ui_grp->b_item_cnt; i++)
+      str_size += strlen (ui_grp->b_item[i].s_dfl) + 1;
+   for (i = 0; i < ui_grp->i_item_cnt; i++)
+      str_size += strlen (ui_grp->i_item[i].name) + 1;
+
+   memset (&c_hdr, 0, sizeof(c_hdr));
+   c_hdr.b_cnt = ui_grp->b_item_cnt;   c_hdr.i_cnt = ui_grp->i_item_cnt;
+   c_hdr.t_cnt = ui_grp->t_item_cnt;
+   _ui_cache_layout (&c_hdr, str_size);
+
+   if ((buf = (char *)calloc (1, c_hdr.size)) == NULL)
+      return -1;
+
+   hdr  = (ui_cache_hdr_t *)buf;
+   *hdr = c_hdr;
+   memcpy (hdr->magic, "FBUI", 4);
+   hdr->version  = UI_CACHE_VERSION;   hdr->sizes = UI_CACHE_SIZES;
+   hdr->cfg_size = cfg_size;           hdr->cfg_hash = cfg_hash;
+   hdr->w = fb->w;   hdr->h = fb->h;   hdr->rotate = fb->rotate;
+   hdr->is_bgr   = fb->is_bgr;
+   hdr->f_type   = ui_grp->f_type;     hdr->f_smooth = ui_grp->f_smooth;
+   hdr->fc = ui_grp->fc.uint;  hdr->bc = ui_grp->bc.uint;  hdr->lc = ui_grp->lc.uint;
+   hdr->b_map_size = ui_grp->b_map_size;
+   hdr->faces    = font_faces_id ();
+
+   memcpy (buf + hdr->o_id,   ui_grp->b_id,   sizeof(int) * hdr->b_cnt);
+   memcpy (buf + hdr->o_gid,  ui_grp->b_gid,  sizeof(int) * hdr->b_cnt);
+   memcpy (buf + hdr->o_rect, ui_grp->b_rect, sizeof(rect_item_t) * hdr->b_cnt);
+   memcpy (buf + hdr->o_t,    ui_grp->t_item, sizeof(t_item_t) * hdr->t_cnt);
+
+   str = buf + hdr->o_str;
+   cb  = (ui_cache_b_t *)(buf + hdr->o_b);
+   for (i = 0; i < hdr->b_cnt; i++, cb++) {
+      string_item_t *s = &ui_grp->b_item[i].s;
+
+      cb->x        = s->x;          cb->y        = s->y;
+      cb->scale    = s->scale;      cb->f_type   = s->f_type;
+      cb->f_smooth = s->f_smooth;   cb->align    = s->align;
+      cb->fc       = s->fc.uint;    cb->bc       = s->bc.uint;
+      cb->s_align  = ui_grp->b_item[i].s_align;
+      cb->s_dfl    = str - (buf + hdr->o_str);
+      len = strlen (ui_grp->b_item[i].s_dfl) + 1;
+      memcpy (str, ui_grp->b_item[i].s_dfl, len);   str += len;
+   }
+   ci = (ui_cache_i_t *)(buf + hdr->o_i);
+   for (i = 0; i < hdr->i_cnt; i++, ci++) {
+      ci->ui_id   = ui_grp->i_item[i].ui_id;
+      ci->grp_id  = ui_grp->i_item[i].grp_id;
+      ci->dev_id  = ui_grp->i_item[i].dev_id;
+      ci->is_info = ui_grp->i_item[i].is_info;
+      ci->name    = str - (buf + hdr->o_str);
+      len = strlen (ui_grp->i_item[i].name) + 1;
+      memcpy (str, ui_grp->i_item[i].name, len);    str += len;
+   }
+
+   snprintf (tmp_name, sizeof(tmp_name), "%s.%d", cache_name, (int)getpid());
+   if ((fd = open (tmp_name, O_WRONLY | O_CREAT | O_TRUNC, 0644)) >= 0) {
+      wr = write (fd, buf, hdr->size);
+      close (fd);
+      if ((wr != (int)hdr->size) || rename (tmp_name, cache_name))
+         unlink (tmp_name);
+      else
+         ret = 0;
+   }
+   free (buf);
+   return ret;
+}
+
+//------------------------------------------------------------------------------
+// cfg 파일을 미리 읽어 item 개수와 최대 id를 구한 후 item 배열과 id map을 할당한다.
+//------------------------------------------------------------------------------
+static int _ui_cfg_alloc (const ui_tok_t *tok, ui_grp_t *ui_grp)
+{
+   ui_tok_t t = *tok;
+   ui_slice_t s;
+   int b_cnt = 0, i_cnt = 0, t_cnt = 0, id, id_max = -1;
+
+   while (_ui_tok_line (&t)) {
+      if (t.line == t.line_end)
+         continue;
+      switch (*t.line) {
+         case  'B':  case  'R':  case  'S':
+            b_cnt++;
+            if (_ui_tok_field (&t, &s) && _ui_tok_field (&t, &s) && !_ui_slice_num (&s, 10, &id))
+               id_max = (id > id_max) ? id : id_max;
+            break;
+         case  'I':  i_cnt++;   break;
+         case  'T':  t_cnt++;   break;
+         default :
+            break;
+      }
+   }
+
+   ui_grp->b_item_max = b_cnt;
+   ui_grp->i_item_max = i_cnt;
+   ui_grp->t_item_max = t_cnt;
+   ui_grp->b_map_size = (id_max < UI_MAP_MAX) ? id_max + 1 : UI_MAP_MAX;
+
+   /* 개수가 0인 배열은 할당하지 않음 (NULL) */
+   if (b_cnt) {
+      /* hot table (id, gid, rect) */
+      ui_grp->b_id    = (int *)_ui_alloc (&ui_grp->arena, sizeof(int) * b_cnt);
+      ui_grp->b_gid   = (int *)_ui_alloc (&ui_grp->arena, sizeof(int) * b_cnt);
+      ui_grp->b_rect  = (rect_item_t *)_ui_alloc (&ui_grp->arena, sizeof(rect_item_t) * b_cnt);
+      ui_grp->b_dirty = (unsigned char *)_ui_alloc (&ui_grp->arena, b_cnt);
+      /* cold table (문자열) */
+      ui_grp->b_item  = (b_item_t *)_ui_alloc (&ui_grp->arena, sizeof(b_item_t) * b_cnt);
+      ui_grp->b_order = (int *)_ui_alloc (&ui_grp->arena, sizeof(int) * b_cnt);
+      if ((ui_grp->b_id == NULL) || (ui_grp->b_gid == NULL) || (ui_grp->b_rect == NULL) ||
+          (ui_grp->b_dirty == NULL) || (ui_grp->b_item == NULL) || (ui_grp->b_order == NULL))
+         return -1;
+   }
+   if (ui_grp->b_map_size) {
+      ui_grp->b_map = (int *)_ui_alloc (&ui_grp->arena, sizeof(int) * ui_grp->b_map_size);
+      if (ui_grp->b_map == NULL)
+         return -1;
+   }
+   if (i_cnt && ((ui_grp->i_item = (i_item_t *)_ui_alloc (&ui_grp->arena,
+                                             sizeof(i_item_t) * i_cnt)) == NULL))
+      return -1;
+   if (t_cnt && ((ui_grp->t_item = (t_item_t *)_ui_alloc (&ui_grp->arena,
+                                             sizeof(t_item_t) * t_cnt)) == NULL))
+      return -1;
+   return 0;
+}
+
+//------------------------------------------------------------------------------
+// cfg 파일의 signature 이후의 항목을 파싱한다. signature가 없으면 0.
+//------------------------------------------------------------------------------
+static int _ui_cfg_parse (ui_tok_t *t, fb_info_t *fb, ui_grp_t *ui_grp)
+{
+   int is_cfg_file = 0;
+
+   while (_ui_tok_line (t)) {
+      ui_slice_t cmd;
+
+      if (!is_cfg_file) {
+         const char *e = t->line_end;
+
+         while ((e > t->line) && ((e[-1] == ' ') || (e[-1] == '\t')))
+            e--;
+         is_cfg_file = ((e - t->line) == (int)strlen ("ODROID-UI-CONFIG")) &&
+                        !memcmp ("ODROID-UI-CONFIG", t->line, e - t->line);
+         continue;
+      }
+      if ((t->line == t->line_end) || (*t->line == '#'))
+         continue;
+
+      /* command field */
+      _ui_tok_field (t, &cmd);
+      switch(*t->line) {
+         case  'C':  _ui_parser_cmd_C (t, fb, ui_grp); break;
+         case  'B':  _ui_parser_cmd_B (t, fb, ui_grp); break;
+         case  'I':  _ui_parser_cmd_I (t, ui_grp);     break;
+         case  'T':  _ui_parser_cmd_T (t, ui_grp);     break;
+         case  'R':  _ui_parser_cmd_R (t, fb, ui_grp); break;
+         case  'S':  _ui_parser_cmd_S (t, ui_grp);     break;
+         default :
+               _ui_tok_error (t, t->line, "Unknown parser command!");
+               break;
+      }
+   }
+   return is_cfg_file;
+}
+
+//------------------------------------------------------------------------------
+// cfg 파일(또는 cache)을 읽어 ui_grp를 만든다. 화면에는 그리지 않는다.
+// errors : 오류로 건너뛴 cfg 줄 수 (NULL 가능)
+// saved  : NULL 이면 cache 파일을 만들지 않는다. 아니면 cache를 만들고 사용 가능한 cache가
+//          있는 경우 1 (ui_cache_save)
+//------------------------------------------------------------------------------
+static ui_grp_t *_ui_load (fb_info_t *fb, const char *cfg_filename, int *errors, int *saved)
+{
+   ui_grp_t *ui_grp;
+   ui_arena_t arena;
+   ui_tok_t t;
+   struct stat st;
+   void *map;
+   int fd;
+   unsigned long long cfg_hash;
+   char cache_name[PATH_MAX];
+
+   if ((fd = open(cfg_filename, O_RDONLY)) < 0) {
+      printf ("%s : %s file not found!\n", __func__, cfg_filename);
+      return   NULL;
+   }
+
+   /* cfg 파일은 mmap 후 복사 없이 읽는다. */
+   map = MAP_FAILED;
+   if (!fstat (fd, &st) && (st.st_size > 0))
+      map = mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close (fd);
+
+   if (map == MAP_FAILED) {
+      fprintf(stdout, "ERROR: UI Config File not found! (filename = %s)\n", cfg_filename);
+      return   NULL;
+   }
+   memset (&t, 0x00, sizeof(t));
+   t.filename = cfg_filename;
+   t.p        = (const char *)map;
+   t.end      = (const char *)map + st.st_size;
+
+   /* ui_grp 및 모든 item, 문자열은 arena에서 할당한다. (ui_close에서 한번에 해제) */
+   memset (&arena, 0x00, sizeof(arena));
+   if ((ui_grp = (ui_grp_t *)_ui_alloc(&arena, sizeof(ui_grp_t))) == NULL) {
+      munmap (map, st.st_size);
+      return   NULL;
+   }
+   ui_grp->arena = arena;
+
+   /* item(main thread), popup(popup thread) 별로 text context를 따로 사용 */
+   text_ctx_init (&ui_grp->text,        -1, -1);
+   text_ctx_init (&ui_grp->p_item.text, -1, -1);
+   pthread_mutex_init (&ui_grp->p_item.lock, NULL);
+
+   /* cfg가 바뀌지 않았으면 cache를 사용하고, 아니면 파싱한다. (요청시 cache를 다시 만듦) */
+   cfg_hash = _ui_cfg_hash ((const char *)map, st.st_size);
+   snprintf (cache_name, sizeof(cache_name), "%s%s", cfg_filename, UI_CACHE_EXT);
+
+   if (_ui_cache_load (fb, ui_grp, cache_name, cfg_hash, st.st_size)) {
+      if (_ui_cfg_alloc (&t, ui_grp)) {
+         fprintf(stdout, "ERROR: UI item alloc fail! (filename = %s)\n", cfg_filename);
+         munmap (map, st.st_size);
+         ui_close (ui_grp);
+         return NULL;
+      }
+      if (!_ui_cfg_parse (&t, fb, ui_grp)) {
+         fprintf(stdout, "ERROR: UI Config File not found! (filename = %s)\n", cfg_filename);
+         munmap (map, st.st_size);
+         ui_close (ui_grp);
+         return NULL;
+      }
+      /* 오류가 있는 cfg는 cache를 만들지 않음 (다음 실행시 오류를 다시 표시) */
+      if (t.errors)
+         fprintf(stdout, "%s : %d error(s), error lines are skipped.\n", cfg_filename, t.errors);
+      else if (saved)
+         *saved = !_ui_cache_save (fb, ui_grp, cache_name, cfg_hash, st.st_size);
+   }
+   else if (saved)
+      *saved = 1;
+   munmap (map, st.st_size);
+
+   _ui_item_order  (ui_grp);
+   _ui_touch_index (fb, ui_grp);
+
+   if (errors)
+      *errors = t.errors;
+   return   ui_grp;
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+ui_grp_t *ui_init (fb_info_t *fb, const char *cfg_filename)
+{
+   ui_grp_t *ui_grp;
+
+   // file parser
+   if ((ui_grp = _ui_load (fb, cfg_filename, NULL, NULL)) == NULL)
+      return   NULL;
+
+   /* all item update */
+   if (ui_grp->b_item_cnt)
+      ui_update (fb, ui_grp, -1);
+   return   ui_grp;
 }
 
 //------------------------------------------------------------------------------
-void ui_close (ui_grp_t *ui_grp)
+// cfg 파일을 파싱하여 cache 파일(<cfg>.cache)을 만든다. ui_init은 cache를 만들지 않는다.
+// 오류 라인이 있는 cfg는 저장하지 않는다. 사용 가능한 cache가 있으면 1
+//------------------------------------------------------------------------------
+int ui_cache_save (fb_info_t *fb, const char *cfg_filename)
 {
-   /* 할당받은 메모리가 있다면 시스템으로 반환한다. */
-   if (ui_grp)
-      free (ui_grp);
+   ui_grp_t *ui_grp;
+   int saved = 0;
+
+   if ((ui_grp = _ui_load (fb, cfg_filename, NULL, &saved)) == NULL)
+      return   0;
+
+   ui_close (ui_grp);
+   return   saved;
 }
 
 //------------------------------------------------------------------------------
+// UI hot reload (inotify)
+// ui_watch_start 이후 cfg 파일이 저장되면 watch thread에서 새 ui_grp로 다시 읽어두고,
+// main thread의 ui_watch_reload에서 이전 cfg(base)와 비교하여 바뀐 항목만 적용 후 다시 그린다.
+// cfg에서 바뀌지 않은 값은 유지되므로 실행중 변경한 문자열/색상은 그대로 남는다.
+// item 구성(id)이 바뀐 경우 item table은 ui_grp arena에 새로 할당한다. (이전 table은 ui_close에서 해제)
 //------------------------------------------------------------------------------
-int ui_set_popup (fb_info_t *fb, ui_grp_t *ui_grp,
-                    int w, int h, int lw,       /* box width, box height, box outline width */
-                    int fc, int bc, int lc,     /* color : font, background, outline */
-                    int fs, int ts, char *fmt, ...); /* font scale, display time(sec), msg format */
+#define  UI_RELOAD_DRAW    0x01
+#define  UI_RELOAD_RECT    0x02
+
+struct ui_watch__t {
+   pthread_t         thread;
+   pthread_mutex_t   lock;
+   int               fd, stop;
+   // 파싱용 fb 정보 (watch thread 전용, draw 하지 않음)
+   fb_info_t         fb;
+   char              filename[PATH_MAX];
+   const char        *name;
+   // base : 화면에 적용된 cfg (main thread), pending : 새로 읽은 cfg (lock)
+   ui_grp_t          *base, *pending;
+   int               is_bgr;
+};
 
 //------------------------------------------------------------------------------
-void *ui_popup_func (void *arg)
+// cfg 파일이 있는 폴더를 감시한다. (편집기는 새 파일로 저장 후 rename 하는 경우가 많음)
+//------------------------------------------------------------------------------
+static void *_ui_watch_func (void *arg)
 {
-   p_item_t *p = (p_item_t *)arg;
+   ui_watch_t *w = (ui_watch_t *)arg;
+   struct pollfd pfd = { .fd = w->fd, .events = POLLIN };
+   char buf[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+   struct inotify_event *ev;
+   ui_grp_t *ui_grp;
+   fb_info_t fb;
+   int len, changed, errors;
+   char *p;
 
-   while (p->timeout) {
-      _ui_update_r ((fb_info_t *)p->vp_fb, &p->r);
-      _ui_update_s ((fb_info_t *)p->vp_fb, &p->s, p->r.x, p->r.y);
-      usleep (500 * 1000);
-      _ui_update_r ((fb_info_t *)p->vp_fb, &p->r);
-      usleep (500 * 1000);
+   while (!w->stop) {
+      if (poll (&pfd, 1, 200) <= 0)
+         continue;
 
-      if (p->timeout)   p->timeout--;
+      for (changed = 0; (len = read (w->fd, buf, sizeof(buf))) > 0; ) {
+         for (p = buf; p < buf + len; p += sizeof(struct inotify_event) + ev->len) {
+            ev = (struct inotify_event *)p;
+            if (ev->len && !strcmp (ev->name, w->name))
+               changed = 1;
+         }
+         /* 여러번 나누어 저장하는 경우를 위해 잠시 기다린 후 남은 event를 모두 읽는다. */
+         if (changed)
+            usleep (100 * 1000);
+      }
+      if (!changed || w->stop)
+         continue;
+
+      fb = w->fb;
+      if ((ui_grp = _ui_load (&fb, w->filename, &errors, NULL)) == NULL)
+         continue;
+
+      /* 편집중 오류가 있는 cfg는 적용하지 않음 (오류 줄의 item이 사라지지 않도록) */
+      if (errors) {
+         fprintf(stdout, "%s : hot reload skipped.\n", w->filename);
+         ui_close (ui_grp);
+         continue;
+      }
+      pthread_mutex_lock (&w->lock);
+      if (w->pending)
+         ui_close (w->pending);
+      w->pending = ui_grp;
+      w->is_bgr  = fb.is_bgr;
+      pthread_mutex_unlock (&w->lock);
    }
    return arg;
 }
 
 //------------------------------------------------------------------------------
-int ui_set_popup (fb_info_t *fb, ui_grp_t *ui_grp,
-                    int w, int h, int lw,       /* width, height, line width */
-                    int fc, int bc, int lc,     /* color : font, background, line */
-                    int fs, int ts, char *fmt, ...)  /* font scale, display time(sec), msg format */
+// 이전 cfg(o_r, o_item)와 새 cfg(n_r, n_item)를 비교하여 바뀐 값만 현재 item(r, pitem)에 적용한다.
+// 기본 문자열은 현재 기본 문자열을 표시중인 경우만 변경한다. (ui_set_printf 등으로 설정된 문자열 유지)
+//------------------------------------------------------------------------------
+static int _ui_reload_item (ui_grp_t *ui_grp, rect_item_t *r, b_item_t *pitem,
+                              const rect_item_t *o_r, const b_item_t *o_item,
+                              const rect_item_t *n_r, const b_item_t *n_item)
 {
-    va_list va;
-    char buf[ITEM_STR_MAX];
-    p_item_t *p = &ui_grp->p_item;
-    pthread_t ui_popup_thread;
+   const string_item_t *o_s = &o_item->s, *n_s = &n_item->s;
+   string_item_t *s = &pitem->s;
+   int changed = 0;
+
+   if ((o_r->x != n_r->x) || (o_r->y != n_r->y) || (o_r->w != n_r->w) ||
+       (o_r->h != n_r->h) || (o_r->lw != n_r->lw)) {
+      r->x = n_r->x;    r->y = n_r->y;    r->w = n_r->w;    r->h = n_r->h;
+      r->lw = n_r->lw;
+      changed |= UI_RELOAD_RECT | UI_RELOAD_DRAW;
+   }
+   if (o_r->bc.uint != n_r->bc.uint)   {  r->bc = n_r->bc;  changed |= UI_RELOAD_DRAW;  }
+   if (o_r->lc.uint != n_r->lc.uint)   {  r->lc = n_r->lc;  changed |= UI_RELOAD_DRAW;  }
+   if (o_s->fc.uint != n_s->fc.uint)   {  s->fc = n_s->fc;  changed |= UI_RELOAD_DRAW;  }
+   if (o_s->bc.uint != n_s->bc.uint)   {  s->bc = n_s->bc;  changed |= UI_RELOAD_DRAW;  }
+   if (o_s->f_smooth != n_s->f_smooth) {
+      s->f_smooth = n_s->f_smooth;
+      changed |= UI_RELOAD_DRAW;
+   }
+   if (o_s->scale != n_s->scale) {
+      s->scale = n_s->scale;
+      changed |= UI_RELOAD_DRAW;
+   }
+   if (o_item->s_align != n_item->s_align) {
+      pitem->s_align = n_item->s_align;
+      s->align       = n_item->s_align;
+      s->l_valid     = 0;
+      changed |= UI_RELOAD_DRAW;
+   }
+   if (strcmp (o_item->s_dfl, n_item->s_dfl)) {
+      if (!strcmp (s->str, pitem->s_dfl))
+         _ui_str_set (ui_grp, s, n_item->s_dfl);
+      pitem->s_dfl = _ui_intern (&ui_grp->arena, n_item->s_dfl, strlen (n_item->s_dfl));
+      changed |= UI_RELOAD_DRAW;
+   }
+   if (changed) {
+      /* auto scale(-1)은 새 rect 크기로 다시 계산, 문자열 위치는 정렬에 따라 다시 계산 */
+      if (n_s->scale < 0)
+         s->scale = n_s->scale;
+      s->x = -1;  s->y = -1;
+   }
+   return changed;
+}
 
-    /* thread busy */
-    if (p->timeout)     return 0;
+//------------------------------------------------------------------------------
+// 새 cfg에만 있는 item을 현재 ui_grp의 item(pitem)으로 복사한다. (문자열은 ui_grp arena)
+//------------------------------------------------------------------------------
+static void _ui_reload_new (ui_grp_t *ui_grp, b_item_t *pitem, const b_item_t *n_item)
+{
+   const string_item_t *n_s = &n_item->s;
+   string_item_t *s = &pitem->s;
+
+   memset (pitem, 0x00, sizeof(b_item_t));
+   pitem->s_align = n_item->s_align;
+   pitem->s_dfl   = _ui_intern (&ui_grp->arena, n_item->s_dfl, strlen (n_item->s_dfl));
+
+   s->scale    = n_s->scale;     s->align = n_s->align;
+   s->f_type   = n_s->f_type;    s->f_smooth = n_s->f_smooth;
+   s->fc       = n_s->fc;        s->bc    = n_s->bc;
+   s->x = -1;  s->y = -1;
+   _ui_str_set (ui_grp, s, pitem->s_dfl);
+}
 
-    // popup message display time setting
-    p->timeout = ts;
+//------------------------------------------------------------------------------
+// 같은 id의 item 중 아직 사용하지 않은 item 위치 (없으면 -1)
+//------------------------------------------------------------------------------
+static int _ui_reload_find (ui_grp_t *ui_grp, int id, const char *used)
+{
+   int i;
 
-    if ((w < fb->w) && (w > 0)) {   p->r.w = w;     p->r.x = (fb->w - w) / 2;   }
-    else                        {   p->r.w = fb->w; p->r.x = 0;                 }
+   for (i = 0; i < ui_grp->b_item_cnt; i++)
+      if ((ui_grp->b_id[i] == id) && !used[i])
+         return i;
+   return -1;
+}
 
-    if ((h < fb->h) && (h > 0)) {   p->r.h = h;     p->r.y = (fb->h - h) / 2;   }
-    else                        {   p->r.h = fb->h; p->r.y = 0;                 }
+//------------------------------------------------------------------------------
+// item이 화면에 그려진 영역 (rect 밖으로 그려진 한 줄 문자열 포함). rect 밖으로 그려진 경우 1.
+//------------------------------------------------------------------------------
+static int _ui_item_area (const rect_item_t *r, const string_item_t *s, rect_item_t *a)
+{
+   int x2 = r->x + r->w, y2 = r->y + r->h, s_x2, s_y2;
+
+   *a = *r;
+   if (!s->d_valid || s->d_layout)
+      return 0;
+
+   s_x2 = s->d_x + s->d_cells * font_cell_w (s->d_scale);
+   s_y2 = s->d_y + font_cell_h (s->d_scale);
+   if ((s->d_x >= r->x) && (s->d_y >= r->y) && (s_x2 <= x2) && (s_y2 <= y2))
+      return 0;
+
+   if (s->d_x < a->x)   a->x = s->d_x;
+   if (s->d_y < a->y)   a->y = s->d_y;
+   if (s_x2 > x2)       x2 = s_x2;
+   if (s_y2 > y2)       y2 = s_y2;
+   a->w = x2 - a->x;    a->h = y2 - a->y;
+   return 1;
+}
 
-    p->r.lw = lw < 0 ? 0 : lw;
+//------------------------------------------------------------------------------
+static int _ui_rect_overlap (const rect_item_t *r, const rect_item_t *d, int d_cnt)
+{
+   int i;
 
-    p->s.fc.uint = fc < 0 ? ui_grp->fc.uint : (unsigned int)fc;
-    p->r.lc.uint = lc < 0 ? ui_grp->lc.uint : (unsigned int)lc;
-    p->s.bc.uint = p->r.bc.uint = bc < 0 ? ui_grp->bc.uint : (unsigned int)bc;
+   for (i = 0; i < d_cnt; i++, d++)
+      if ((r->x < d->x + d->w) && (d->x < r->x + r->w) &&
+          (r->y < d->y + d->h) && (d->y < r->y + r->h))
+         return 1;
+   return 0;
+}
 
-    /* 받아온 가변인자를 string 형태로 변환 하여 buf에 저장 */
-    memset (buf, 0x00, sizeof(buf));
-    va_start(va, fmt);  vsprintf(buf, fmt, va); va_end(va);
+//------------------------------------------------------------------------------
+// t_item, i_item은 cfg 값만 가지므로 바뀐 경우 새 cfg의 table로 바꾼다.
+// i_item의 실행 상태(complete, status)는 같은 id의 item에서 가져온다.
+//------------------------------------------------------------------------------
+static int _ui_reload_ti (ui_grp_t *ui_grp, ui_grp_t *n_grp)
+{
+   t_item_t *t_item = ui_grp->t_item;
+   i_item_t *i_item = ui_grp->i_item, *n_i;
+   int i, j, changed = 0;
+
+   if ((ui_grp->t_item_cnt != n_grp->t_item_cnt) ||
+       memcmp (ui_grp->t_item, n_grp->t_item, n_grp->t_item_cnt * sizeof(t_item_t))) {
+      if ((n_grp->t_item_cnt > ui_grp->t_item_max) &&
+          ((t_item = (t_item_t *)_ui_alloc (&ui_grp->arena,
+                                    n_grp->t_item_cnt * sizeof(t_item_t))) == NULL))
+         return 0;
+      memcpy (t_item, n_grp->t_item, n_grp->t_item_cnt * sizeof(t_item_t));
+      if (t_item != ui_grp->t_item)
+         ui_grp->t_item_max = n_grp->t_item_cnt;
+      ui_grp->t_item     = t_item;
+      ui_grp->t_item_cnt = n_grp->t_item_cnt;
+      changed = 1;
+   }
 
-    /* 새로운 string 복사 */
-    p->s.len = _my_strlen(buf);
-    memset (p->s.str, 0, sizeof(p->s.str));
-    strncpy(p->s.str, buf, p->s.len);
+   for (i = 0; i < n_grp->i_item_cnt; i++) {
+      n_i = &n_grp->i_item[i];
+      if ((i >= ui_grp->i_item_cnt) || (ui_grp->i_item[i].ui_id != n_i->ui_id) ||
+          (ui_grp->i_item[i].grp_id != n_i->grp_id) || (ui_grp->i_item[i].dev_id != n_i->dev_id) ||
+          (ui_grp->i_item[i].is_info != n_i->is_info) || strcmp (ui_grp->i_item[i].name, n_i->name))
+         break;
+   }
+   if ((i == n_grp->i_item_cnt) && (i == ui_grp->i_item_cnt))
+      return changed;
+
+   if ((i_item = (i_item_t *)_ui_alloc (&ui_grp->arena,
+                              (n_grp->i_item_cnt + 1) * sizeof(i_item_t))) == NULL)
+      return changed;
+
+   for (i = 0; i < n_grp->i_item_cnt; i++) {
+      n_i = &n_grp->i_item[i];
+      i_item[i]      = *n_i;
+      i_item[i].name = _ui_intern (&ui_grp->arena, n_i->name, strlen (n_i->name));
+      for (j = 0; j < ui_grp->i_item_cnt; j++) {
+         if ((ui_grp->i_item[j].ui_id  == n_i->ui_id) &&
+             (ui_grp->i_item[j].grp_id == n_i->grp_id) &&
+             (ui_grp->i_item[j].dev_id == n_i->dev_id)) {
+            i_item[i].complete = ui_grp->i_item[j].complete;
+            i_item[i].status   = ui_grp->i_item[j].status;
+            break;
+         }
+      }
+   }
+   ui_grp->i_item     = i_item;
+   ui_grp->i_item_cnt = ui_grp->i_item_max = n_grp->i_item_cnt;
+   return 1;
+}
 
-    p->s.scale = fs < 0 ?
-        _ui_str_scale (p->r.w, p->r.h, p->r.lw, p->s.len) : fs;
+//------------------------------------------------------------------------------
+// o_grp(이전 cfg)와 n_grp(새 cfg)를 비교하여 ui_grp에 적용하고 바뀐 영역을 다시 그린다.
+// 반환값 : 다시 그린 item 수
+//------------------------------------------------------------------------------
+static int _ui_reload (fb_info_t *fb, ui_grp_t *ui_grp, ui_grp_t *o_grp, ui_grp_t *n_grp,
+                        int is_bgr)
+{
+   int n_cnt = n_grp->b_item_cnt, cnt = ui_grp->b_item_cnt;
+   int q, p, op, i, id, full = 0, moved = 0, d_cnt = 0, redraw = 0;
+   int *pos, *flag;
+   char *used;
+   rect_item_t *dmg, r, a;
+
+   pos  = (int *)malloc ((n_cnt + 1) * sizeof(int) * 2);
+   used = (char *)calloc (cnt + 1, 1);
+   dmg  = (rect_item_t *)malloc ((n_cnt + cnt + 1) * sizeof(rect_item_t));
+   if ((pos == NULL) || (used == NULL) || (dmg == NULL)) {
+      fprintf(stdout, "%s : malloc error!\n", __func__);
+      free (pos);    free (used);   free (dmg);
+      return 0;
+   }
+   flag = pos + n_cnt + 1;
+
+   /* 기본 설정(C)이 바뀌면 모든 item을 다시 그린다. */
+   if (fb->is_bgr != is_bgr)  {  fb->is_bgr = is_bgr;  full = 1;  }
+   if (o_grp->f_type != n_grp->f_type)    {  ui_grp->f_type = n_grp->f_type;  full = 1;  }
+   if (o_grp->f_smooth != n_grp->f_smooth)   ui_grp->f_smooth = n_grp->f_smooth;
+   ui_grp->fc = n_grp->fc;    ui_grp->bc = n_grp->bc;    ui_grp->lc = n_grp->lc;
+
+   /* 새 cfg의 item 별로 현재 item 위치(pos)를 찾는다. */
+   for (q = 0; q < n_cnt; q++) {
+      id = n_grp->b_id[q];
+      p  = ((q < cnt) && (ui_grp->b_id[q] == id) && !used[q]) ?
+            q : _ui_reload_find (ui_grp, id, used);
+      if (p >= 0)
+         used[p] = 1;
+      pos[q] = p;
+      moved |= (p != q);
+   }
+   moved |= (n_cnt != cnt);
+
+   if (!moved) {
+      /* item 구성이 같으면 현재 table에 바로 적용 */
+      for (q = 0; q < n_cnt; q++) {
+         op = ((q < o_grp->b_item_cnt) && (o_grp->b_id[q] == n_grp->b_id[q])) ?
+               q : _ui_find_item (o_grp, n_grp->b_id[q]);
+         r  = ui_grp->b_rect[q];
+         flag[q] = (op < 0) ? 0 :
+                     _ui_reload_item (ui_grp, &ui_grp->b_rect[q], &ui_grp->b_item[q],
+                                       &o_grp->b_rect[op], &o_grp->b_item[op],
+                                       &n_grp->b_rect[q],  &n_grp->b_item[q]);
+         /* 이동한 item 또는 문자열이 rect 밖으로 그려진 item은 이전 영역을 지운다. */
+         if ((_ui_item_area (&r, &ui_grp->b_item[q].s, &a) && flag[q]) ||
+             (flag[q] & UI_RELOAD_RECT))
+            dmg[d_cnt++] = a;
+         ui_grp->b_gid[q] = n_grp->b_gid[q];
+      }
+   } else {
+      /* item이 추가/삭제된 경우 새 table을 만든다. */
+      int *b_id, *b_gid, *b_map, *b_order;
+      unsigned char *b_dirty;
+      rect_item_t *b_rect;
+      b_item_t *b_item;
+
+      b_id    = (int *)_ui_alloc (&ui_grp->arena, (n_cnt + 1) * sizeof(int));
+      b_gid   = (int *)_ui_alloc (&ui_grp->arena, (n_cnt + 1) * sizeof(int));
+      b_order = (int *)_ui_alloc (&ui_grp->arena, (n_cnt + 1) * sizeof(int));
+      b_map   = (int *)_ui_alloc (&ui_grp->arena, (n_grp->b_map_size + 1) * sizeof(int));
+      b_rect  = (rect_item_t *)_ui_alloc (&ui_grp->arena, (n_cnt + 1) * sizeof(rect_item_t));
+      b_item  = (b_item_t *)_ui_alloc (&ui_grp->arena, (n_cnt + 1) * sizeof(b_item_t));
+      b_dirty = (unsigned char *)_ui_alloc (&ui_grp->arena, n_cnt + 1);
+      if (!b_id || !b_gid || !b_order || !b_map || !b_rect || !b_item || !b_dirty) {
+         free (pos);    free (used);   free (dmg);
+         return 0;
+      }
+      for (q = 0; q < n_cnt; q++) {
+         b_id[q]  = n_grp->b_id[q];
+         b_gid[q] = n_grp->b_gid[q];
+         if ((p = pos[q]) < 0) {
+            b_rect[q] = n_grp->b_rect[q];
+            _ui_reload_new (ui_grp, &b_item[q], &n_grp->b_item[q]);
+            flag[q] = UI_RELOAD_DRAW;
+            continue;
+         }
+         b_rect[q]  = ui_grp->b_rect[p];
+         b_item[q]  = ui_grp->b_item[p];
+         b_dirty[q] = ui_grp->b_dirty[p];
+         op = _ui_find_item (o_grp, b_id[q]);
+         flag[q] = (op < 0) ? 0 :
+                     _ui_reload_item (ui_grp, &b_rect[q], &b_item[q],
+                                       &o_grp->b_rect[op], &o_grp->b_item[op],
+                                       &n_grp->b_rect[q],  &n_grp->b_item[q]);
+         if ((_ui_item_area (&ui_grp->b_rect[p], &ui_grp->b_item[p].s, &a) && flag[q]) ||
+             (flag[q] & UI_RELOAD_RECT))
+            dmg[d_cnt++] = a;
+      }
+      /* 삭제된 item */
+      for (p = 0; p < cnt; p++) {
+         if (!used[p]) {
+            sprite_free (ui_grp->b_item[p].s.sprite);
+            _ui_item_area (&ui_grp->b_rect[p], &ui_grp->b_item[p].s, &dmg[d_cnt++]);
+         }
+      }
+      ui_grp->b_id   = b_id;     ui_grp->b_gid  = b_gid;    ui_grp->b_rect = b_rect;
+      ui_grp->b_item = b_item;   ui_grp->b_map  = b_map;    ui_grp->b_order = b_order;
+      ui_grp->b_dirty = b_dirty;
+      ui_grp->b_map_size = n_grp->b_map_size;
+      ui_grp->b_item_cnt = ui_grp->b_item_max = n_cnt;
+      for (q = 0; q < n_cnt; q++)
+         _ui_item_map (ui_grp, q);
+      _ui_item_order (ui_grp);
+   }
 
-    p->s.x = -1;    p->s.y = -1;
-    _ui_str_pos_xy(&p->r, &p->s);
+   if (_ui_reload_ti (ui_grp, n_grp) || moved)
+      _ui_touch_index (fb, ui_grp);
 
-    p->vp_fb = (void *)fb;
+   /* 이동/삭제된 item의 이전 영역은 C 항목의 배경색으로 지운다. (render thread 사용시 요청) */
+   for (i = 0; i < d_cnt; i++) {
+      if (ui_grp->render)
+         _ui_render_fill (ui_grp, &dmg[i]);
+      else
+         draw_fill_rect (fb, dmg[i].x, dmg[i].y, dmg[i].w, dmg[i].h, ui_grp->bc.uint);
+   }
 
-    return pthread_create(&ui_popup_thread, NULL, ui_popup_func, p) ? 0 : 1;
+   /*
+      ui_update(-1)과 같은 순서로 바뀐 item을 다시 그린다.
+      다시 그린 영역과 겹치는 item도 다시 그려야 위에 있는 item이 가려지지 않는다.
+   */
+   for (i = 0; i < ui_grp->b_order_cnt; i++) {
+      q = ui_grp->b_order[i];
+      if (!full && !flag[q] && !_ui_rect_overlap (&ui_grp->b_rect[q], dmg, d_cnt))
+         continue;
+      ui_grp->b_item[q].s.d_valid = 0;
+      if (ui_grp->render) {
+         /* render thread가 그릴 문자열 영역을 미리 기록하여 겹치는 item을 찾는다. */
+         _ui_item_prep (ui_grp, q);
+         _ui_drawn_s (&ui_grp->b_item[q].s, ui_grp->b_rect[q].x + ui_grp->b_item[q].s.x,
+                     ui_grp->b_rect[q].y + ui_grp->b_item[q].s.y, ui_grp->b_item[q].s.bc.uint);
+         _ui_mark (fb, ui_grp, q, UI_DIRTY_RECT);
+      }
+      else
+         _ui_update (fb, ui_grp, q);
+      _ui_item_area (&ui_grp->b_rect[q], &ui_grp->b_item[q].s, &dmg[d_cnt++]);
+      redraw++;
+   }
+   free (pos);    free (used);   free (dmg);
+   return redraw;
 }
 
 //------------------------------------------------------------------------------
+// cfg 파일 감시를 시작한다. (성공시 1)
+// 변경된 cfg는 ui_watch_reload를 호출하는 thread(main loop)에서 화면에 적용된다.
 //------------------------------------------------------------------------------
-ui_grp_t *ui_init (fb_info_t *fb, const char *cfg_filename)
+int ui_watch_start (fb_info_t *fb, ui_grp_t *ui_grp, const char *cfg_filename)
 {
-   ui_grp_t *ui_grp;
-   FILE *pfd;
-   char buf[256], is_cfg_file = 0;
+   ui_watch_t *w;
+   char dir[PATH_MAX], *p;
+
+   if (ui_grp->watch)
+      return 1;
+
+   if ((w = (ui_watch_t *)calloc (1, sizeof(ui_watch_t))) == NULL)
+      return 0;
+
+   w->fb = *fb;
+   text_ctx_init (&w->fb.text, -1, -1);
+   snprintf (w->filename, sizeof(w->filename), "%s", cfg_filename);
+   snprintf (dir, sizeof(dir), "%s", cfg_filename);
+   if ((p = strrchr (dir, '/')) != NULL) {
+      *p = 0;
+      w->name = w->filename + (p - dir) + 1;
+      if (p == dir)
+         strcpy (dir, "/");
+   } else {
+      strcpy (dir, ".");
+      w->name = w->filename;
+   }
 
-   if ((pfd = fopen(cfg_filename, "r")) == NULL) {
-      printf ("%s : %s file not found!\n", __func__, cfg_filename);
-      return   NULL;
+   /* 비교 기준이 되는 현재 cfg */
+   if ((w->base = _ui_load (&w->fb, w->filename, NULL, NULL)) == NULL) {
+      free (w);
+      return 0;
+   }
+   if (((w->fd = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC)) < 0) ||
+       (inotify_add_watch (w->fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0)) {
+      fprintf(stdout, "%s : inotify error! (%s)\n", __func__, dir);
+      goto err;
+   }
+   pthread_mutex_init (&w->lock, NULL);
+   if (pthread_create (&w->thread, NULL, _ui_watch_func, w)) {
+      pthread_mutex_destroy (&w->lock);
+      goto err;
    }
+   ui_grp->watch = w;
+   return 1;
+err:
+   if (w->fd >= 0)
+      close (w->fd);
+   ui_close (w->base);
+   free (w);
+   return 0;
+}
 
-   if ((ui_grp = (ui_grp_t *)malloc(sizeof(ui_grp_t))) == NULL)
-      return   NULL;
+//------------------------------------------------------------------------------
+// 새로 읽은 cfg가 있으면 화면에 적용한다. 반환값 : 다시 그린 item 수 (적용할 cfg가 없으면 -1)
+// popup 표시중에는 적용하지 않는다. (다음 호출시 적용)
+//------------------------------------------------------------------------------
+int ui_watch_reload (fb_info_t *fb, ui_grp_t *ui_grp)
+{
+   ui_watch_t *w = ui_grp->watch;
+   ui_grp_t *n_grp;
+   int is_bgr, ret;
+
+   if ((w == NULL) || _ui_popup_on (ui_grp))
+      return -1;
+
+   pthread_mutex_lock (&w->lock);
+   n_grp      = w->pending;
+   is_bgr     = w->is_bgr;
+   w->pending = NULL;
+   pthread_mutex_unlock (&w->lock);
+
+   if (n_grp == NULL)
+      return -1;
+
+   _ui_lock (ui_grp);
+   ret = _ui_reload (fb, ui_grp, w->base, n_grp, is_bgr);
+   _ui_unlock (ui_grp);
+   ui_close (w->base);
+   w->base = n_grp;
+   return ret;
+}
+
+//------------------------------------------------------------------------------
+void ui_watch_stop (ui_grp_t *ui_grp)
+{
+   ui_watch_t *w = ui_grp->watch;
 
-   memset (ui_grp, 0x00, sizeof(ui_grp_t));
-   memset (buf,    0x00, sizeof(buf));
+   if (w == NULL)
+      return;
 
-   while(fgets(buf, sizeof(buf), pfd) != NULL) {
-      if (!is_cfg_file) {
-         is_cfg_file = strncmp ("ODROID-UI-CONFIG", buf, strlen(buf)-1) == 0 ? 1 : 0;
-         memset (buf, 0x00, sizeof(buf));
+   w->stop = 1;
+   pthread_join (w->thread, NULL);
+   pthread_mutex_destroy (&w->lock);
+   close (w->fd);
+
+   if (w->pending)
+      ui_close (w->pending);
+   ui_close (w->base);
+   free (w);
+   ui_grp->watch = NULL;
+}
+
+//------------------------------------------------------------------------------
+// Render thread (ui_render_start)
+// render thread가 framebuffer를 전담한다. ui_set_xxx, ui_update 함수(main thread)는 lock을 잡고
+// item을 dirty로 표시만 하며, render thread는 dirty item을 사본(r, s)으로 복사한 후 lock 없이 그린다.
+// 최대 fps 만큼만 그리므로 한 frame 사이에 여러번 바뀐 item은 마지막 상태를 한번만 그린다.
+// 마지막 frame 이후 1/fps가 지났으면 바로 그리며, 한 frame에 UI_RENDER_ITEMS 개 까지만 그린다.
+//------------------------------------------------------------------------------
+struct ui_render__t {
+   pthread_t         thread;
+   pthread_mutex_t   lock;
+   pthread_cond_t    cond;
+   // stop : 1 = 종료, 2 = 남은 dirty item을 그린 후 종료. deferred : 시작 전 지연 모드
+   int               stop, fps, deferred;
+   fb_info_t         *fb;
+   // render thread 전용 text context
+   fb_text_t         text;
+   // item 사본 (render thread). b_item, cnt : 사본을 만든 model table (바뀌면 다시 만듦)
+   b_item_t          *b_item;
+   int               cnt;
+   int               *id;
+   rect_item_t       *r;
+   string_item_t     *s;
+   unsigned char     *dirty;
+   // 이번 frame에 그릴 item 위치 (b_order 순서)
+   int               *list, l_cnt;
+   // 지울 영역 요청 (hot reload, lock) / 이번 frame에 지울 영역
+   rect_item_t       *fill, *d_fill;
+   int               fill_cnt, fill_max, d_cnt, d_max;
+   // popup 표시/지우기 요청 (UI_RENDER_POPUP_x 순서대로, lock) / 이번 frame 요청
+   int               popup[UI_RENDER_POPUP_Q], p_cnt;
+   int               d_popup[UI_RENDER_POPUP_Q], d_p_cnt;
+   // popup 표시중 (첫 표시 요청부터 종료 요청까지, lock). dirty item을 그리지 않는다.
+   int               p_active;
+   // popup item 사본 (표시 요청을 가져올 때 복사)
+   rect_item_t       p_r;
+   string_item_t     p_s;
+   // 그린 frame 수, item 수
+   unsigned long     frames, items;
+};
+
+//------------------------------------------------------------------------------
+// render thread 사용시 model(ui_grp)을 변경하는 동안 lock을 잡는다.
+//------------------------------------------------------------------------------
+static void _ui_lock (ui_grp_t *ui_grp)
+{
+   if (ui_grp->render)
+      pthread_mutex_lock (&ui_grp->render->lock);
+}
+
+//------------------------------------------------------------------------------
+static void _ui_unlock (ui_grp_t *ui_grp)
+{
+   if (ui_grp->render)
+      pthread_mutex_unlock (&ui_grp->render->lock);
+}
+
+//------------------------------------------------------------------------------
+static void _ui_render_kick (ui_grp_t *ui_grp)
+{
+   if (ui_grp->render)
+      pthread_cond_signal (&ui_grp->render->cond);
+}
+
+//------------------------------------------------------------------------------
+// hot reload로 이동/삭제된 item의 이전 영역을 C 항목의 배경색으로 지우도록 요청한다. (lock)
+//------------------------------------------------------------------------------
+static void _ui_render_fill (ui_grp_t *ui_grp, const rect_item_t *r)
+{
+   ui_render_t *rt = ui_grp->render;
+
+   if (rt->fill_cnt == rt->fill_max) {
+      int max = rt->fill_max ? rt->fill_max * 2 : 16;
+      rect_item_t *fill = (rect_item_t *)realloc (rt->fill, max * sizeof(rect_item_t));
+
+      if (fill == NULL) {
+         fprintf(stdout, "%s : malloc error!\n", __func__);
+         return;
+      }
+      rt->fill = fill;  rt->fill_max = max;
+   }
+   rt->fill[rt->fill_cnt]      = *r;
+   rt->fill[rt->fill_cnt++].bc = ui_grp->bc;
+   _ui_render_kick (ui_grp);
+}
+
+//------------------------------------------------------------------------------
+// popup thread의 표시/지우기 요청. req = 0 이면 popup 종료, 표시중 미뤄진 dirty item을 그린다.
+// 요청은 순서대로 그리며 queue가 가득 찬 경우 마지막 요청을 바꾼다. (마지막 상태는 유지)
+//------------------------------------------------------------------------------
+static void _ui_render_popup (ui_grp_t *ui_grp, int req)
+{
+   ui_render_t *rt = ui_grp->render;
+
+   if (rt == NULL)
+      return;
+
+   pthread_mutex_lock (&rt->lock);
+   if (req) {
+      if (rt->p_cnt == UI_RENDER_POPUP_Q)
+         rt->p_cnt--;
+      rt->popup[rt->p_cnt++] = req;
+      if (req == UI_RENDER_POPUP_SHOW)
+         rt->p_active = 1;
+   } else
+      rt->p_active = 0;
+   pthread_cond_signal (&rt->cond);
+   pthread_mutex_unlock (&rt->lock);
+}
+
+//------------------------------------------------------------------------------
+// model 문자열 설정(m)을 사본(c)에 복사한다. 사본의 그리기 상태(d_str, sprite 등)는 유지.
+//------------------------------------------------------------------------------
+static int _ui_render_str (string_item_t *c, const string_item_t *m)
+{
+   int size = 16;
+   char *buf;
+
+   if (m->len >= c->size) {
+      while (size <= m->len)
+         size <<= 1;
+      if ((buf = (char *)malloc (size * 2)) == NULL)
+         return -1;
+
+      if (c->size)
+         memcpy (buf + size, c->d_str, c->size);
+      else
+         buf[size] = 0;
+      free (c->str);
+      c->str = buf;     c->d_str = buf + size;     c->size = size;
+   }
+   memcpy (c->str, m->str, m->len + 1);
+   c->len      = m->len;
+   c->x        = m->x;           c->y        = m->y;
+   c->scale    = m->scale;       c->f_type   = m->f_type;
+   c->f_smooth = m->f_smooth;    c->align    = m->align;
+   c->f_sprite = m->f_sprite;
+   c->fc       = m->fc;          c->bc       = m->bc;
+   /* 크기 cache는 같은 문자열이므로 그대로 사용 */
+   c->m_cells  = m->m_cells;     c->m_scale  = m->m_scale;
+   c->m_w      = m->m_w;         c->m_h      = m->m_h;     c->m_nl = m->m_nl;
+   c->l_valid  = 0;
+   return 0;
+}
+
+//------------------------------------------------------------------------------
+static void _ui_render_clear (string_item_t *s, int cnt)
+{
+   int i;
+
+   for (i = 0; i < cnt; i++) {
+      free (s[i].str);
+      sprite_free (s[i].sprite);
+   }
+}
+
+//------------------------------------------------------------------------------
+// model table로 item 사본을 만든다. (lock)
+// keep = 1 : model의 그리기 상태(d_str, sprite 등)를 가져온다. (ui_render_start)
+// keep = 0 : hot reload로 table이 바뀐 경우. 같은 id의 이전 사본의 그리기 상태를 사용한다.
+//------------------------------------------------------------------------------
+static int _ui_render_build (ui_grp_t *ui_grp, ui_render_t *rt, int keep)
+{
+   int cnt = ui_grp->b_item_cnt, q, o, n;
+   string_item_t *s, *m;
+   unsigned char *dirty;
+   rect_item_t *r;
+   int *id;
+
+   id    = (int *)malloc ((cnt + 1) * sizeof(int) * 2);
+   r     = (rect_item_t *)malloc ((cnt + 1) * sizeof(rect_item_t));
+   s     = (string_item_t *)calloc (cnt + 1, sizeof(string_item_t));
+   dirty = (unsigned char *)calloc (cnt + 1, 1);
+   if ((id == NULL) || (r == NULL) || (s == NULL) || (dirty == NULL)) {
+      fprintf(stdout, "%s : malloc error!\n", __func__);
+      free (id);  free (r);   free (s);   free (dirty);
+      return -1;
+   }
+
+   for (q = 0; q < cnt; q++) {
+      id[q] = ui_grp->b_id[q];
+      m     = &ui_grp->b_item[q].s;
+      if (keep) {
+         s[q] = *m;
+         s[q].str = s[q].d_str = NULL;    s[q].size = 0;
+         m->sprite = NULL;
+      } else {
+         /* 가져간 이전 사본은 str = NULL */
+         o = ((q < rt->cnt) && (rt->id[q] == id[q]) && rt->s[q].str) ? q : -1;
+         for (n = 0; (o < 0) && (n < rt->cnt); n++)
+            if ((rt->id[n] == id[q]) && rt->s[n].str)
+               o = n;
+         if (o >= 0) {
+            s[q] = rt->s[o];
+            rt->s[o].str = NULL;    rt->s[o].sprite = NULL;
+         }
+      }
+      if (_ui_render_str (&s[q], m)) {
+         fprintf(stdout, "%s : malloc error!\n", __func__);
+         _ui_render_clear (s, q + 1);
+         free (id);  free (r);   free (s);   free (dirty);
+         return -1;
+      }
+      if (keep) {
+         if (m->size && (strlen (m->d_str) < (size_t)s[q].size))
+            strcpy (s[q].d_str, m->d_str);
+         else
+            s[q].d_valid = 0;
+      }
+   }
+   _ui_render_clear (rt->s, rt->cnt);
+   free (rt->id);    free (rt->r);     free (rt->s);     free (rt->dirty);
+
+   rt->id    = id;      rt->list  = id + cnt + 1;     rt->l_cnt = 0;
+   rt->r     = r;       rt->s     = s;                rt->dirty = dirty;
+   rt->b_item = ui_grp->b_item;
+   rt->cnt    = cnt;
+   return 0;
+}
+
+//------------------------------------------------------------------------------
+// 사본의 그리기 상태를 model에 반영한다. (lock, 사본과 model table이 다르면 0)
+// all = 0 : 이번 frame에 그린 item의 문자열 영역 (hot reload의 지울 영역 계산에 사용)
+// all = 1 : 모든 item의 그리기 상태 및 sprite (render thread 종료)
+//------------------------------------------------------------------------------
+static int _ui_render_sync (ui_grp_t *ui_grp, ui_render_t *rt, int all)
+{
+   string_item_t *m, *c;
+   int i, q, n;
+
+   if ((rt->b_item != ui_grp->b_item) || (rt->cnt != ui_grp->b_item_cnt))
+      return 0;
+
+   n = all ? rt->cnt : rt->l_cnt;
+   for (i = 0; i < n; i++) {
+      q = all ? i : rt->list[i];
+      m = &ui_grp->b_item[q].s;     c = &rt->s[q];
+      m->d_valid = c->d_valid;      m->d_layout = c->d_layout;
+      m->d_x     = c->d_x;          m->d_y      = c->d_y;
+      m->d_scale = c->d_scale;      m->d_cells  = c->d_cells;
+      if (!all)
          continue;
+
+      m->d_f_type = c->d_f_type;    m->d_smooth = c->d_smooth;
+      m->d_fc     = c->d_fc;        m->d_bc     = c->d_bc;
+      /* model buffer에 들어가지 않으면 다음에 전체를 다시 그린다. */
+      if (c->d_valid && (strlen (c->d_str) < (size_t)m->size))
+         strcpy (m->d_str, c->d_str);
+      else
+         m->d_valid = 0;
+      sprite_free (m->sprite);
+      m->sprite = c->sprite;        c->sprite = NULL;
+   }
+   return 1;
+}
+
+//------------------------------------------------------------------------------
+// 그릴 것이 있으면 1. (lock, popup 표시중에는 dirty item을 그리지 않는다)
+//------------------------------------------------------------------------------
+static int _ui_render_work (ui_grp_t *ui_grp, ui_render_t *rt)
+{
+   return rt->p_cnt || rt->fill_cnt || (ui_grp->dirty && !rt->p_active);
+}
+
+//------------------------------------------------------------------------------
+// 지울 영역, popup 요청, dirty item(b_order 순서)을 이번 frame으로 가져온다. (lock)
+//------------------------------------------------------------------------------
+static int _ui_render_take (ui_grp_t *ui_grp, ui_render_t *rt)
+{
+   rect_item_t *fill;
+   int i, q, max;
+
+   if (((rt->b_item != ui_grp->b_item) || (rt->cnt != ui_grp->b_item_cnt)) &&
+       _ui_render_build (ui_grp, rt, 0))
+      return -1;
+
+   fill       = rt->d_fill;     max          = rt->d_max;
+   rt->d_fill = rt->fill;       rt->d_max    = rt->fill_max;  rt->d_cnt = rt->fill_cnt;
+   rt->fill   = fill;           rt->fill_max = max;           rt->fill_cnt = 0;
+   memcpy (rt->d_popup, rt->popup, rt->p_cnt * sizeof(int));
+   rt->d_p_cnt = rt->p_cnt;     rt->p_cnt    = 0;
+
+   /* popup item은 model과 같이 사본을 만들어 그린다. */
+   for (i = 0; i < rt->d_p_cnt; i++) {
+      if (rt->d_popup[i] == UI_RENDER_POPUP_SHOW) {
+         rt->p_r = ui_grp->p_item.r;
+         _ui_render_str (&rt->p_s, &ui_grp->p_item.s);
+         break;
       }
-      switch(buf[0]) {
-         case  'C':  _ui_parser_cmd_C (buf, fb, ui_grp); break;
-         case  'B':  _ui_parser_cmd_B (buf, fb, ui_grp); break;
-         case  'I':  _ui_parser_cmd_I (buf, ui_grp);     break;
-         case  'T':  _ui_parser_cmd_T (buf, ui_grp);     break;
-         case  'R':  _ui_parser_cmd_R (buf, fb, ui_grp); break;
-         case  'S':  _ui_parser_cmd_S (buf, ui_grp);     break;
-         default :
-               fprintf(stdout, "ERROR: Unknown parser command! cmd = %c\n", buf[0]);
-         case  '#':  case  '\n':
-               break;
+   }
+
+   rt->l_cnt = 0;
+   if (!ui_grp->dirty || rt->p_active)
+      return 0;
+
+   for (i = 0; i < ui_grp->b_order_cnt; i++) {
+      q = ui_grp->b_order[i];
+      if (!ui_grp->b_dirty[q])
+         continue;
+
+      /* 나머지 item은 다음 frame에서 그린다. (ui_grp->dirty 유지) */
+      if (rt->l_cnt == UI_RENDER_ITEMS)
+         return rt->l_cnt;
+
+      if (ui_grp->b_dirty[q] & UI_DIRTY_RECT)
+         _ui_item_prep (ui_grp, q);
+      else
+         _ui_str_pos_xy (&ui_grp->b_rect[q], &ui_grp->b_item[q].s);
+
+      if (_ui_render_str (&rt->s[q], &ui_grp->b_item[q].s))
+         continue;
+      rt->r[q]     = ui_grp->b_rect[q];
+      rt->dirty[q] = ui_grp->b_dirty[q];
+      ui_grp->b_dirty[q] = 0;
+      rt->list[rt->l_cnt++] = q;
+   }
+   ui_grp->dirty = 0;
+   return rt->l_cnt;
+}
+
+//------------------------------------------------------------------------------
+// 이번 frame을 그린다. (lock 없음, 사본만 사용)
+// popup 요청을 먼저 그리므로 popup 종료 후 다시 그린 item은 popup에 가려지지 않는다.
+//------------------------------------------------------------------------------
+static void _ui_render_draw (ui_render_t *rt)
+{
+   rect_item_t *f;
+   int i, q;
+
+   for (i = 0, f = rt->d_fill; i < rt->d_cnt; i++, f++)
+      draw_fill_rect (rt->fb, f->x, f->y, f->w, f->h, f->bc.uint);
+
+   for (i = 0; i < rt->d_p_cnt; i++) {
+      /* popup이 item을 덮으므로 이후 item 업데이트는 전체를 다시 그린다. */
+      if (rt->d_popup[i] == UI_RENDER_POPUP_SHOW) {
+         for (q = 0; q < rt->cnt; q++)
+            rt->s[q].d_valid = 0;
+         /* 문자열 사본을 만들지 못한 경우 box만 그린다. */
+         if (rt->p_s.str)
+            _ui_update_rs (rt->fb, &rt->text, &rt->p_r, &rt->p_s);
+         else
+            _ui_update_r (rt->fb, &rt->p_r);
+      } else
+         _ui_update_r (rt->fb, &rt->p_r);
+   }
+
+   for (i = 0; i < rt->l_cnt; i++) {
+      q = rt->list[i];
+      if (rt->dirty[q] & UI_DIRTY_RECT)
+         _ui_update_rs (rt->fb, &rt->text, &rt->r[q], &rt->s[q]);
+      else
+         _ui_update_diff (rt->fb, &rt->text, &rt->r[q], &rt->s[q]);
+   }
+   rt->items += rt->l_cnt;
+}
+
+//------------------------------------------------------------------------------
+// 이전 frame 이후 1/fps가 지나지 않았으면 기다린다. (그 사이의 변경은 다음 frame에 모두 그림)
+//------------------------------------------------------------------------------
+static void *_ui_render_func (void *arg)
+{
+   ui_grp_t *ui_grp = (ui_grp_t *)arg;
+   ui_render_t *rt = ui_grp->render;
+   struct timespec now, next;
+   long period = 1000000000L / rt->fps;
+
+   clock_gettime (CLOCK_MONOTONIC, &next);
+   pthread_mutex_lock (&rt->lock);
+   while (1) {
+      while (!rt->stop && !_ui_render_work (ui_grp, rt))
+         pthread_cond_wait (&rt->cond, &rt->lock);
+
+      if ((rt->stop == 1) || (rt->stop && !_ui_render_work (ui_grp, rt)))
+         break;
+
+      /* 종료 요청시는 기다리지 않고 남은 item을 그린다. */
+      clock_gettime (CLOCK_MONOTONIC, &now);
+      if (!rt->stop && ((now.tv_sec < next.tv_sec) ||
+          ((now.tv_sec == next.tv_sec) && (now.tv_nsec < next.tv_nsec)))) {
+         pthread_mutex_unlock (&rt->lock);
+         clock_nanosleep (CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+         pthread_mutex_lock (&rt->lock);
+         continue;
+      }
+      next = now;
+      if ((next.tv_nsec += period) >= 1000000000L) {
+         next.tv_sec++;    next.tv_nsec -= 1000000000L;
       }
-      memset (buf, 0x00, sizeof(buf));
+
+      if (_ui_render_take (ui_grp, rt) < 0)
+         continue;
+      pthread_mutex_unlock (&rt->lock);
+
+      _ui_render_draw (rt);
+
+      pthread_mutex_lock (&rt->lock);
+      _ui_render_sync (ui_grp, rt, 0);
+      rt->frames++;
    }
-   if (!is_cfg_file) {
-      fprintf(stdout, "ERROR: UI Config File not found! (filename = %s)\n", cfg_filename);
-      free (ui_grp);
-      return NULL;
+   pthread_mutex_unlock (&rt->lock);
+   return arg;
+}
+
+//------------------------------------------------------------------------------
+static void _ui_render_free (ui_render_t *rt)
+{
+   _ui_render_clear (rt->s, rt->cnt);
+   _ui_render_clear (&rt->p_s, 1);
+   free (rt->id);    free (rt->r);     free (rt->s);     free (rt->dirty);
+   free (rt->fill);  free (rt->d_fill);
+   text_ctx_free (&rt->text);
+   free (rt);
+}
+
+//------------------------------------------------------------------------------
+// render thread를 시작한다. (성공시 1, fps <= 0 이면 UI_RENDER_FPS)
+// 이후 ui_set_xxx, ui_update 함수는 그리지 않고 render thread에 요청만 한다. (지연 모드 사용)
+// popup 표시중이면 popup이 끝난 후 시작한다.
+//------------------------------------------------------------------------------
+int ui_render_start (fb_info_t *fb, ui_grp_t *ui_grp, int fps)
+{
+   ui_render_t *rt;
+
+   if (ui_grp->render)
+      return 1;
+
+   _ui_popup_end (ui_grp, 0);
+
+   if ((rt = (ui_render_t *)calloc (1, sizeof(ui_render_t))) == NULL)
+      return 0;
+
+   rt->fb       = fb;
+   rt->fps      = (fps > 0) ? fps : UI_RENDER_FPS;
+   rt->deferred = ui_grp->deferred;
+   text_ctx_init (&rt->text, -1, -1);
+   if (_ui_render_build (ui_grp, rt, 1)) {
+      _ui_render_free (rt);
+      return 0;
    }
-   /* all item update */
-   if (ui_grp->b_item_cnt)
-      ui_update (fb, ui_grp, -1);
-   // cfg file close
-   if (pfd)
-      fclose (pfd);
-   // file parser
-   return   ui_grp;
+   pthread_mutex_init (&rt->lock, NULL);
+   pthread_cond_init (&rt->cond, NULL);
+
+   ui_grp->deferred = 1;
+   ui_grp->render   = rt;
+   if (pthread_create (&rt->thread, NULL, _ui_render_func, ui_grp)) {
+      ui_grp->render   = NULL;
+      ui_grp->deferred = rt->deferred;
+      _ui_render_sync (ui_grp, rt, 1);
+      pthread_cond_destroy (&rt->cond);
+      pthread_mutex_destroy (&rt->lock);
+      _ui_render_free (rt);
+      return 0;
+   }
+   return 1;
+}
+
+//------------------------------------------------------------------------------
+// render thread를 종료하고 그리기 상태를 model에 돌려준다.
+// flush = 1 이면 popup이 끝나기를 기다린 후 남은 요청을 모두 그린다. (ui_close는 그리지 않음)
+//------------------------------------------------------------------------------
+static void _ui_render_end (ui_grp_t *ui_grp, int flush)
+{
+   ui_render_t *rt = ui_grp->render;
+   int i;
+
+   if (rt == NULL)
+      return;
+
+   /* popup thread는 render thread에 요청하므로 먼저 끝낸다. */
+   _ui_popup_end (ui_grp, !flush);
+
+   pthread_mutex_lock (&rt->lock);
+   rt->stop = flush ? 2 : 1;
+   pthread_cond_signal (&rt->cond);
+   pthread_mutex_unlock (&rt->lock);
+   pthread_join (rt->thread, NULL);
+   ui_grp->render = NULL;
+
+   /* 사본을 만든 후 table이 바뀐 경우 다음 업데이트는 전체를 다시 그린다. */
+   if (!_ui_render_sync (ui_grp, rt, 1))
+      for (i = 0; i < ui_grp->b_item_cnt; i++)
+         ui_grp->b_item[i].s.d_valid = 0;
+
+   pthread_cond_destroy (&rt->cond);
+   pthread_mutex_destroy (&rt->lock);
+   ui_grp->deferred = rt->deferred;
+   if (flush && !ui_grp->deferred)
+      ui_flush (rt->fb, ui_grp);
+   _ui_render_free (rt);
+}
+
+//------------------------------------------------------------------------------
+void ui_render_stop (ui_grp_t *ui_grp)
+{
+   _ui_render_end (ui_grp, 1);
 }
 
 //------------------------------------------------------------------------------
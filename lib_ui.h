@@ -13,16 +13,36 @@
 #ifndef __LIB_UI_H__
 #define __LIB_UI_H__
 
+#include <pthread.h>
+
 #include "lib_ts.h"
 
 //------------------------------------------------------------------------------
-#define	ITEM_COUNT_MAX  256
-#define	ITEM_STR_MAX    256
 #define	ITEM_SCALE_MAX  100
+// ui arena block 크기 (bytes) 및 intern 문자열 hash table 크기
+#define	UI_ARENA_BLOCK  4096
+#define	UI_STR_HASH     64
+// item 문자열 최대 길이 (bytes, NULL 포함). text_layout의 줄 위치(int)로 표시 가능한 범위
+#define	UI_STR_MAX      65536
+// id -> b_item direct map 최대 크기 (이보다 큰 id는 검색)
+#define	UI_MAP_MAX      65536
+// touch hit test grid (UI_TGRID x UI_TGRID cell)
+#define	UI_TGRID        16
+// 지연 모드(ui_set_deferred)의 item dirty bit (ui_flush에서 그림)
+#define	UI_DIRTY_RECT   0x01    // rect 색상/외곽선 (item 전체를 다시 그림)
+#define	UI_DIRTY_STR    0x02    // 문자열, 위치, scale
+#define	UI_DIRTY_COLOR  0x04    // 문자열 색상
+// render thread(ui_render_start) 기본 frame rate, 한 frame에 그리는 최대 item 수
+#define	UI_RENDER_FPS   30
+#define	UI_RENDER_ITEMS 128
 
-#define	STR_ALIGN_C     0
-#define	STR_ALIGN_L     1
-#define	STR_ALIGN_R     2
+#define	STR_ALIGN_C     TEXT_ALIGN_C
+#define	STR_ALIGN_L     TEXT_ALIGN_L
+#define	STR_ALIGN_R     TEXT_ALIGN_R
+// 문자정렬(align)에 추가하는 줄바꿈 설정 (ex: 0x11 = 왼쪽 정렬 + 단어 단위 줄바꿈)
+#define	STR_WRAP_WORD   TEXT_WRAP_WORD
+#define	STR_WRAP_CHAR   TEXT_WRAP_CHAR
+#define	STR_ELLIPSIS    TEXT_ELLIPSIS
 
 //------------------------------------------------------------------------------
 typedef struct rect_item__t {
@@ -32,8 +52,29 @@ typedef struct rect_item__t {
 
 typedef struct string_item__t {
     int             x, y, scale, f_type, len;
+    // smooth glyph 사용 (scale > 1)
+    int             f_smooth;
+    // 문자정렬 및 줄바꿈 (STR_ALIGN_x | STR_WRAP_x | STR_ELLIPSIS)
+    int             align;
     fb_color_u      fc, bc;
-    char            str[ITEM_STR_MAX];
+    // 문자열 buffer (ui arena, str/d_str 각 size bytes, 긴 문자열 설정시 늘어남)
+    char            *str;
+    int             size;
+    // 문자열 크기 cache (m_cells < 0 이면 다시 계산, _ui_str_set/scale 변경시 무효화)
+    // m_nl : 문자열에 '\n' 포함
+    int             m_cells, m_scale, m_w, m_h, m_nl;
+    // 여러 줄 표시용 layout cache (l_valid = 0 또는 scale/박스 크기 변경시 다시 계산)
+    int             l_valid;
+    text_layout_t   lay;
+    // 마지막으로 화면에 그려진 문자열 (glyph 단위 부분 업데이트용, d_valid = 0 이면 전체 다시 그림)
+    // d_layout : 여러 줄 layout으로 그려짐 (박스 안쪽 전체를 다시 그림)
+    int             d_valid, d_x, d_y, d_scale, d_f_type, d_smooth, d_cells, d_layout;
+    fb_color_u      d_fc, d_bc;
+    char            *d_str;
+    // 한 줄 문자열의 offscreen image (rect 전체를 다시 그릴때 memcpy로 복사)
+    // f_sprite : sprite 사용 (ui_set_sprite, 같은 문자열을 다시 그리는 경우에만 사용)
+    int             f_sprite;
+    text_sprite_t   *sprite;
 }   string_item_t;
 
 // rect item
@@ -48,14 +89,13 @@ typedef struct s_item__t {
     string_item_t   s;
 }   s_item_t;
 
-// rect box + string item
+// rect box + string item (cold table)
+// id, gid, rect는 ui_grp_t의 hot table(b_id, b_gid, b_rect)에 같은 위치로 저장된다.
 typedef struct b_item__t {
-    int             gid;
-    int             id;
-    rect_item_t     r;
     string_item_t   s;
     int             s_align;
-    char            s_dfl[ITEM_STR_MAX];
+    // default string for ui_reset (intern 문자열)
+    const char      *s_dfl;
 }   b_item_t;
 
 //------------------+-----------------------------------------------
@@ -77,7 +117,8 @@ typedef struct i_item__t {
     char            grp_id;
     char            dev_id;
     char            is_info;
-    char            name[ITEM_STR_MAX];
+    // intern 문자열
+    const char      *name;
     // 0 : wait, 1 : pass, -1 : fail(cmd run status)
     int             complete;
     // 0 : fail, 1 : success (item check status)
@@ -92,52 +133,122 @@ typedef struct t_item__t {
     int             ui_id;
     // press color, release color
     fb_color_u      pc, rc;
+    // ui_id의 item 위치 (ui_init에서 연결, 없으면 -1)
+    int             b_pos;
 }   t_item_t;
 
 //------------------------------------------------------------------
 // Popup message item
 //------------------------------------------------------------------
 typedef struct p_item__t {
-    // time out
+    // time out (lock)
     int             timeout;
+    // popup thread, timeout 보호 lock. joinable : 종료 후 join 하지 않은 thread가 있음
+    pthread_t       thread;
+    pthread_mutex_t lock;
+    int             joinable;
     void            *vp_fb;
     rect_item_t     r;
     string_item_t   s;
+    // popup thread 전용 text context
+    fb_text_t       text;
 }   p_item_t;
 
+//------------------------------------------------------------------
+// UI arena
+// ui_grp_t, item 배열, 문자열을 block 단위로 할당하며 ui_close에서 한번에 해제한다.
+// 할당은 ui_init 및 item 문자열을 변경하는 함수(main thread)에서만 한다.
+//------------------------------------------------------------------
+typedef struct ui_arena__t {
+    struct ui_arena_blk__t  *blk;
+    // intern 문자열 (같은 문자열은 1개만 저장)
+    struct ui_istr__t       *str_hash[UI_STR_HASH];
+}   ui_arena_t;
+
 typedef struct ui_group__t {
-    int             f_type;
+    ui_arena_t      arena;
+
+    int             f_type, f_smooth;
     fb_color_u      fc, bc, lc;
 
-    int             b_item_cnt;
-    b_item_t        b_item[ITEM_COUNT_MAX];
+    // item 배열은 cfg file에 선언된 item 수만큼 할당 (b_item_max, i_item_max, t_item_max)
+    int             b_item_cnt, b_item_max;
+    // hot table (item 위치 별 id, gid, rect(위치/크기/색상)).
+    //   id 검색, 전체/group 업데이트, touch hit test는 이 배열만 순회한다.
+    int             *b_id, *b_gid;
+    rect_item_t     *b_rect;
+    // item 위치 별 dirty bit (UI_DIRTY_x), deferred : 지연 모드, dirty : dirty item 있음
+    unsigned char   *b_dirty;
+    int             deferred, dirty;
+    // cold table (문자열, 정렬, default 문자열)
+    b_item_t        *b_item;
+    // id -> b_item 위치 + 1 (0 = 없음, parser에서 item 추가시 등록, id < b_map_size)
+    int             b_map_size;
+    int             *b_map;
+    // 전체 업데이트 순서 (id 순서의 b_item 위치, ui_init에서 생성)
+    int             b_order_cnt;
+    int             *b_order;
+
+    int             i_item_cnt, i_item_max;
+    i_item_t        *i_item;
 
-    int             i_item_cnt;
-    i_item_t        i_item[ITEM_COUNT_MAX];
+    int             t_item_cnt, t_item_max;
+    t_item_t        *t_item;
+    // touch hit test grid. cell 별 t_item 번호 list (t_item 순서)
+    //   tg_list[tg_start[cell] ~ tg_start[cell + 1] - 1], tg_w/tg_h : grid를 만든 fb 크기
+    int             tg_w, tg_h;
+    int             tg_start[UI_TGRID * UI_TGRID + 1];
+    int             *tg_list;
 
-    int             t_item_cnt;
-    t_item_t        t_item[ITEM_COUNT_MAX];
+    // binary cache(<cfg>.cache)를 사용한 경우 mmap 영역 (b_id, b_gid, b_rect, t_item, 문자열)
+    void            *c_map;
+    unsigned int    c_size;
+
+    // cfg hot reload (ui_watch_start, 사용하지 않으면 NULL)
+    struct ui_watch__t  *watch;
+    // render thread (ui_render_start, 사용하지 않으면 NULL)
+    struct ui_render__t *render;
 
     p_item_t        p_item;
+
+    // item 표시용 text context
+    fb_text_t       text;
 }   ui_grp_t;
 
 //------------------------------------------------------------------------------
+extern int      ui_find_titem   (fb_info_t *fb, ui_grp_t *ui_grp, int x, int y);
 extern int      ui_get_titem    (fb_info_t *fb, ui_grp_t *ui_grp, ts_event_t *event);
 extern void     ui_set_ritem    (fb_info_t *fb, ui_grp_t *ui_grp, int f_id, int bc, int lc);
 extern void     ui_set_sitem    (fb_info_t *fb, ui_grp_t *ui_grp, int f_1d, int fc, int bc, char *str);
 extern void     ui_set_str      (fb_info_t *fb, ui_grp_t *ui_grp,
                                     int f_id, int x, int y, int scale, int font, char *fmt, ...);
+extern void     ui_vset_str     (fb_info_t *fb, ui_grp_t *ui_grp,
+                                    int f_id, int x, int y, int scale, int font, char *fmt, va_list va);
 extern void     ui_set_printf   (fb_info_t *fb, ui_grp_t *ui_grp, int id, char *fmt, ...);
+extern void     ui_vset_printf  (fb_info_t *fb, ui_grp_t *ui_grp, int id, char *fmt, va_list va);
+extern void     ui_set_smooth   (fb_info_t *fb, ui_grp_t *ui_grp, int id, int enable);
+extern void     ui_set_sprite   (ui_grp_t *ui_grp, int id, int enable);
 extern void     ui_update       (fb_info_t *fb, ui_grp_t *ui_grp, int id);
+extern void     ui_set_deferred (fb_info_t *fb, ui_grp_t *ui_grp, int enable);
+extern int      ui_flush        (fb_info_t *fb, ui_grp_t *ui_grp);
 extern void	    ui_update_group	(fb_info_t *fb, ui_grp_t *ui_grp, int gid);
 extern void     ui_close        (ui_grp_t *ui_grp);
 extern int      ui_set_popup (fb_info_t *fb, ui_grp_t *ui_grp,
                         int w, int h, int lw,       /* box width, box height, box outline width */
                         int fc, int bc, int lc,     /* color : font, background, outline */
                         int fs, int ts, char *fmt, ...); /* font scale, display time(sec), msg format */
+extern int      ui_vset_popup (fb_info_t *fb, ui_grp_t *ui_grp,
+                        int w, int h, int lw, int fc, int bc, int lc,
+                        int fs, int ts, char *fmt, va_list va);
 
 extern int      ui_update_popup (fb_info_t *fb, ui_grp_t *ui_grp);
 extern ui_grp_t *ui_init        (fb_info_t *fb, const char *cfg_filename);
+extern int      ui_cache_save   (fb_info_t *fb, const char *cfg_filename);
+extern int      ui_watch_start  (fb_info_t *fb, ui_grp_t *ui_grp, const char *cfg_filename);
+extern int      ui_watch_reload (fb_info_t *fb, ui_grp_t *ui_grp);
+extern void     ui_watch_stop   (ui_grp_t *ui_grp);
+extern int      ui_render_start (fb_info_t *fb, ui_grp_t *ui_grp, int fps);
+extern void     ui_render_stop  (ui_grp_t *ui_grp);
 
 //------------------------------------------------------------------------------
 
@@ -0,0 +1,712 @@
+//-----------------------------------------------------------------------------
+/**
+ * @file fontc.c
+ * @author charles-park (charles.park@hardkernel.com)
+ * @brief bitmap font compiler (fonts/Font*.h, BDF, PSF2, FBFN -> packed C table, FBFN file)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "lib_fb.h"
+#include "lib_font.h"
+
+//-----------------------------------------------------------------------------
+// 내장 font (fonts 폴더의 header를 입력으로 사용)
+//-----------------------------------------------------------------------------
+#include "fonts/FontAscii_8x16.h"
+#include "fonts/FontAscii_16x32.h"
+#include "fonts/FontHangul.h"
+#include "fonts/FontHanboot.h"
+#include "fonts/FontHangodic.h"
+#include "fonts/FontHanpil.h"
+#include "fonts/FontHansoft.h"
+
+//-----------------------------------------------------------------------------
+// 변환중인 font (glyph는 w x h, row 당 pitch bytes의 원본 bitmap)
+//-----------------------------------------------------------------------------
+typedef struct fc_font__t {
+    int             type;       // eFONT_FILE_xxx
+    int             w, h, pitch, count;
+    unsigned char   *bitmap;
+    // code index (NULL 이면 code = glyph 번호)
+    font_index_t    *index;
+    int             index_cnt;
+}   fc_font_t;
+
+//-----------------------------------------------------------------------------
+// Function prototype define.
+//-----------------------------------------------------------------------------
+static int  fc_alloc        (fc_font_t *f, int type, int w, int h, int count);
+static int  fc_load_builtin (fc_font_t *f, const char *name);
+static int  fc_load_psf2    (fc_font_t *f, const char *path);
+static int  fc_load_fbfn    (fc_font_t *f, const char *path);
+static int  fc_load_bdf     (fc_font_t *f, const char *path);
+static int  fc_compose      (const fc_font_t *jamo, fc_font_t *f);
+static int  fc_rotate       (const fc_font_t *src, fc_font_t *f);
+static void fc_write_rows   (FILE *fp, const char *name, const fc_font_t *f,
+                                const unsigned char *rows, int size);
+static int  fc_pack_mask    (const fc_font_t *f, const unsigned char *s, unsigned char *dest);
+static int  fc_pack_row     (const fc_font_t *f, const unsigned char *s, unsigned char *dest);
+static int  fc_pack         (const fc_font_t *f, font_prow_t *meta, unsigned char *rows);
+static void fc_write_packed (FILE *fp, const char *name, const fc_font_t *f);
+static void fc_write_face   (FILE *fp, const char *name, const fc_font_t *f);
+static int  fc_write_c      (const char *path, const char *name, const fc_font_t *f,
+                                int syllable, const fc_font_t *rot);
+static int  fc_write_fbfn   (const char *path, const char *name, const fc_font_t *f);
+
+//-----------------------------------------------------------------------------
+// lib_fb.c (get_hangul_image)와 같은 초성/중성/종성 조합 table
+//-----------------------------------------------------------------------------
+static const char D_ML[22] = { 0, 0, 2, 0, 2, 1, 2, 1, 2, 3, 0, 2, 1, 3, 3, 1, 2, 1, 3, 3, 1, 1 };
+static const char D_FM[40] = { 1, 3, 0, 2, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 0, 2, 1, 3, 1, 3, 1, 3 };
+static const char D_MF[44] = { 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 1, 6, 3, 7, 3, 7, 3, 7, 1, 6, 2, 6, 4, 7, 4, 7, 4, 7, 2, 6, 1, 6, 3, 7, 0, 5 };
+
+//-----------------------------------------------------------------------------
+static void print_usage (const char *prog)
+{
+    printf("Usage: %s -i <input> [-n name] [-o out.c] [-b out.fbf] [-cr]\n", prog);
+    puts("  -i --input     input font\n"
+         "                 ascii, ascii16x32     fonts/FontAscii_*.h\n"
+         "                 hangul:0 ~ hangul:4   fonts/FontHan*.h (enum eFONTS_HANGUL)\n"
+         "                 bdf:<file>, psf:<file>, fbfn:<file>\n"
+         "  -n --name      C symbol name (default FontFace)\n"
+         "  -o --output    generated C source (packed rows)\n"
+         "  -b --binary    FBFN font file for font_load()\n"
+         "  -c --compose   hangul : add pre-composed syllables (가 ~ 힣)\n"
+         "  -r --rotate    add 90 degree rotated glyph table\n"
+         "  Useage : ./tools/fontc -i hangul:0 -n FontHangul_Myeongjo -o fonts/gen/FontHangul_Myeongjo.c\n"
+    );
+    exit(1);
+}
+
+//-----------------------------------------------------------------------------
+static int fc_alloc (fc_font_t *f, int type, int w, int h, int count)
+{
+    memset (f, 0, sizeof(fc_font_t));
+    f->type  = type;
+    f->w     = w;       f->h     = h;
+    f->pitch = (w + 7) / 8;
+    f->count = count;
+
+    if ((f->bitmap = (unsigned char *)calloc (count, h * f->pitch)) == NULL) {
+        fprintf(stderr, "%s : malloc error!\n", __func__);
+        return -1;
+    }
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+static int fc_load_builtin (fc_font_t *f, const char *name)
+{
+    static const unsigned char *hangul[eFONT_END][3] = {
+        { (const unsigned char *)FONT_HANGUL1,   (const unsigned char *)FONT_HANGUL2,   (const unsigned char *)FONT_HANGUL3   },
+        { (const unsigned char *)FONT_HANBOOT1,  (const unsigned char *)FONT_HANBOOT2,  (const unsigned char *)FONT_HANBOOT3  },
+        { (const unsigned char *)FONT_HANGODIC1, (const unsigned char *)FONT_HANGODIC2, (const unsigned char *)FONT_HANGODIC3 },
+        { (const unsigned char *)FONT_HANPIL1,   (const unsigned char *)FONT_HANPIL2,   (const unsigned char *)FONT_HANPIL3   },
+        { (const unsigned char *)FONT_HANSOFT1,  (const unsigned char *)FONT_HANSOFT2,  (const unsigned char *)FONT_HANSOFT3  },
+    };
+    int n;
+
+    if (!strcmp (name, "ascii")) {
+        if (fc_alloc (f, eFONT_FILE_ASCII, FONT_ASCII_WIDTH, FONT_HEIGHT, 256))
+            return -1;
+        memcpy (f->bitmap, FONT_ASCII, 256 * 16);
+        return 0;
+    }
+    if (!strcmp (name, "ascii16x32")) {
+        if (fc_alloc (f, eFONT_FILE_ASCII, FONT_ASCII_WIDTH * 2, FONT_HEIGHT * 2, 256))
+            return -1;
+        memcpy (f->bitmap, FONT_ASCII_16x32, 256 * 64);
+        return 0;
+    }
+    if (!strncmp (name, "hangul:", 7)) {
+        n = atoi (name + 7);
+        if ((n < 0) || (n >= eFONT_END))
+            return -1;
+        if (fc_alloc (f, eFONT_FILE_HANGUL, FONT_HANGUL_WIDTH, FONT_HEIGHT, FONT_HANGUL_GLYPHS))
+            return -1;
+        memcpy (f->bitmap, hangul[n][0], FONT_HANGUL_F_CNT * 32);
+        memcpy (f->bitmap + FONT_HANGUL_F_CNT * 32, hangul[n][1], FONT_HANGUL_M_CNT * 32);
+        memcpy (f->bitmap + (FONT_HANGUL_F_CNT + FONT_HANGUL_M_CNT) * 32, hangul[n][2],
+                FONT_HANGUL_L_CNT * 32);
+        return 0;
+    }
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+static unsigned char *fc_read_file (const char *path, long *size)
+{
+    unsigned char *buf;
+    FILE *fp;
+
+    if ((fp = fopen (path, "rb")) == NULL) {
+        fprintf(stderr, "%s : %s file not found!\n", __func__, path);
+        return NULL;
+    }
+    fseek (fp, 0, SEEK_END);    *size = ftell (fp);     fseek (fp, 0, SEEK_SET);
+
+    if ((buf = (unsigned char *)malloc (*size + 1)) != NULL) {
+        if (fread (buf, 1, *size, fp) != (size_t)*size) {
+            free (buf);
+            buf = NULL;
+        }
+    }
+    fclose (fp);
+    return buf;
+}
+
+//-----------------------------------------------------------------------------
+static int fc_index_cmp (const void *a, const void *b)
+{
+    const font_index_t *ia = a, *ib = b;
+
+    return (ia->code > ib->code) - (ia->code < ib->code);
+}
+
+//-----------------------------------------------------------------------------
+static int fc_index_add (fc_font_t *f, unsigned int code, unsigned int glyph, int *size)
+{
+    if (f->index_cnt >= *size) {
+        font_index_t *t;
+
+        *size = *size ? *size * 2 : 256;
+        if ((t = (font_index_t *)realloc (f->index, *size * sizeof(font_index_t))) == NULL)
+            return -1;
+        f->index = t;
+    }
+    f->index[f->index_cnt].code  = code;
+    f->index[f->index_cnt].glyph = glyph;
+    f->index_cnt++;
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// PSF2 (Linux console font, 압축되지 않은 파일)
+//-----------------------------------------------------------------------------
+static int fc_load_psf2 (fc_font_t *f, const char *path)
+{
+    const unsigned int *hdr;
+    unsigned char *buf, *p, *end;
+    unsigned int code, n, glyph = 0;
+    int size = 0, seq = 0;
+    long len;
+
+    if ((buf = fc_read_file (path, &len)) == NULL)
+        return -1;
+
+    /* magic, version, headersize, flags, length, charsize, height, width */
+    hdr = (const unsigned int *)buf;
+    if ((len < 32) || (hdr[0] != 0x864AB572) ||
+        (hdr[2] + (long)hdr[4] * hdr[5] > len) || (hdr[5] != hdr[6] * ((hdr[7] + 7) / 8)))
+        goto err;
+
+    if (fc_alloc (f, eFONT_FILE_ASCII, hdr[7], hdr[6], hdr[4]))
+        goto err;
+    memcpy (f->bitmap, buf + hdr[2], hdr[4] * hdr[5]);
+
+    /* unicode table (0xFE = sequence 시작, 0xFF = glyph 끝) */
+    if (hdr[3] & 0x01) {
+        p = buf + hdr[2] + hdr[4] * hdr[5];     end = buf + len;
+        while ((p < end) && (glyph < hdr[4])) {
+            if (*p == 0xFF) {   glyph++;    seq = 0;    p++;    continue;   }
+            if (*p == 0xFE) {   seq = 1;                p++;    continue;   }
+
+            if      (*p < 0x80) {   code = *p;          n = 0;  }
+            else if (*p < 0xE0) {   code = *p & 0x1F;   n = 1;  }
+            else if (*p < 0xF0) {   code = *p & 0x0F;   n = 2;  }
+            else                {   code = *p & 0x07;   n = 3;  }
+            for (p++; n && (p < end); n--, p++)
+                code = (code << 6) | (*p & 0x3F);
+
+            if (!seq && fc_index_add (f, code, glyph, &size))
+                goto err;
+        }
+        qsort (f->index, f->index_cnt, sizeof(font_index_t), fc_index_cmp);
+    }
+    free (buf);
+    return 0;
+err:
+    fprintf(stderr, "%s : %s psf2 format error!\n", __func__, path);
+    free (buf);
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+static int fc_load_fbfn (fc_font_t *f, const char *path)
+{
+    const font_file_t *hdr;
+    unsigned char *buf;
+    unsigned int i;
+    long len;
+
+    if ((buf = fc_read_file (path, &len)) == NULL)
+        return -1;
+
+    hdr = (const font_file_t *)buf;
+    if ((len < (long)sizeof(font_file_t)) || memcmp (hdr->magic, FONT_FILE_MAGIC, 4) ||
+        (hdr->version != FONT_FILE_VERSION) || (hdr->type >= eFONT_FILE_END) ||
+        (hdr->pitch != (hdr->w + 7) / 8) ||
+        (hdr->glyph_off + (long)hdr->count * hdr->h * hdr->pitch > len) ||
+        (hdr->index_off + (long)hdr->index_cnt * sizeof(font_index_t) > (unsigned long)len))
+        goto err;
+
+    if (fc_alloc (f, hdr->type, hdr->w, hdr->h, hdr->count))
+        goto err;
+    memcpy (f->bitmap, buf + hdr->glyph_off, hdr->count * hdr->h * hdr->pitch);
+
+    if (hdr->index_cnt) {
+        int size = 0;
+        const font_index_t *index = (const font_index_t *)(buf + hdr->index_off);
+
+        for (i = 0; i < hdr->index_cnt; i++)
+            if (fc_index_add (f, index[i].code, index[i].glyph, &size))
+                goto err;
+    }
+    free (buf);
+    return 0;
+err:
+    fprintf(stderr, "%s : %s fbfn format error!\n", __func__, path);
+    free (buf);
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+// BDF : FONTBOUNDINGBOX 크기의 cell에 baseline을 맞추어 glyph를 배치한다.
+//-----------------------------------------------------------------------------
+static int fc_load_bdf (fc_font_t *f, const char *path)
+{
+    FILE *fp;
+    char line[256];
+    int fw = 0, fh = 0, fx = 0, fy = 0, bw = 0, bh = 0, bx = 0, by = 0;
+    int code = -1, glyphs = 0, row = -1, size = 0, max = 0, i, x, y;
+    unsigned char *g = NULL;
+
+    if ((fp = fopen (path, "r")) == NULL) {
+        fprintf(stderr, "%s : %s file not found!\n", __func__, path);
+        return -1;
+    }
+    memset (f, 0, sizeof(fc_font_t));
+
+    while (fgets (line, sizeof(line), fp) != NULL) {
+        if (!strncmp (line, "FONTBOUNDINGBOX", 15)) {
+            sscanf (line + 15, "%d %d %d %d", &fw, &fh, &fx, &fy);
+        } else if (!strncmp (line, "CHARS ", 6)) {
+            max = atoi (line + 6);
+            if ((fw <= 0) || (fh <= 0) || (max <= 0) ||
+                 fc_alloc (f, eFONT_FILE_ASCII, fw, fh, max))
+                goto err;
+        } else if (!strncmp (line, "ENCODING", 8)) {
+            code = atoi (line + 8);
+        } else if (!strncmp (line, "BBX", 3)) {
+            sscanf (line + 3, "%d %d %d %d", &bw, &bh, &bx, &by);
+        } else if (!strncmp (line, "BITMAP", 6)) {
+            if ((f->bitmap == NULL) || (glyphs >= max) || (code < 0)) {
+                row = -1;
+                continue;
+            }
+            g   = f->bitmap + glyphs * fh * f->pitch;
+            row = 0;
+        } else if (!strncmp (line, "ENDCHAR", 7)) {
+            if (row >= 0) {
+                if (fc_index_add (f, code, glyphs, &size))
+                    goto err;
+                glyphs++;
+            }
+            row = -1;   code = -1;
+        } else if ((row >= 0) && (row < bh)) {
+            /* glyph row (hex), cell 좌표 = BBX offset - FONTBOUNDINGBOX offset */
+            y = (fh + fy) - (by + bh) + row;
+            for (i = 0; (i < bw) && (y >= 0) && (y < fh); i++) {
+                unsigned int v;
+                char hex[2] = { line[i / 4], 0 };
+
+                if (!hex[0] || (hex[0] == '\n'))
+                    break;
+                v = strtol (hex, NULL, 16);
+                x = bx - fx + i;
+                if ((v & (0x8 >> (i & 3))) && (x >= 0) && (x < fw))
+                    g[y * f->pitch + (x >> 3)] |= 0x80 >> (x & 7);
+            }
+            row++;
+        }
+    }
+    fclose (fp);
+    if (f->bitmap == NULL)
+        return -1;
+
+    f->count = glyphs;
+    qsort (f->index, f->index_cnt, sizeof(font_index_t), fc_index_cmp);
+    return 0;
+err:
+    fprintf(stderr, "%s : %s bdf format error!\n", __func__, path);
+    fclose (fp);
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+// 조합형 font로 완성형 glyph(가 ~ 힣)를 만들어 조합형 glyph 뒤에 추가한다.
+//-----------------------------------------------------------------------------
+static int fc_compose (const fc_font_t *jamo, fc_font_t *f)
+{
+    int code, i, f0, m, l, f1, f2, f3, glyph[3];
+    unsigned char *dest;
+
+    if (fc_alloc (f, eFONT_FILE_HANGUL, FONT_HANGUL_WIDTH, FONT_HEIGHT,
+                    FONT_HANGUL_GLYPHS + FONT_HANGUL_SYLLABLES))
+        return -1;
+    memcpy (f->bitmap, jamo->bitmap, FONT_HANGUL_GLYPHS * 32);
+
+    for (code = 0; code < FONT_HANGUL_SYLLABLES; code++) {
+        l  = code % 28;
+        m  = (code / 28) % 21 + 1;
+        f0 = (code / 28) / 21 + 1;
+
+        f3 = D_ML[m];
+        f2 = D_FM[(f0 * 2) + (l != 0)];
+        f1 = D_MF[(m  * 2) + (l != 0)];
+
+        glyph[0] = f1 * 20 + f0;
+        glyph[1] = f2 * 22 + m + FONT_HANGUL_F_CNT;
+        glyph[2] = l ? (f3 * 28 + l + FONT_HANGUL_F_CNT + FONT_HANGUL_M_CNT) : -1;
+
+        dest = f->bitmap + (FONT_HANGUL_GLYPHS + code) * 32;
+        for (i = 0; i < 3; i++) {
+            int n;
+            if (glyph[i] < 0)
+                continue;
+            for (n = 0; n < 32; n++)
+                dest[n] |= jamo->bitmap[glyph[i] * 32 + n];
+        }
+    }
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// 시계방향 90도 회전 : dest(x, y) = src(y, h - 1 - x), 회전된 glyph 크기는 h x w
+//-----------------------------------------------------------------------------
+static int fc_rotate (const fc_font_t *src, fc_font_t *f)
+{
+    int g, x, y;
+    const unsigned char *s;
+    unsigned char *d;
+
+    if (fc_alloc (f, src->type, src->h, src->w, src->count))
+        return -1;
+
+    for (g = 0; g < src->count; g++) {
+        s = src->bitmap + g * src->h * src->pitch;
+        d = f->bitmap   + g * f->h   * f->pitch;
+        for (y = 0; y < f->h; y++)
+            for (x = 0; x < f->w; x++) {
+                int sx = y, sy = src->h - 1 - x;
+                if (s[sy * src->pitch + (sx >> 3)] & (0x80 >> (sx & 7)))
+                    d[y * f->pitch + (x >> 3)] |= 0x80 >> (x & 7);
+            }
+    }
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+static void fc_write_rows (FILE *fp, const char *name, const fc_font_t *f,
+                            const unsigned char *rows, int size)
+{
+    int i;
+
+    (void)f;
+    fprintf (fp, "static const unsigned char %s[%d] = {", name, size ? size : 1);
+    for (i = 0; i < size; i++)
+        fprintf (fp, "%s%3d,", (i % 16) ? "" : "\n    ", rows[i]);
+    if (!size)
+        fprintf (fp, "\n    0,");
+    fprintf (fp, "\n};\n\n");
+}
+
+//-----------------------------------------------------------------------------
+// glyph(s)를 byte 단위 mask와 0이 아닌 byte로 dest에 저장한다. 반환값은 저장한 크기
+//-----------------------------------------------------------------------------
+static int fc_pack_mask (const fc_font_t *f, const unsigned char *s, unsigned char *dest)
+{
+    int i, glyph_size = f->h * f->pitch, pos = FONT_PACK_MASK(glyph_size);
+
+    memset (dest, 0, pos);
+    for (i = 0; i < glyph_size; i++) {
+        if (s[i]) {
+            dest[i >> 3] |= 0x80 >> (i & 7);
+            dest[pos++] = s[i];
+        }
+    }
+    return pos;
+}
+
+//-----------------------------------------------------------------------------
+// glyph(s)를 row 별 2 bit code와 새 row로 dest에 저장한다. 반환값은 저장한 크기
+// 확대된 face(16x32)는 같은 row가 반복되므로 byte mask보다 작다.
+//-----------------------------------------------------------------------------
+static int fc_pack_row (const fc_font_t *f, const unsigned char *s, unsigned char *dest)
+{
+    int y, i, code, pos = FONT_PACK_CODE(f->h);
+    const unsigned char *r;
+
+    memset (dest, 0, pos);
+    for (y = 0, r = s; y < f->h; y++, r += f->pitch) {
+        for (i = 0; (i < f->pitch) && !r[i]; i++)
+            ;
+        if (i == f->pitch)
+            code = 0;
+        else if (y && !memcmp (r, r - f->pitch, f->pitch))
+            code = 1;
+        else {
+            code = 2;
+            memcpy (dest + pos, r, f->pitch);
+            pos += f->pitch;
+        }
+        dest[y >> 2] |= code << (6 - (y & 3) * 2);
+    }
+    return pos;
+}
+
+//-----------------------------------------------------------------------------
+// glyph 별로 byte mask와 row coding 중 작은 쪽을 rows에 저장한다. (font_unpack_or)
+// 같은 bitmap의 glyph는 먼저 저장한 glyph의 offset을 사용한다.
+// 반환값은 rows 크기 (bytes)
+//-----------------------------------------------------------------------------
+static int fc_pack (const fc_font_t *f, font_prow_t *meta, unsigned char *rows)
+{
+    int g, i, n_mask, n_row, pos = 0, hash_size, glyph_size = f->h * f->pitch;
+    unsigned char *mask, *row;
+    const unsigned char *s;
+    unsigned int hash;
+    int *table;
+
+    for (hash_size = 256; hash_size < f->count * 2; hash_size *= 2)
+        ;
+    table = (int *)malloc (hash_size * sizeof(int));
+    mask  = (unsigned char *)malloc (glyph_size + FONT_PACK_MASK(glyph_size));
+    row   = (unsigned char *)malloc (glyph_size + FONT_PACK_CODE(f->h));
+    if ((table == NULL) || (mask == NULL) || (row == NULL)) {
+        fprintf(stderr, "%s : malloc error!\n", __func__);
+        exit(1);
+    }
+    memset (table, 0xFF, hash_size * sizeof(int));
+
+    for (g = 0; g < f->count; g++) {
+        s = f->bitmap + g * glyph_size;
+
+        for (hash = 2166136261u, i = 0; i < glyph_size; i++)
+            hash = (hash ^ s[i]) * 16777619u;
+        for (i = hash & (hash_size - 1); table[i] >= 0; i = (i + 1) & (hash_size - 1))
+            if (!memcmp (f->bitmap + table[i] * glyph_size, s, glyph_size))
+                break;
+        if (table[i] >= 0) {
+            meta[g] = meta[table[i]];
+            continue;
+        }
+        table[i] = g;
+
+        n_mask = fc_pack_mask (f, s, mask);
+        n_row  = fc_pack_row  (f, s, row);
+        if (n_row < n_mask) {
+            meta[g].offset = pos | FONT_PACK_ROW;
+            memcpy (rows + pos, row, n_row);
+            pos += n_row;
+        } else {
+            meta[g].offset = pos;
+            memcpy (rows + pos, mask, n_mask);
+            pos += n_mask;
+        }
+    }
+    free (table);   free (mask);    free (row);
+    return pos;
+}
+
+//-----------------------------------------------------------------------------
+// packed rows (name_rows)와 glyph offset table (name_meta)
+//-----------------------------------------------------------------------------
+static void fc_write_packed (FILE *fp, const char *name, const fc_font_t *f)
+{
+    int glyph_size = f->h * f->pitch;
+    font_prow_t *meta = (font_prow_t *)malloc (f->count * sizeof(font_prow_t));
+    unsigned char *rows = (unsigned char *)malloc (f->count * (glyph_size + FONT_PACK_MASK(glyph_size)));
+    char sym[128];
+    int size, g;
+
+    if ((meta == NULL) || (rows == NULL)) {
+        fprintf(stderr, "%s : malloc error!\n", __func__);
+        exit(1);
+    }
+    size = fc_pack (f, meta, rows);
+
+    /* Makefile은 link 후 이 줄(// name : ...)을 원본/packed 크기로 표시한다. */
+    fprintf (fp, "// %s : %d glyphs, %d -> %d bytes (+ %d bytes meta)\n", name, f->count,
+                f->count * glyph_size, size, (int)(f->count * sizeof(font_prow_t)));
+    snprintf (sym, sizeof(sym), "%s_rows", name);
+    fc_write_rows (fp, sym, f, rows, size);
+
+    fprintf (fp, "// offset\n");
+    fprintf (fp, "static const font_prow_t %s_meta[%d] = {", name, f->count);
+    for (g = 0; g < f->count; g++)
+        fprintf (fp, "%s{ 0x%08X },", (g % 8) ? " " : "\n    ", meta[g].offset);
+    fprintf (fp, "\n};\n\n");
+
+    fprintf (stdout, "%s : %d glyphs, %d -> %d bytes (+ %d bytes meta)\n", name, f->count,
+                f->count * glyph_size, size, (int)(f->count * sizeof(font_prow_t)));
+    free (meta);    free (rows);
+}
+
+//-----------------------------------------------------------------------------
+static void fc_write_face (FILE *fp, const char *name, const fc_font_t *f)
+{
+    int i;
+
+    fc_write_packed (fp, name, f);
+
+    if (f->index_cnt) {
+        fprintf (fp, "static const font_index_t %s_index[%d] = {\n", name, f->index_cnt);
+        for (i = 0; i < f->index_cnt; i++)
+            fprintf (fp, "    { 0x%04X, %4u },\n", f->index[i].code, f->index[i].glyph);
+        fprintf (fp, "};\n\n");
+    }
+    fprintf (fp, "const font_face_t %s = {\n", name);
+    fprintf (fp, "    \"%s\", %d, %d, %d, %d,\n", name, f->w, f->h, f->pitch, f->count);
+    fprintf (fp, "    %s_rows, ", name);
+    if (f->index_cnt)
+        fprintf (fp, "%s_index, %d, ", name, f->index_cnt);
+    else
+        fprintf (fp, "NULL, 0, ");
+    fprintf (fp, "%s_meta\n};\n\n", name);
+}
+
+//-----------------------------------------------------------------------------
+// syllable = 1 이면 f는 조합형 glyph 뒤에 완성형 glyph를 가진다. (fc_compose)
+//-----------------------------------------------------------------------------
+static int fc_write_c (const char *path, const char *name, const fc_font_t *f,
+                        int syllable, const fc_font_t *rot)
+{
+    FILE *fp;
+    char sym[128];
+
+    if ((fp = fopen (path, "w")) == NULL) {
+        fprintf(stderr, "%s : %s file create error!\n", __func__, path);
+        return -1;
+    }
+    fprintf (fp, "//[*]--------------------------------------------------------------------------------------------------------------[*]\n");
+    fprintf (fp, "// Generated by tools/fontc. Do not edit. (make fonts)\n");
+    fprintf (fp, "//[*]--------------------------------------------------------------------------------------------------------------[*]\n");
+    fprintf (fp, "#include <stddef.h>\n#include \"../../lib_fb.h\"\n#include \"../../lib_font.h\"\n\n");
+
+    snprintf (sym, sizeof(sym), "%s_rot90", name);
+    if (f->type == eFONT_FILE_HANGUL) {
+        fc_write_packed (fp, name, f);
+        if (rot) {
+            fc_write_packed (fp, sym, rot);
+            fprintf (fp, "static const font_hangul_t %s = {\n", sym);
+            fprintf (fp, "    \"%s\", %s_meta, %s%s%s, %s_rows, NULL\n};\n\n", sym, sym,
+                        syllable ? sym : "NULL", syllable ? "_meta + " : "",
+                        syllable ? "FONT_HANGUL_GLYPHS" : "", sym);
+        }
+        fprintf (fp, "const font_hangul_t %s = {\n", name);
+        fprintf (fp, "    \"%s\", %s_meta, %s%s%s, %s_rows, %s%s\n};\n", name, name,
+                    syllable ? name : "NULL", syllable ? "_meta + " : "",
+                    syllable ? "FONT_HANGUL_GLYPHS" : "", name,
+                    rot ? "&" : "NULL", rot ? sym : "");
+    } else {
+        fc_write_face (fp, name, f);
+        if (rot)
+            fc_write_face (fp, sym, rot);
+    }
+    fclose (fp);
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+static int fc_write_fbfn (const char *path, const char *name, const fc_font_t *f)
+{
+    font_file_t hdr;
+    FILE *fp;
+
+    if ((fp = fopen (path, "wb")) == NULL) {
+        fprintf(stderr, "%s : %s file create error!\n", __func__, path);
+        return -1;
+    }
+    memset (&hdr, 0, sizeof(hdr));
+    memcpy (hdr.magic, FONT_FILE_MAGIC, 4);
+    hdr.version   = FONT_FILE_VERSION;
+    hdr.type      = f->type;
+    hdr.w         = f->w;       hdr.h = f->h;   hdr.pitch = f->pitch;
+    hdr.count     = f->count;
+    hdr.index_cnt = f->index_cnt;
+    hdr.index_off = sizeof(font_file_t);
+    hdr.glyph_off = hdr.index_off + f->index_cnt * sizeof(font_index_t);
+    strncpy (hdr.name, name, sizeof(hdr.name) - 1);
+
+    fwrite (&hdr, sizeof(hdr), 1, fp);
+    if (f->index_cnt)
+        fwrite (f->index, sizeof(font_index_t), f->index_cnt, fp);
+    fwrite (f->bitmap, f->h * f->pitch, f->count, fp);
+    fclose (fp);
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+int main (int argc, char **argv)
+{
+    static const struct option lopts[] = {
+        { "input",   1, 0, 'i' },
+        { "name",    1, 0, 'n' },
+        { "output",  1, 0, 'o' },
+        { "binary",  1, 0, 'b' },
+        { "compose", 0, 0, 'c' },
+        { "rotate",  0, 0, 'r' },
+        { NULL, 0, 0, 0 },
+    };
+    const char *input = NULL, *name = "FontFace", *out_c = NULL, *out_b = NULL;
+    int opt_compose = 0, opt_rotate = 0, c, ret;
+    fc_font_t font, syllable, rot;
+
+    while ((c = getopt_long (argc, argv, "i:n:o:b:cr", lopts, NULL)) != -1) {
+        switch (c) {
+            case 'i':   input = optarg;     break;
+            case 'n':   name  = optarg;     break;
+            case 'o':   out_c = optarg;     break;
+            case 'b':   out_b = optarg;     break;
+            case 'c':   opt_compose = 1;    break;
+            case 'r':   opt_rotate  = 1;    break;
+            default :   print_usage (argv[0]);  break;
+        }
+    }
+    if ((input == NULL) || ((out_c == NULL) && (out_b == NULL)))
+        print_usage (argv[0]);
+
+    if      (!strncmp (input, "bdf:",  4))  ret = fc_load_bdf  (&font, input + 4);
+    else if (!strncmp (input, "psf:",  4))  ret = fc_load_psf2 (&font, input + 4);
+    else if (!strncmp (input, "fbfn:", 5))  ret = fc_load_fbfn (&font, input + 5);
+    else                                    ret = fc_load_builtin (&font, input);
+
+    if (ret) {
+        fprintf(stderr, "%s : %s input error!\n", argv[0], input);
+        return 1;
+    }
+    if (opt_compose) {
+        if ((font.type != eFONT_FILE_HANGUL) || fc_compose (&font, &syllable))
+            return 1;
+    }
+    if (opt_rotate && fc_rotate (opt_compose ? &syllable : &font, &rot))
+        return 1;
+
+    if (out_c && fc_write_c (out_c, name, opt_compose ? &syllable : &font,
+                                opt_compose, opt_rotate ? &rot : NULL))
+        return 1;
+    if (out_b && fc_write_fbfn (out_b, name, &font))
+        return 1;
+
+    return 0;
+}